@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 #include <type_traits>
+#include <vector>
 
 // lambda mutable 用来保证可以修改按值捕获的变量
 
@@ -280,6 +281,16 @@ public:
         try {
           // 获取 curent future 准备就绪之后设置的 future
           V future = std::move(innerFuture); // 隐式类型转换
+          // 内部 future 可能已经准备就绪（例如 makeReadyFuture），
+          // 这个时候设置的 callback 不会再被执行，需要直接设置 promise
+          std::unique_lock<std::mutex> lk(future.state_->mutex_);
+          if (future.state_->progress_ == Progress::Done) {
+            typename ResultWrapper<InnerType>::Type r(
+                std::move(future.state_->value_));
+            lk.unlock();
+            pm.setValue(std::move(r));
+            return;
+          }
           // 设置该 future 的 callback 函数，当这个 future 准备就绪的时候，
           // 将这个 future 的值设置到返回给客户端的 promise
           future._setCallback(
@@ -555,6 +566,73 @@ inline Future<T> makeExceptionFuture(std::exception_ptr &&eptr) {
   return promise.getFuture();
 }
 
+/// ---------------- shared future ----------------
+/**
+ * @brief 可以被多个消费者等待的 future.
+ * 接管一个 Future<T>，每次调用 getFuture() 得到一个独立的 Future<T>，
+ * 结果就绪之后每个 Future 得到结果的一份拷贝，因此 T 必须可以拷贝.
+ * 结果就绪之后调用 getFuture() 返回一个已经就绪的 Future
+ *
+ * @tparam T
+ */
+template <typename T> class SharedFuture {
+  static_assert(!std::is_void<T>::value, "SharedFuture<void> is not supported");
+
+public:
+  using ValueType = typename State<T>::ValueType;
+
+  explicit SharedFuture(Future<T> &&fut)
+      : state_(std::make_shared<SharedState>()) {
+    fut.then([state = state_](ValueType &&v) {
+      std::vector<Promise<T>> waiters;
+      {
+        std::lock_guard<std::mutex> lk(state->mutex_);
+        state->value_ = std::move(v);
+        state->ready_ = true;
+        waiters.swap(state->waiters_);
+      }
+      // 在锁外唤醒等待者，回调函数中可以再次调用 getFuture
+      for (auto &waiter : waiters)
+        waiter.setValue(ValueType(state->value_));
+    });
+  }
+
+  Future<T> getFuture() {
+    Promise<T> promise;
+    auto fut = promise.getFuture();
+    std::unique_lock<std::mutex> lk(state_->mutex_);
+    if (!state_->ready_) {
+      state_->waiters_.push_back(std::move(promise));
+      return fut;
+    }
+    lk.unlock();
+    // 结果就绪之后 value_ 不再修改，可以在锁外拷贝
+    promise.setValue(ValueType(state_->value_));
+    return fut;
+  }
+
+  bool isReady() const {
+    std::lock_guard<std::mutex> lk(state_->mutex_);
+    return state_->ready_;
+  }
+
+  /// @brief 等待结果的消费者数量，不包括结果就绪之后调用的 getFuture
+  size_t waiters() const {
+    std::lock_guard<std::mutex> lk(state_->mutex_);
+    return state_->waiters_.size();
+  }
+
+private:
+  struct SharedState {
+    mutable std::mutex mutex_;
+    bool ready_{false};
+    ValueType value_;
+    std::vector<Promise<T>> waiters_;
+  };
+
+  std::shared_ptr<SharedState> state_;
+};
+
 /// ---------------- when all ----------------
 /**
  * @brief when_all 语义形式 1
@@ -69,7 +69,7 @@ template <typename F, typename T> struct CallableResult {
   typedef Future<typename isReturnsFuture::Inner> returnFutureType;
 };
 
-template <typename F> struct CanCallWith<F, void> {
+template <typename F> struct CallableResult<F, void> {
   typedef typename std::conditional<
       CanCallWith<F>::value, ResultOfWrapper<F>,
       typename std::conditional<CanCallWith<F, Result<void> &&>::value,
@@ -65,12 +65,15 @@ void Connector::connect() {
   case ENOTSOCK:
     LOG_ERROR << "connect error in Connector::startInLoop " << savedErrno;
     sockets::close(sockfd);
+    if (connectErrorCallback_)
+      connectErrorCallback_();
     break;
 
   default:
     LOG_ERROR << "Unexpected error in Connector::startInLoop " << savedErrno;
     sockets::close(sockfd);
-    // connectErrorCallback_();
+    if (connectErrorCallback_)
+      connectErrorCallback_();
     break;
   }
 }
@@ -151,6 +154,8 @@ void Connector::handleError() {
 void Connector::retry(int sockfd) {
   sockets::close(sockfd);
   setState(States::kDisconnected);
+  if (connect_ && connectErrorCallback_)
+    connectErrorCallback_();
   if (connect_) {
     LOG_INFO << "Connector::retry - Retry connecting to "
              << serverAddr_.toHostPort() << " in " << retryDelayMs_
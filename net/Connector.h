@@ -16,6 +16,7 @@ class EventLoop;
 class Connector : public std::enable_shared_from_this<Connector> {
 public:
   using NewConnectionCallback = std::function<void(int sockfd)>;
+  using ConnectErrorCallback = std::function<void()>;
 
 private:
   enum class States {
@@ -43,6 +44,7 @@ private:
   States state_;
   std::unique_ptr<Channel> channel_;
   NewConnectionCallback newConnectionCallback_;
+  ConnectErrorCallback connectErrorCallback_;
   int retryDelayMs_;
   TimerId timerId_;
 
@@ -55,12 +57,18 @@ public:
   void setNewConnectionCallback(const NewConnectionCallback &cb) {
     newConnectionCallback_ = cb;
   }
+  /// 每次连接失败的时候调用，在回调中 stop() 可以停止重试
+  void setConnectErrorCallback(const ConnectErrorCallback &cb) {
+    connectErrorCallback_ = cb;
+  }
 
   void start();
   void restart();
   void stop();
 
   const InetAddress &serverAddress() const { return serverAddr_; }
+  bool connected() const { return state_ == States::kConnected; }
+  bool stopped() const { return !connect_; }
 };
 typedef std::shared_ptr<Connector> ConnectorPtr;
 
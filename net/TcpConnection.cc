@@ -4,7 +4,10 @@
 #include "Socket.h"
 #include "SocketsOps.h"
 #include "Logging.h"
+#include <algorithm>
 #include <cerrno>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
 #include <unistd.h>
 #include <cstdio>
 #include <string>
@@ -99,15 +102,18 @@ void TcpConnection::handleRead(Timestamp recieveTime) {
 void TcpConnection::handleWrite() {
   loop_->assertInLoopThread();
   if (channel_->isWriting()) {
+    if (!files_.empty()) {
+      writeSegments();
+      return;
+    }
     ssize_t n = ::write(channel_->fd(), outputBuffer_.peek(), outputBuffer_.readableBytes());
     if (n > 0) {
       outputBuffer_.retrieve(n);
+      bufferWritten_ += n;
       // 如果数据写完了，则需要关闭 kWriteEvent 事件，并执行 writeCompleteCallback_ 回调
       if (outputBuffer_.readableBytes() == 0) {
         channel_->disableWriting();
-        if (writeCompleteCallback_) {
-          loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
-        }
+        queueWriteComplete();
         if (state_ == StateE::kDisConnecting)
           shutdownInLoop();
       } else {
@@ -158,28 +164,77 @@ bool TcpConnection::send(const std::string &message) {
     if (loop_->isInLoopThread()) {
       sendInLoop(message);
     } else {
-      // message 会被移动到 std::bind 对象的成员变量中
-      loop_->runInLoop(std::bind(&TcpConnection::sendInLoop, this, std::move(message)));
+      // message 会被复制到 lambda 的成员变量中
+      loop_->runInLoop([this, message] { sendInLoop(message); });
     }
     return true;
   }
   return false;
 }
+/// 在非 IO 线程调用的时候，message 的内容被转移给 IO 线程，不会复制
 bool TcpConnection::send(Buffer &message) {
-  return send(message.retrieveAsString());
+  if (state_ == StateE::kConnected) {
+    if (loop_->isInLoopThread()) {
+      sendInLoop(message.peek(), message.readableBytes());
+      message.retrieveAll();
+    } else {
+      auto buf = std::make_shared<Buffer>();
+      buf->swap(message);
+      loop_->runInLoop([this, buf] {
+        sendInLoop(buf->peek(), buf->readableBytes());
+      });
+    }
+    return true;
+  }
+  return false;
 }
+
+bool TcpConnection::sendInPlace(const std::function<void(Buffer *)> &encode) {
+  loop_->assertInLoopThread();
+  if (state_ != StateE::kConnected)
+    return false;
+  const bool idle =
+      !channel_->isWriting() && outputBuffer_.readableBytes() == 0;
+  const size_t before = outputBuffer_.readableBytes();
+  encode(&outputBuffer_);
+  bufferAppended_ += outputBuffer_.readableBytes() - before;
+  // 之前没有等待发送的数据，尝试直接发送，剩下的数据等待 write 事件
+  if (idle && outputBuffer_.readableBytes() > 0) {
+    ssize_t nwrote = ::write(channel_->fd(), outputBuffer_.peek(),
+                             outputBuffer_.readableBytes());
+    if (nwrote >= 0) {
+      outputBuffer_.retrieve(nwrote);
+      bufferWritten_ += nwrote;
+      if (outputBuffer_.readableBytes() == 0) {
+        outputBuffer_.retrieveAll();
+        queueWriteComplete();
+      }
+    } else if (errno != EWOULDBLOCK) {
+      LOG_ERROR << "TcpConnection::sendInPlace";
+    }
+  }
+  if (outputBuffer_.readableBytes() > 0 && !channel_->isWriting())
+    channel_->enableWriting();
+  return true;
+}
+
 void TcpConnection::sendInLoop(const std::string &message) {
+  sendInLoop(message.data(), message.size());
+}
+
+void TcpConnection::sendInLoop(const void *data, size_t len) {
   loop_->assertInLoopThread();
+  const char *message = static_cast<const char *>(data);
   ssize_t nwrote = 0;
   // 如果没有等待发送的数据，尝试直接发送数据
   if (!channel_->isWriting() && outputBuffer_.readableBytes() == 0) {
-    nwrote = ::write(channel_->fd(), message.data(), message.size());
+    nwrote = ::write(channel_->fd(), message, len);
     if (nwrote >= 0) {
       // 数据没有发送完全
-      if (static_cast<size_t>(nwrote) < message.size()) {
+      if (static_cast<size_t>(nwrote) < len) {
         LOG_TRACE << "I am going to write more data";
-      } else if (writeCompleteCallback_) {
-        loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+      } else {
+        queueWriteComplete();
       }
     } else {
       nwrote = 0;
@@ -192,14 +247,119 @@ void TcpConnection::sendInLoop(const std::string &message) {
   assert(nwrote >= 0);
   // 数据没有发送完全，则先放到 outputBuffer_ 中，并监听 write 事件
   // 当 socket 变得可写的时候 Channel 会调用 TcpConnection::handleWrite()
-  if (static_cast<size_t>(nwrote) < message.size()) {
-    outputBuffer_.append(message.data() + nwrote, message.size() - nwrote);
+  if (static_cast<size_t>(nwrote) < len) {
+    outputBuffer_.append(message + nwrote, len - nwrote);
+    bufferAppended_ += len - nwrote;
     if (!channel_->isWriting()) {
       channel_->enableWriting();
     }
   }
 }
 
+void TcpConnection::runAfterDrained(std::function<void()> cb) {
+  loop_->assertInLoopThread();
+  if (!channel_->isWriting() && outputBuffer_.readableBytes() == 0) {
+    loop_->queueInLoop(std::move(cb));
+    return;
+  }
+  drainedCallbacks_.push_back(std::move(cb));
+}
+
+void TcpConnection::queueWriteComplete() {
+  if (writeCompleteCallback_)
+    loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+  if (!drainedCallbacks_.empty()) {
+    std::vector<std::function<void()>> callbacks;
+    callbacks.swap(drainedCallbacks_);
+    for (auto &cb : callbacks)
+      loop_->queueInLoop(std::move(cb));
+  }
+}
+
+bool TcpConnection::sendFile(int fd, off_t offset, size_t len,
+                             std::shared_ptr<void> owner) {
+  if (state_ != StateE::kConnected)
+    return false;
+  if (len == 0)
+    return true;
+  FileSegment segment{fd, offset, len, 0, std::move(owner)};
+  if (loop_->isInLoopThread()) {
+    sendFileInLoop(std::move(segment));
+  } else {
+    loop_->runInLoop([this, segment]() mutable {
+      sendFileInLoop(std::move(segment));
+    });
+  }
+  return true;
+}
+
+/// 文件段排在当前 outputBuffer_ 中所有数据之后. 有文件段等待发送的时候
+/// 一直观察 writable 事件，之后 send 的数据都追加到 outputBuffer_ 中
+void TcpConnection::sendFileInLoop(FileSegment segment) {
+  loop_->assertInLoopThread();
+  if (state_ != StateE::kConnected)
+    return;
+  segment.position = bufferAppended_;
+  files_.push_back(std::move(segment));
+  if (!channel_->isWriting())
+    writeSegments();
+}
+
+void TcpConnection::writeSegments() {
+  loop_->assertInLoopThread();
+  bool failed = false;
+  while (!failed) {
+    // 下一个文件段之前的 outputBuffer_ 数据
+    size_t limit = outputBuffer_.readableBytes();
+    if (!files_.empty())
+      limit = std::min<uint64_t>(limit, files_.front().position - bufferWritten_);
+    if (limit > 0) {
+      ssize_t n = ::write(channel_->fd(), outputBuffer_.peek(), limit);
+      if (n < 0) {
+        failed = errno != EWOULDBLOCK;
+        break;
+      }
+      outputBuffer_.retrieve(n);
+      bufferWritten_ += n;
+      if (static_cast<size_t>(n) < limit)
+        break;
+      continue;
+    }
+    if (files_.empty())
+      break;
+    FileSegment &segment = files_.front();
+    ssize_t n = ::sendfile(channel_->fd(), segment.fd, &segment.offset,
+                           segment.len);
+    if (n > 0) {
+      segment.len -= n;
+      if (segment.len > 0)
+        break;
+      files_.pop_front();
+    } else {
+      // n == 0 表示文件比声明的长度短，对端收到的 frame 已经不完整
+      failed = n == 0 || errno != EWOULDBLOCK;
+      break;
+    }
+  }
+  if (failed) {
+    LOG_ERROR << "TcpConnection::writeSegments";
+    // 输出流已经错位，关闭连接，由 handleRead / handleClose 清理
+    files_.clear();
+    outputBuffer_.retrieveAll();
+    ::shutdown(channel_->fd(), SHUT_RDWR);
+  }
+  if (files_.empty() && outputBuffer_.readableBytes() == 0) {
+    if (channel_->isWriting())
+      channel_->disableWriting();
+    if (!failed)
+      queueWriteComplete();
+    if (state_ == StateE::kDisConnecting)
+      shutdownInLoop();
+  } else if (!channel_->isWriting()) {
+    channel_->enableWriting();
+  }
+}
+
 void TcpConnection::setTcpNoDelay(bool on) {
   socket_->setTcpNoDelay(on);
 }
\ No newline at end of file
@@ -5,8 +5,12 @@
 #include "Callback.h"
 #include "EventLoop.h"
 #include "InetAddress.h"
+#include <deque>
+#include <functional>
 #include <memory>
 #include <string>
+#include <sys/types.h>
+#include <vector>
 
 namespace lrpc {
 namespace net {
@@ -33,7 +37,22 @@ private:
   void handleClose();
   void handleError();
 
+  // 等待用 sendfile 发送的文件段
+  struct FileSegment {
+    int fd;
+    off_t offset;
+    size_t len;
+    uint64_t position; // 排在输出流中 outputBuffer_ 的第 position 个字节之后
+    std::shared_ptr<void> owner;
+  };
+
   void sendInLoop(const std::string &message);
+  void sendInLoop(const void *data, size_t len);
+  void sendFileInLoop(FileSegment segment);
+  // 有文件段等待发送的时候，按照顺序交替发送 outputBuffer_ 和文件段
+  void writeSegments();
+  // 输出全部写到 socket 之后调用 writeCompleteCallback_ 和 drainedCallbacks_
+  void queueWriteComplete();
   void shutdownInLoop();
 
   EventLoop *loop_;
@@ -49,6 +68,10 @@ private:
   CloseCallback closeCallback_;
   Buffer inputBuffer_;
   Buffer outputBuffer_;
+  std::deque<FileSegment> files_;
+  uint64_t bufferAppended_{0}; // 累计追加到 outputBuffer_ 的字节数
+  uint64_t bufferWritten_{0};  // 累计从 outputBuffer_ 写到 socket 的字节数
+  std::vector<std::function<void()>> drainedCallbacks_;
 
   std::shared_ptr<void> context_; // 保存 RpcChannel
   unsigned int uniqueId_;
@@ -66,10 +89,25 @@ public:
   const InetAddress &localAddress() { return localAddr_; }
   const InetAddress &peerAddress() { return peerAddr_; }
   bool connected() const { return state_ == StateE::kConnected; }
+  /// 还没有写到 socket 中的数据量，只能在 loop 线程调用
+  size_t outputBytes() const { return outputBuffer_.readableBytes(); }
+  /// 还没有被 messageCallback_ 取走的数据，只能在 loop 线程调用
+  Buffer *inputBuffer() { return &inputBuffer_; }
 
   /// 这两个函数都是线程安全的
   bool send(const std::string &message);
   bool send(Buffer &message);
+  /// 只能在 loop 线程调用：encode 直接向发送缓冲区追加数据，然后尝试发送，
+  /// 省去先编码到临时缓冲区再拷贝的过程. encode 抛出异常的时候不能写入数据
+  bool sendInPlace(const std::function<void(Buffer *)> &encode);
+  /// 线程安全：在之前 send 的数据之后，用 sendfile 发送 fd 中
+  /// [offset, offset + len) 的内容，不经过用户态缓冲区，也不改变 fd 的文件偏移.
+  /// owner 在发送完成或者连接断开之前一直被持有，用来保证 fd 有效
+  bool sendFile(int fd, off_t offset, size_t len, std::shared_ptr<void> owner);
+  /// 只能在 loop 线程调用：等待发送的数据全部写到 socket 之后在 loop 中调用一次
+  /// cb，现在没有等待发送的数据的时候直接放入 loop 的队列. 和
+  /// writeCompleteCallback_ 不同，多个使用者可以同时等待
+  void runAfterDrained(std::function<void()> cb);
   void shutdown();
   void setTcpNoDelay(bool on); // 禁用 Nagle 算法，避免连续发包出现延迟
 
@@ -4,6 +4,7 @@
 #include "Timer.h"
 #include "TimerId.h"
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <sys/timerfd.h>
 #include <unistd.h>
@@ -152,8 +153,10 @@ void TimerQueue::handleRead() {
 std::vector<TimerQueue::Entry> TimerQueue::getExpired(Timestamp now) {
   std::vector<Entry> expired;
 
-  // 返回第一个未到期的 Timer 迭代器
-  Entry sentry = std::make_pair(now, nullptr);
+  // 返回第一个未到期的 Timer 迭代器. sentry 的指针取最大值，
+  // 到期时间恰好等于 now 的 Timer 也排在 sentry 之前
+  Entry sentry =
+      std::make_pair(now, reinterpret_cast<Timer *>(UINTPTR_MAX));
   auto it = timers_.lower_bound(sentry);
   assert(it == timers_.end() || now < it->first);
   // 将 [begin,it) 的元素移入 expired
@@ -0,0 +1,44 @@
+#include "Attachment.h"
+#include "EventLoop.h"
+#include "TcpConnection.h"
+#include <unistd.h>
+
+namespace lrpc {
+
+Attachment::File::~File() {
+  if (closeFd)
+    ::close(fd);
+}
+
+Attachment::Attachment(std::string &&data)
+    : data_(std::make_shared<const std::string>(std::move(data))),
+      size_(data_->size()) {}
+
+Attachment::Attachment(std::shared_ptr<const std::string> data)
+    : data_(std::move(data)), size_(data_ ? data_->size() : 0) {}
+
+Attachment Attachment::fromFile(int fd, off_t offset, size_t len,
+                                bool closeFd) {
+  Attachment attachment;
+  attachment.file_ = std::make_shared<File>(fd, closeFd);
+  attachment.offset_ = offset;
+  attachment.size_ = len;
+  return attachment;
+}
+
+std::string_view Attachment::view() const {
+  if (!data_)
+    return std::string_view();
+  return std::string_view(*data_);
+}
+
+bool Attachment::sendTo(const net::TcpConnectionPtr &conn) const {
+  conn->getLoop()->assertInLoopThread();
+  if (empty())
+    return true;
+  if (file_)
+    return conn->sendFile(file_->fd, offset_, size_, file_);
+  return conn->send(*data_);
+}
+
+} // namespace lrpc
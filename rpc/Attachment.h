@@ -0,0 +1,66 @@
+/**
+ * @file Attachment.h
+ * @brief 不经过 protobuf 编码的附件
+ *
+ * 附件跟在 request / response 的 protobuf 之后，在同一个 frame 中原样发送，
+ * 适合传输大块的二进制数据（文件、图片、模型参数等），避免序列化和解析的开销.
+ * 附件可以是内存中的数据，也可以是文件中的一段：文件附件用 sendfile 发送，
+ * 不经过用户态缓冲区. 接收到的附件总是内存附件，只在解码的时候从接收缓冲区
+ * 中拷贝一次. Attachment 拷贝的时候共享数据，不复制内容
+ */
+
+#ifndef LRPC_ATTACHMENT_H
+#define LRPC_ATTACHMENT_H
+
+#include "Callback.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+
+namespace lrpc {
+
+class Attachment {
+public:
+  Attachment() = default;
+  /// @brief 内存附件，接管 data 的内容
+  explicit Attachment(std::string &&data);
+  explicit Attachment(std::shared_ptr<const std::string> data);
+  /**
+   * @brief 文件附件，发送 fd 中 [offset, offset + len) 的内容.
+   * 发送的时候不改变 fd 的文件偏移；closeFd 为 true 的时候，最后一个引用
+   * 这个附件的 Attachment 和发送操作结束之后关闭 fd
+   */
+  static Attachment fromFile(int fd, off_t offset, size_t len,
+                             bool closeFd = false);
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  bool isFile() const { return file_ != nullptr; }
+  /// @brief 内存附件的内容，文件附件返回空的 string_view
+  std::string_view view() const;
+  /// @brief 共享内存附件的内容，文件附件返回 nullptr
+  const std::shared_ptr<const std::string> &data() const { return data_; }
+
+  /// @brief 把附件追加到连接的输出流中，只能在连接所属的 loop 线程调用
+  bool sendTo(const net::TcpConnectionPtr &conn) const;
+
+private:
+  struct File {
+    File(int f, bool c) : fd(f), closeFd(c) {}
+    File(const File &) = delete;
+    File &operator=(const File &) = delete;
+    ~File();
+    const int fd;
+    const bool closeFd;
+  };
+
+  std::shared_ptr<const std::string> data_;
+  std::shared_ptr<File> file_;
+  off_t offset_{0};
+  size_t size_{0};
+};
+
+} // namespace lrpc
+
+#endif
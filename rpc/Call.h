@@ -72,9 +72,9 @@ Future<Result<R>> _innerCallServer(ClientStub *stub, const std::string &method,
   auto channelFuture = stub->getChannel(ep);
   // ep 连接成功之后获取连接创建的 Channel，执行 invoke 发送 request 请求
   // 返回一个 Future<R>
-  return channelFuture.then([method, req](Result<ClientChannel *> &&chan) {
+  return channelFuture.then([method, req](Result<ClientChannelPtr> &&chan) {
     try {
-      ClientChannel *channel = chan.getValue();
+      ClientChannelPtr channel = chan.getValue();
       return channel->invoke<R>(method, req);
     } catch (...) {
       return makeExceptionFuture<Result<R>>(std::current_exception());
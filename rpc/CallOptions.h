@@ -0,0 +1,119 @@
+#ifndef LRPC_CALLOPTIONS_H
+#define LRPC_CALLOPTIONS_H
+
+#include "Attachment.h"
+#include "RpcException.h"
+#include "lrpc.pb.h"
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+
+namespace lrpc {
+
+/// @brief 没有指定超时时间的请求使用的默认超时时间
+constexpr std::chrono::milliseconds kDefaultCallTimeout(60 * 1000);
+
+/// @brief 优先级的处理顺序，越小越先处理，PRIORITY_DEFAULT 为 0
+inline int priorityRank(Priority priority) {
+  switch (priority) {
+  case PRIORITY_CONTROL:
+    return -2;
+  case PRIORITY_CRITICAL:
+    return -1;
+  case PRIORITY_BATCH:
+    return 1;
+  case PRIORITY_DEFAULT:
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief hedged request: 第一个请求在 delay 之内没有返回的时候，由负载均衡器
+ * 选择另一个 endpoint 再发送一次，使用先成功的结果，另一个请求的结果被忽略.
+ * 额外的请求受 ClientStub::setHedgeBudget 的全局预算限制，
+ * 只应该用于幂等的请求
+ */
+struct HedgePolicy {
+  bool enabled{false};
+  /// @brief 发送 hedge 请求之前等待的时间，0 表示使用 endpoint 延迟的
+  /// percentile 分位数
+  std::chrono::milliseconds delay{0};
+  double percentile{0.95};
+  /// @brief 根据分位数计算的等待时间的下限，endpoint 还没有延迟样本的时候使用
+  std::chrono::milliseconds minDelay{10};
+};
+
+/**
+ * @brief 请求失败之后的重试策略，只应该用于幂等的请求.
+ * 重试的请求由负载均衡器在其他 endpoint 中选择，第 n 次重试之前等待
+ * initialBackoff * multiplier^(n-1)（不超过 maxBackoff）的 [1/2, 1] 倍随机时间.
+ * 重试次数受 ClientStub::setRetryBudget 的全局预算限制，所有尝试共享
+ * CallOptions::timeout
+ */
+struct RetryPolicy {
+  /// @brief 最多尝试的次数（包括第一次），1 表示不重试
+  int maxAttempts{1};
+  std::chrono::milliseconds initialBackoff{20};
+  std::chrono::milliseconds maxBackoff{1000};
+  double multiplier{2.0};
+  /// @brief 超时的请求可能已经被服务端执行，默认不重试
+  bool retryOnTimeout{false};
+
+  /// @brief 连接相关的错误和服务端过载（请求没有执行）可以重试，
+  /// 服务端返回的其他错误不重试
+  bool retryable(const std::exception_ptr &e) const {
+    try {
+      std::rethrow_exception(e);
+    } catch (const std::system_error &err) {
+      if (err.code().category() != lrpcCategory())
+        return false;
+      switch (static_cast<ErrorCode>(err.code().value())) {
+      case ErrorCode::ConnectionLost:
+      case ErrorCode::ConnectionReset:
+      case ErrorCode::ConnectRefused:
+      case ErrorCode::NoAvailableEndpoint:
+      case ErrorCode::TooManyPendingCalls:
+      case ErrorCode::Overloaded:
+        return true;
+      case ErrorCode::Timeout:
+        return retryOnTimeout;
+      default:
+        return false;
+      }
+    } catch (...) {
+      return false;
+    }
+  }
+};
+
+/**
+ * @brief 单次 rpc call 的选项，作为 call<R>() 的可选参数
+ *
+ */
+struct CallOptions {
+  /// @brief 请求的超时时间，超时之后 future 会被设置为 Timeout 异常，
+  /// 0 表示使用 kDefaultCallTimeout
+  std::chrono::milliseconds timeout{0};
+  /// @brief 指定了 endpoint 的 call 不会发送 hedge 请求
+  HedgePolicy hedge;
+  RetryPolicy retry;
+  /// @brief 请求的优先级，handler 中发起的 PRIORITY_DEFAULT 嵌套调用继承
+  /// 上游请求的优先级
+  Priority priority{PRIORITY_DEFAULT};
+  /// @brief 请求的附件，跟在 request 之后原样发送，服务端通过
+  /// Controller::requestAttachment() 读取. 携带附件的请求不使用合并和缓存
+  Attachment attachment;
+  /// @brief 非空的时候，response 的附件在 future 完成之前保存到这里.
+  /// 设置之后不发送 hedge 请求，避免两个请求同时写入
+  std::shared_ptr<Attachment> responseAttachment;
+  /// @brief 没有指定 endpoint 的 call 按照这个 key 选择 endpoint（负载均衡
+  /// 策略需要支持 key，例如 ConsistentHash）. 为空的时候由 ClientStub 设置的
+  /// key 提取函数从 request 中获取
+  std::string routingKey;
+};
+
+} // namespace lrpc
+
+#endif
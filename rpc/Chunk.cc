@@ -0,0 +1,167 @@
+#include "Chunk.h"
+#include "Coder.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcException.h"
+#include <algorithm>
+
+namespace lrpc {
+
+const size_t kMaxChunkSize = 64 * 1024 * 1024;
+const size_t kMaxInterleaved = 4;
+
+ChunkWriter::ChunkWriter(std::weak_ptr<TcpConnection> conn, size_t chunkSize)
+    : conn_(std::move(conn)),
+      chunkSize_(std::min(std::max<size_t>(chunkSize, 1), kMaxChunkSize)) {}
+
+bool ChunkWriter::write(std::string &&message) {
+  auto conn = conn_.lock();
+  if (!conn || !conn->connected())
+    return false;
+  if (message.size() >= kMaxChunkedLen)
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal chunked message:" +
+                        std::to_string(message.size()));
+  transfers_.push_back(Transfer{nextId_++, std::move(message), 0});
+  _schedule(conn);
+  return true;
+}
+
+void ChunkWriter::_schedule(const TcpConnectionPtr &conn) {
+  if (scheduled_)
+    return;
+  scheduled_ = true;
+  std::weak_ptr<ChunkWriter> wself(shared_from_this());
+  conn->runAfterDrained([wself] {
+    if (auto self = wself.lock())
+      self->_pump();
+  });
+}
+
+void ChunkWriter::_pump() {
+  scheduled_ = false;
+  auto conn = conn_.lock();
+  if (!conn || !conn->connected()) {
+    transfers_.clear();
+    return;
+  }
+  if (transfers_.empty())
+    return;
+  // 在等待期间其他 frame 又写入了 outputBuffer，让它们先发送
+  if (conn->outputBytes() > 0) {
+    _schedule(conn);
+    return;
+  }
+  Transfer &t = transfers_.front();
+  const size_t len = std::min(chunkSize_, t.message.size() - t.offset);
+  const uint64_t totalLen = t.offset == 0 ? t.message.size() : 0;
+  conn->sendInPlace([&](Buffer *out) {
+    chunkBytesEncode(t.id, totalLen, t.message.data() + t.offset, len, out);
+  });
+  t.offset += len;
+  if (t.offset == t.message.size()) {
+    transfers_.pop_front();
+  } else if (transfers_.size() > 1) {
+    // 前 kMaxInterleaved 个分块消息轮流发送，其余的排队，
+    // 接收端同时组装的消息数因此有上限
+    const size_t n = std::min(transfers_.size(), kMaxInterleaved);
+    std::rotate(transfers_.begin(), transfers_.begin() + 1,
+                transfers_.begin() + n);
+  }
+  if (!transfers_.empty())
+    _schedule(conn);
+}
+
+ChunkAssembler::ChunkAssembler(EventLoop *loop, const ChunkLimits &limits)
+    : limits_(limits), state_(std::make_shared<State>()) {
+  state_->loop = loop;
+  state_->stallTimeout = limits.stallTimeout.count() / 1000.0;
+}
+
+std::shared_ptr<RpcMessage> ChunkAssembler::onChunk(ChunkFrame &frame) {
+  State &state = *state_;
+  auto it = state.partial.find(frame.id());
+  if (it == state.partial.end()) {
+    // 第一个 chunk 携带完整消息的长度，只用来检查限制，不按照它分配内存
+    const uint64_t totalLen = frame.total_len();
+    if (totalLen == 0)
+      throw Exception(ErrorCode::DecodeFail,
+                      "unknown chunk " + std::to_string(frame.id()));
+    if (totalLen > limits_.maxMessageSize || totalLen >= kMaxChunkedLen)
+      throw Exception(ErrorCode::TooLongFrame,
+                      "abnormal chunked message:" + std::to_string(totalLen));
+    if (state.partial.size() >= limits_.maxPartials ||
+        state.totalBytes + totalLen > limits_.maxPendingBytes)
+      throw Exception(ErrorCode::TooLongFrame,
+                      "too many chunked messages:" +
+                          std::to_string(state.partial.size()) + ", " +
+                          std::to_string(state.totalBytes + totalLen));
+    it = state.partial
+             .emplace(frame.id(), Partial{std::string(), totalLen, Timestamp()})
+             .first;
+    state.totalBytes += totalLen;
+    if (!state.sweeping && state.stallTimeout > 0)
+      _scheduleSweep(state_, state.stallTimeout);
+  } else if (frame.total_len() != 0) {
+    throw Exception(ErrorCode::DecodeFail,
+                    "duplicated chunk " + std::to_string(frame.id()));
+  }
+  Partial &partial = it->second;
+  if (partial.data.size() + frame.data().size() > partial.totalLen)
+    throw Exception(ErrorCode::DecodeFail,
+                    "chunk overflow " + std::to_string(frame.id()));
+  partial.lastChunk = Timestamp::now();
+  state.bytes += frame.data().size();
+  if (partial.data.empty())
+    partial.data.swap(*frame.mutable_data());
+  else
+    partial.data.append(frame.data());
+  if (partial.data.size() < partial.totalLen)
+    return nullptr;
+
+  auto message = std::make_shared<RpcMessage>();
+  const bool ok = message->ParseFromString(partial.data);
+  _erase(state, it);
+  if (!ok || message->has_chunk())
+    throw Exception(ErrorCode::DecodeFail, "chunked message ParseFromString failed");
+  return message;
+}
+
+void ChunkAssembler::_erase(State &state, PartialMap::iterator it) {
+  state.bytes -= it->second.data.size();
+  state.totalBytes -= it->second.totalLen;
+  state.partial.erase(it);
+}
+
+void ChunkAssembler::_scheduleSweep(const std::shared_ptr<State> &state,
+                                    double delay) {
+  state->sweeping = true;
+  std::weak_ptr<State> wstate(state);
+  state->loop->runAfter(delay, [wstate] {
+    if (auto state = wstate.lock())
+      _sweep(state);
+  });
+}
+
+void ChunkAssembler::_sweep(const std::shared_ptr<State> &state) {
+  state->sweeping = false;
+  const Timestamp now = Timestamp::now();
+  double next = 0; // 下一个可能停滞的消息还要等待的时间
+  for (auto it = state->partial.begin(); it != state->partial.end();) {
+    const double idle = timeDifference(now, it->second.lastChunk);
+    if (idle >= state->stallTimeout) {
+      LOG_WARN << "drop stalled chunked message " << it->first << ", received "
+               << it->second.data.size() << " of " << it->second.totalLen;
+      _erase(*state, it++);
+    } else {
+      const double left = state->stallTimeout - idle;
+      if (next == 0 || left < next)
+        next = left;
+      ++it;
+    }
+  }
+  if (!state->partial.empty())
+    _scheduleSweep(state, next);
+}
+
+} // namespace lrpc
@@ -0,0 +1,121 @@
+/**
+ * @file Chunk.h
+ * @brief 超大消息的分块传输
+ *
+ * 序列化之后超过 chunkSize 的 request / response 不作为一个 frame 发送，
+ * 而是切分成多个 ChunkFrame:
+ * 1. 发送端的 ChunkWriter 只在连接的 outputBuffer 为空的时候发送下一个 chunk，
+ *    其他请求的 frame 最多等待一个 chunk；最多 kMaxInterleaved 个分块消息
+ *    轮流发送
+ * 2. 接收端的 ChunkAssembler 随着 chunk 的到达逐个追加，内存按照实际收到的
+ *    数据增长，不按照对端声明的长度预先分配. 消息长度、同时组装的消息数和
+ *    声明的长度之和受 ChunkLimits 限制，长时间没有新 chunk 的消息被丢弃
+ * 组装完成的消息按照普通的 frame 处理，不受 frame 长度上限的限制.
+ * 两个类都只在连接所属的 loop 中使用
+ */
+
+#ifndef LRPC_CHUNK_H
+#define LRPC_CHUNK_H
+
+#include "TcpConnection.h"
+#include "Timestamp.h"
+#include "lrpc.pb.h"
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace lrpc {
+
+using namespace net;
+
+/// @brief setChunkSize 允许的最大 chunk 大小
+extern const size_t kMaxChunkSize;
+/// @brief 发送端同时轮流发送的分块消息数
+extern const size_t kMaxInterleaved;
+
+/// @brief 接收端组装分块消息的限制，每个连接单独计算
+struct ChunkLimits {
+  /// 组装之后的消息的最大长度，默认和普通 frame 的长度上限相同
+  size_t maxMessageSize{256 * 1024 * 1024};
+  /// 同时在组装的消息数，不能小于 kMaxInterleaved
+  size_t maxPartials{16};
+  /// 正在组装的消息声明的长度之和
+  size_t maxPendingBytes{1024 * 1024 * 1024};
+  /// 超过这个时间没有收到新的 chunk 的消息被丢弃
+  std::chrono::milliseconds stallTimeout{30000};
+};
+
+class ChunkWriter : public std::enable_shared_from_this<ChunkWriter> {
+public:
+  ChunkWriter(std::weak_ptr<TcpConnection> conn, size_t chunkSize);
+
+  /// @brief 分块发送序列化之后的 RpcMessage，连接已经断开的时候返回 false
+  bool write(std::string &&message);
+  /// @brief 还没有发送完的消息数
+  size_t pending() const { return transfers_.size(); }
+
+private:
+  struct Transfer {
+    uint32_t id;
+    std::string message;
+    size_t offset; // 已经发送的字节数
+  };
+
+  // 发送一个 chunk，然后等待连接的输出写完之后再发送下一个
+  void _pump();
+  void _schedule(const TcpConnectionPtr &conn);
+
+  std::weak_ptr<TcpConnection> conn_;
+  const size_t chunkSize_;
+  std::deque<Transfer> transfers_;
+  uint32_t nextId_{0};
+  bool scheduled_{false};
+};
+
+class ChunkAssembler {
+public:
+  ChunkAssembler(EventLoop *loop, const ChunkLimits &limits);
+
+  /**
+   * @brief 收到一个 chunk
+   *
+   * @return 消息组装完成的时候返回解码之后的 RpcMessage，否则返回 nullptr.
+   * chunk 不合法的时候抛出 DecodeFail，超过 ChunkLimits 的时候抛出 TooLongFrame
+   */
+  std::shared_ptr<RpcMessage> onChunk(ChunkFrame &frame);
+  /// @brief 正在组装的消息已经收到的字节数
+  size_t bytes() const { return state_->bytes; }
+  /// @brief 正在组装的消息数
+  size_t partials() const { return state_->partial.size(); }
+
+private:
+  struct Partial {
+    std::string data;
+    size_t totalLen;
+    Timestamp lastChunk; // 最近一个 chunk 到达的时间
+  };
+  // 定时器通过 weak_ptr 访问，连接销毁之后定时器不做任何事情
+  struct State {
+    EventLoop *loop;
+    double stallTimeout; // 秒
+    std::unordered_map<uint32_t, Partial> partial;
+    size_t bytes{0};      // 已经收到的字节数
+    size_t totalBytes{0}; // 声明的长度之和
+    bool sweeping{false};
+  };
+  using PartialMap = std::unordered_map<uint32_t, Partial>;
+
+  static void _erase(State &state, PartialMap::iterator it);
+  // 在 delay 秒之后丢弃停滞的消息
+  static void _scheduleSweep(const std::shared_ptr<State> &state, double delay);
+  static void _sweep(const std::shared_ptr<State> &state);
+
+  const ChunkLimits limits_;
+  std::shared_ptr<State> state_;
+};
+
+} // namespace lrpc
+
+#endif
@@ -0,0 +1,136 @@
+#include "CircuitBreaker.h"
+#include "Logging.h"
+#include <algorithm>
+
+namespace lrpc {
+
+CircuitBreaker::CircuitBreaker(const std::string &name,
+                               const CircuitBreakerOptions &options,
+                               std::atomic<int> *ejected,
+                               std::atomic<uint64_t> *transitions)
+    : name_(name), options_(options), ejected_(ejected),
+      transitions_(transitions), windowStart_(Timestamp::now()) {}
+
+bool CircuitBreaker::available(Timestamp now) const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  switch (state_) {
+  case State::Closed:
+    return true;
+  case State::Open:
+    return !(now < openUntil_);
+  case State::HalfOpen:
+    return probes_ < options_.halfOpenProbes || _expired(now);
+  }
+  return true;
+}
+
+bool CircuitBreaker::tryAcquire(Timestamp now) {
+  std::lock_guard<std::mutex> lk(mutex_);
+  switch (state_) {
+  case State::Closed:
+    return true;
+  case State::Open:
+    if (now < openUntil_)
+      return false;
+    state_ = State::HalfOpen;
+    probes_ = 0;
+    transitions_->fetch_add(1, std::memory_order_release);
+    break;
+  case State::HalfOpen:
+    // 试探请求没有结果（例如没有真正发送），超时之后允许新的试探
+    if (_expired(now))
+      probes_ = 0;
+    break;
+  }
+  if (probes_ >= options_.halfOpenProbes)
+    return false;
+  ++probes_;
+  probeStart_ = now;
+  return true;
+}
+
+void CircuitBreaker::onResult(bool ok, Timestamp now) {
+  if (!options_.enabled)
+    return;
+  std::lock_guard<std::mutex> lk(mutex_);
+  if (state_ == State::HalfOpen) {
+    if (ok)
+      _close();
+    else
+      _open(now);
+    return;
+  }
+  if (state_ == State::Open)
+    return;
+  if (timeDifference(now, windowStart_) * 1000 > options_.window.count()) {
+    windowStart_ = now;
+    windowRequests_ = 0;
+    windowFailures_ = 0;
+  }
+  ++windowRequests_;
+  if (ok) {
+    consecutiveFailures_ = 0;
+    ejections_ = 0;
+    return;
+  }
+  ++windowFailures_;
+  ++consecutiveFailures_;
+  if (consecutiveFailures_ >= options_.consecutiveFailures ||
+      (windowRequests_ >= options_.minRequests &&
+       windowFailures_ > options_.errorRate * windowRequests_))
+    _open(now);
+}
+
+bool CircuitBreaker::eject(Timestamp now) {
+  if (!options_.enabled)
+    return false;
+  std::lock_guard<std::mutex> lk(mutex_);
+  if (state_ != State::Closed)
+    return false;
+  _open(now);
+  return true;
+}
+
+CircuitBreaker::State CircuitBreaker::state() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return state_;
+}
+
+Timestamp CircuitBreaker::openUntil() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return openUntil_;
+}
+
+bool CircuitBreaker::_expired(Timestamp now) const {
+  return timeDifference(now, probeStart_) * 1000 >
+         options_.baseEjection.count();
+}
+
+void CircuitBreaker::_open(Timestamp now) {
+  if (state_ == State::Closed)
+    ejected_->fetch_add(1, std::memory_order_relaxed);
+  state_ = State::Open;
+  ++ejections_;
+  const int64_t ms = std::min<int64_t>(
+      options_.baseEjection.count() * ejections_, options_.maxEjection.count());
+  openUntil_ = addTime(now, ms / 1000.0);
+  probes_ = 0;
+  transitions_->fetch_add(1, std::memory_order_release);
+  LOG_WARN << "endpoint " << name_ << " ejected for " << ms << "ms, consecutive failures "
+           << consecutiveFailures_ << ", window " << windowFailures_ << "/"
+           << windowRequests_;
+}
+
+void CircuitBreaker::_close() {
+  if (state_ != State::Closed)
+    ejected_->fetch_sub(1, std::memory_order_relaxed);
+  LOG_INFO << "endpoint " << name_ << " readmitted";
+  state_ = State::Closed;
+  consecutiveFailures_ = 0;
+  windowRequests_ = 0;
+  windowFailures_ = 0;
+  probes_ = 0;
+  transitions_->fetch_add(1, std::memory_order_release);
+}
+
+} // namespace lrpc
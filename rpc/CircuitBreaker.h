@@ -0,0 +1,97 @@
+/**
+ * @file CircuitBreaker.h
+ * @brief endpoint 的熔断和异常剔除
+ *
+ * 每个 endpoint 有一个 CircuitBreaker，状态转换:
+ * 1. Closed: 正常状态. 连续失败次数、窗口内的错误率超过阈值，或者延迟明显高于
+ *    其他 endpoint（由 EndpointStatsTable::detectOutliers 判断）的时候进入 Open
+ * 2. Open: endpoint 被剔除，负载均衡不会选择它. 剔除时间为
+ *    baseEjection * 被剔除的次数（不超过 maxEjection）
+ * 3. HalfOpen: 剔除时间结束之后，允许 halfOpenProbes 个试探请求，
+ *    试探成功回到 Closed，失败重新进入 Open
+ */
+
+#ifndef LRPC_CIRCUITBREAKER_H
+#define LRPC_CIRCUITBREAKER_H
+
+#include "Timestamp.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace lrpc {
+
+using lrpc::util::Timestamp;
+
+struct CircuitBreakerOptions {
+  bool enabled{true};
+  /// @brief 连续失败多少次之后剔除
+  int consecutiveFailures{5};
+  /// @brief 窗口内请求数不少于 minRequests 并且错误率超过 errorRate 的时候剔除
+  double errorRate{0.5};
+  int minRequests{20};
+  std::chrono::milliseconds window{10000};
+  /// @brief peak-EWMA 延迟超过所有 endpoint 中位数的 latencyFactor 倍，
+  /// 并且超过 minOutlierLatency 的时候剔除
+  double latencyFactor{5};
+  std::chrono::milliseconds minOutlierLatency{10};
+  std::chrono::milliseconds outlierInterval{1000}; // 检查延迟的间隔
+  std::chrono::milliseconds baseEjection{5000};
+  std::chrono::milliseconds maxEjection{60000};
+  /// @brief 可用的 endpoint 少于 (100 - maxEjectionPercent)% 的时候忽略熔断，
+  /// 所有 endpoint 都参与负载均衡
+  int maxEjectionPercent{50};
+  int halfOpenProbes{1};
+};
+
+/// @brief 一个 endpoint 的熔断状态，所有成员函数都是线程安全的
+class CircuitBreaker {
+public:
+  enum class State { Closed, Open, HalfOpen };
+
+  /// @param name endpoint 的地址，用于日志
+  /// @param ejected 所属 EndpointStatsTable 中不是 Closed 状态的 endpoint 数量
+  /// @param transitions 所属 EndpointStatsTable 的状态转换计数，每次状态
+  /// 改变的时候加一，EndpointSet 据此判断缓存的可用列表是否过期
+  CircuitBreaker(const std::string &name, const CircuitBreakerOptions &options,
+                 std::atomic<int> *ejected,
+                 std::atomic<uint64_t> *transitions);
+
+  /// @brief 负载均衡是否可以选择这个 endpoint
+  bool available(Timestamp now) const;
+  /// @brief 选中之后调用，HalfOpen 状态下占用一个试探名额，名额用完返回 false
+  bool tryAcquire(Timestamp now);
+  /// @brief 请求完成
+  void onResult(bool ok, Timestamp now);
+  /// @brief 延迟异常，Closed 状态下剔除，返回是否剔除
+  bool eject(Timestamp now);
+
+  State state() const;
+  /// @brief Open 状态结束的时间
+  Timestamp openUntil() const;
+
+private:
+  bool _expired(Timestamp now) const;
+  void _open(Timestamp now);
+  void _close();
+
+  const std::string name_;
+  const CircuitBreakerOptions options_;
+  std::atomic<int> *const ejected_;
+  std::atomic<uint64_t> *const transitions_;
+  mutable std::mutex mutex_;
+  State state_{State::Closed};
+  int consecutiveFailures_{0};
+  int windowRequests_{0};
+  int windowFailures_{0};
+  Timestamp windowStart_;
+  int ejections_{0};    // 连续被剔除的次数
+  Timestamp openUntil_; // Open 状态结束的时间
+  int probes_{0};       // HalfOpen 状态下正在进行的试探请求
+  Timestamp probeStart_;
+};
+
+} // namespace lrpc
+
+#endif
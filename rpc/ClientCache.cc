@@ -0,0 +1,69 @@
+#include "ClientCache.h"
+
+namespace lrpc {
+
+// 每个 entry 除了 key 和 response 之外的内存开销估计
+static const size_t kEntryOverhead = 128;
+
+ClientCache::ClientCache(size_t maxBytes) : maxBytes_(maxBytes) {}
+
+void ClientCache::_erase(EntryList::iterator it) {
+  bytes_ -= it->bytes;
+  index_.erase(std::string_view(it->key));
+  lru_.erase(it);
+}
+
+ClientCache::State ClientCache::get(const std::string &key, Timestamp now,
+                                    std::shared_ptr<const void> *value,
+                                    bool *refresh) {
+  *refresh = false;
+  auto it = index_.find(std::string_view(key));
+  if (it == index_.end()) {
+    ++misses_;
+    return State::Miss;
+  }
+  auto entry = it->second;
+  if (!(now < entry->stale)) {
+    _erase(entry);
+    ++misses_;
+    return State::Miss;
+  }
+  lru_.splice(lru_.begin(), lru_, entry);
+  *value = entry->value;
+  if (now < entry->fresh) {
+    ++hits_;
+    return State::Fresh;
+  }
+  ++staleHits_;
+  if (!entry->refreshing) {
+    entry->refreshing = true;
+    *refresh = true;
+  }
+  return State::Stale;
+}
+
+void ClientCache::put(const std::string &key, std::shared_ptr<const void> value,
+                      size_t bytes, const CachePolicy &policy, Timestamp now) {
+  bytes += key.size() + kEntryOverhead;
+  auto it = index_.find(std::string_view(key));
+  if (it != index_.end())
+    _erase(it->second);
+  if (bytes > maxBytes_)
+    return;
+  while (!lru_.empty() && bytes_ + bytes > maxBytes_)
+    _erase(std::prev(lru_.end()));
+  const Timestamp fresh = addTime(now, policy.ttl.count() / 1000.0);
+  const Timestamp stale =
+      addTime(fresh, policy.staleWhileRevalidate.count() / 1000.0);
+  lru_.push_front(Entry{key, std::move(value), fresh, stale, bytes, false});
+  index_.emplace(std::string_view(lru_.front().key), lru_.begin());
+  bytes_ += bytes;
+}
+
+void ClientCache::refreshFailed(const std::string &key) {
+  auto it = index_.find(std::string_view(key));
+  if (it != index_.end())
+    it->second->refreshing = false;
+}
+
+} // namespace lrpc
@@ -0,0 +1,87 @@
+/**
+ * @file ClientCache.h
+ * @brief 客户端可缓存 method 的 response 缓存
+ *
+ * 每个 loop 一个 ClientCache，只在所属的 loop 线程中使用，因此不需要加锁.
+ * key 由 method、response 类型和序列化之后的 request 组成，value 是解码之后的
+ * response. entry 在 ttl 之内是新鲜的；之后的 staleWhileRevalidate 时间内是
+ * 陈旧的，仍然返回给调用者，同时由一个后台请求刷新
+ */
+
+#ifndef LRPC_CLIENTCACHE_H
+#define LRPC_CLIENTCACHE_H
+
+#include "Timestamp.h"
+#include <chrono>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace lrpc {
+
+using lrpc::util::Timestamp;
+
+/// @brief 可缓存 method 的缓存时间
+struct CachePolicy {
+  std::chrono::milliseconds ttl{0};
+  /// @brief ttl 之后还可以返回陈旧结果的时间，0 表示过期之后立即失效
+  std::chrono::milliseconds staleWhileRevalidate{0};
+};
+
+class ClientCache {
+public:
+  enum class State {
+    Miss,  ///< 没有或者已经失效
+    Fresh, ///< 在 ttl 之内
+    Stale, ///< 在 staleWhileRevalidate 之内
+  };
+
+  explicit ClientCache(size_t maxBytes);
+
+  /**
+   * @brief 查找 key 对应的 response
+   *
+   * @param value 命中的时候设置为缓存的 response
+   * @param refresh Stale 的时候，如果 key 没有正在执行的刷新则设置为 true，
+   * 调用者需要发起刷新并在完成之后调用 put 或者 refreshFailed
+   */
+  State get(const std::string &key, Timestamp now,
+            std::shared_ptr<const void> *value, bool *refresh);
+  /// @brief bytes 是 response 占用内存的估计值
+  void put(const std::string &key, std::shared_ptr<const void> value,
+           size_t bytes, const CachePolicy &policy, Timestamp now);
+  /// @brief 刷新失败，之后的 get 可以再次发起刷新
+  void refreshFailed(const std::string &key);
+
+  int64_t hits() const { return hits_; }
+  int64_t staleHits() const { return staleHits_; }
+  int64_t misses() const { return misses_; }
+
+private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const void> value;
+    Timestamp fresh; // 在此之前是新鲜的
+    Timestamp stale; // 在此之前可以返回陈旧结果
+    size_t bytes;
+    bool refreshing;
+  };
+  using EntryList = std::list<Entry>;
+
+  void _erase(EntryList::iterator it);
+
+  const size_t maxBytes_;
+  size_t bytes_{0};
+  EntryList lru_; // 最近使用的在前面
+  // key 指向 lru_ 中 Entry 的 key，查找的时候不需要拷贝
+  std::unordered_map<std::string_view, EntryList::iterator> index_;
+  int64_t hits_{0};
+  int64_t staleHits_{0};
+  int64_t misses_{0};
+};
+
+} // namespace lrpc
+
+#endif
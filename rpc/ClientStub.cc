@@ -4,13 +4,15 @@
 // #include "RpcClient.h"
 #include "Server.h"
 #include "util.h"
+#include <algorithm>
 #include <iostream>
 
 // TODO 修改回来：RPC_SERVER -> RPC_CLIENT
 
 namespace lrpc {
 
-ClientStub::ClientStub(GoogleService *service) {
+ClientStub::ClientStub(GoogleService *service)
+    : balancer_(makeLoadBalancer(LoadBalanceType::RoundRobin)) {
   // 每个 ClientStub 对应一个 service
   service_.reset(service);
   name_ = service_->GetDescriptor()->full_name();
@@ -36,20 +38,25 @@ void ClientStub::setUrlLists(const std::string &serviceUrls) {
 }
 
 /**
- * @brief 连接 service endpoint，返回 Future<ClientChannel *>
+ * @brief 连接 service endpoint，返回 Future<ClientChannelPtr>
  * 版本 1: 没有指定 service 特定的 endpoint，则会首先去获取 ep
  * 版本 2: 指定 endpoint，如果 ep 有效则直接使用，否则调用版本 1
  *
- * @return Future<ClientChannel *>
+ * @return Future<ClientChannelPtr>
  */
-Future<ClientChannel *> ClientStub::getChannel() {
+/// @brief 选择一个 EventLoop 处理连接的后续消息等事件
+EventLoop *ClientStub::callerLoop() {
   auto loop = EventLoop::getEventLoopOfCurrentThread();
-  // 选择一个 EventLoop 处理连接的后续消息等事件
   if (!loop || loop == RPC_SERVER.baseLoop())
     loop = RPC_SERVER.next();
+  return loop;
+}
+
+Future<ClientChannelPtr> ClientStub::getChannel() {
+  auto loop = callerLoop();
   // 获取 ClientStub 对应的 service 的 endpoints，获取之后执行回调函数 func.
   // func 绑定 _selectChannel，用来选择其中一个 endpoints，并发起连接
-  // 返回一个等待连接创建成功的 Future<ClientChannel *>
+  // 返回一个等待连接创建成功的 Future<ClientChannelPtr>
   auto func =
       std::bind(&ClientStub::_selectChannel, this, loop, std::placeholders::_1);
   if (loop->isInLoopThread())
@@ -57,11 +64,9 @@ Future<ClientChannel *> ClientStub::getChannel() {
   else
     return _getEndpoints().then(loop, std::move(func));
 }
-Future<ClientChannel *> ClientStub::getChannel(const Endpoint &ep) {
+Future<ClientChannelPtr> ClientStub::getChannel(const Endpoint &ep) {
   if (isValidEndpoint(ep)) {
-    auto loop = EventLoop::getEventLoopOfCurrentThread();
-    if (!loop || loop == RPC_SERVER.baseLoop())
-      loop = RPC_SERVER.next();
+    auto loop = callerLoop();
     if (loop->isInLoopThread())
       return _makeChannel(loop, ep);
     else
@@ -72,6 +77,55 @@ Future<ClientChannel *> ClientStub::getChannel(const Endpoint &ep) {
   }
 }
 
+Future<ClientChannelPtr>
+ClientStub::getChannel(const Endpoint &ep, const std::string &routingKey) {
+  if (isValidEndpoint(ep) || routingKey.empty())
+    return getChannel(ep);
+  auto loop = callerLoop();
+  auto func = [this, loop, routingKey](Result<EndpointsPtr> &&eps) {
+    try {
+      return _makeChannel(loop, _selectEndpoint(eps.getValue(), routingKey));
+    } catch (...) {
+      return makeExceptionFuture<ClientChannelPtr>(std::current_exception());
+    }
+  };
+  if (loop->isInLoopThread())
+    return _getEndpoints().then(std::move(func));
+  else
+    return _getEndpoints().then(loop, std::move(func));
+}
+
+Future<ClientChannelPtr>
+ClientStub::getChannelExcept(const Endpoint &ep,
+                             const std::string &routingKey) {
+  auto loop = callerLoop();
+  auto func = [this, loop, ep, routingKey](Result<EndpointsPtr> &&eps) {
+    try {
+      return _makeChannel(loop,
+                          _selectEndpoint(eps.getValue(), routingKey, &ep));
+    } catch (...) {
+      return makeExceptionFuture<ClientChannelPtr>(std::current_exception());
+    }
+  };
+  if (loop->isInLoopThread())
+    return _getEndpoints().then(std::move(func));
+  else
+    return _getEndpoints().then(loop, std::move(func));
+}
+
+Future<Endpoint> ClientStub::selectEndpoint(const Endpoint &exclude,
+                                            const std::string &routingKey) {
+  return _getEndpoints().then(
+      [this, exclude, routingKey](Result<EndpointsPtr> &&eps) {
+        const EndpointsPtr &all = eps.getValue();
+        Endpoint ep = _selectEndpoint(all, routingKey, &exclude);
+        // 只有 exclude 一个 endpoint 的时候仍然选择它
+        if (!isValidEndpoint(ep))
+          ep = _selectEndpoint(all, routingKey);
+        return ep;
+      });
+}
+
 /// @brief 请求 nameserver 获取 service 的 endpoints
 Future<ClientStub::EndpointsPtr> ClientStub::_getEndpoints() {
   if (hardCodedUrls_ && !hardCodedUrls_->empty())
@@ -108,7 +162,9 @@ Future<ClientStub::EndpointsPtr> ClientStub::_getEndpoints() {
     assert(scheduler);
     // 向 name service 发起 GetEndpoints 请求，设置回调函数为 _onNewEndpointList
     // 设置超时时间为 2s，超时回调函数
-    lrpc::call<EndpointList>("lrpc.NameService", "GetEndpoints", name)
+    CallOptions options;
+    options.priority = PRIORITY_CONTROL;
+    lrpc::call<EndpointList>("lrpc.NameService", "GetEndpoints", name, options)
         .then(scheduler, std::bind(&ClientStub::_onNewEndpointList, this,
                                    std::placeholders::_1))
         .onTimeout(
@@ -170,57 +226,212 @@ void ClientStub::_onNewEndpointList(Result<EndpointList> &&endpoints) {
 }
 
 /// @brief 根据负载均衡策略选择一个 Endpoint，并发起连接
-Future<ClientChannel *> ClientStub::_selectChannel(EventLoop *loop,
+Future<ClientChannelPtr> ClientStub::_selectChannel(EventLoop *loop,
                                                    Result<EndpointsPtr> &&eps) {
   assert(loop->isInLoopThread());
   try {
     return _makeChannel(loop, _selectEndpoint(eps));
   } catch (...) {
-    return makeExceptionFuture<ClientChannel *>(std::current_exception());
+    return makeExceptionFuture<ClientChannelPtr>(std::current_exception());
   }
 }
 
-/// @brief 获取 service 对应的 channel，返回 Future<ClientChannel *>，
+/// @brief 获取 service 对应的 channel，返回 Future<ClientChannelPtr>，
 /// 等待连接建立成功，ClientChannel 被创建好
-Future<ClientChannel *> ClientStub::_makeChannel(EventLoop *loop,
+Future<ClientChannelPtr> ClientStub::_makeChannel(EventLoop *loop,
                                                  const Endpoint &ep) {
   LOG_INFO << "make channel";
   assert(loop->isInLoopThread());
   // service 没有 endpoint，返回一个异常 future
   if (!isValidEndpoint(ep))
-    return makeExceptionFuture<ClientChannel *>(
+    return makeExceptionFuture<ClientChannelPtr>(
         Exception(ErrorCode::NoAvailableEndpoint, fullName()));
+  if (_isGlobal())
+    return _makeGlobalChannel(ep);
   // service 存在有效的 endpoint: 说明之前客户端已经对这个服务发起过连接了，
   // 并且现在连接已经被创建好了，此时直接返回 ready future，设置之前创建的
   // ClientChannel. 否则的话就尝试去连接 service
   const auto &channels = channels_[loop->getId()];
   auto it = channels.find(ep);
-  if (it != channels.end()) {
-    return makeReadyFuture(it->second.get());
+  if (it != channels.end() && !it->second.empty()) {
+    ClientChannelPtr best = _leastOutstanding(it->second);
+    // 所有连接都在忙，并且没有达到上限，在后台增加一个连接
+    if (best->outstanding() > 0 && it->second.size() < _maxConnections() &&
+        !pendingConns_[loop->getId()].count(getAddrFromEndpoint(ep)))
+      _connect(loop, ep);
+    return makeReadyFuture(best);
   }
   LOG_INFO << std::this_thread::get_id() << ", need connect";
   return _connect(loop, ep);
 }
 
-/// @brief 默认负载均衡策略 round-robin
-const Endpoint &ClientStub::_selectEndpoint(EndpointsPtr eps) {
+/// @brief 连接分布在不同的 loop 上，返回的 channel 可能属于其他 loop,
+/// ClientChannel::invoke 会把请求提交到 channel 所属的 loop
+Future<ClientChannelPtr> ClientStub::_makeGlobalChannel(const Endpoint &ep) {
+  std::unique_lock<std::mutex> lk(globalMutex_);
+  const auto &channels = globalChannels_[ep];
+  ClientChannelPtr best =
+      channels.empty() ? nullptr : _leastOutstanding(channels);
+  size_t &connecting = globalConnecting_[ep];
+  const bool grow = channels.size() + connecting < _maxConnections() &&
+                    (!best || best->outstanding() > 0);
+  Future<ClientChannelPtr> fut;
+  if (best) {
+    fut = makeReadyFuture(best);
+  } else {
+    // 还没有可用的连接，等待正在建立的连接
+    globalWaiters_[ep].emplace_back();
+    fut = globalWaiters_[ep].back().getFuture();
+  }
+  if (grow) {
+    ++connecting;
+    lk.unlock();
+    // 新的连接轮流分配给各个 loop
+    RPC_SERVER.connect(
+        getAddrFromEndpoint(ep),
+        std::bind(&ClientStub::_onNewConnection, this, std::placeholders::_1),
+        std::bind(&ClientStub::_onConnFail, this, std::placeholders::_1,
+                  std::placeholders::_2),
+        std::chrono::milliseconds(3000), RPC_SERVER.next());
+  }
+  return fut;
+}
+
+size_t ClientStub::_maxConnections() const {
+  if (connOptions_.topology == ConnectionTopology::Shared)
+    return 1;
+  return std::max<size_t>(connOptions_.connections, 1);
+}
+
+ClientChannelPtr ClientStub::_leastOutstanding(const ChannelList &channels) {
+  assert(!channels.empty());
+  ClientChannelPtr best = channels.front();
+  size_t bestLoad = best->outstanding();
+  for (size_t i = 1; i < channels.size() && bestLoad > 0; ++i) {
+    const size_t load = channels[i]->outstanding();
+    if (load < bestLoad) {
+      best = channels[i];
+      bestLoad = load;
+    }
+  }
+  return best;
+}
+
+/// @brief 根据负载均衡策略选择 endpoint，默认 round-robin.
+/// 使用缓存的 endpoints，被剔除的 endpoint 只是在本地跳过，
+/// exclude 非空的时候不选择它
+Endpoint ClientStub::_selectEndpoint(const EndpointsPtr &eps,
+                                     const std::string &routingKey,
+                                     const Endpoint *exclude) {
   if (!eps || eps->empty())
     return Endpoint::default_instance();
-  // 临时的负载均衡策略，round-robin
-  static int current = 0;
-  const int lucky = current++ % static_cast<int>(eps->size());
-  return (*eps)[lucky];
+  const Timestamp now = Timestamp::now();
+  auto set = endpointStats_.resolve(eps);
+  endpointStats_.detectOutliers(*set, now);
+  if (!routingKey.empty())
+    return _selectByKey(*set, hashRoutingKey(routingKey), exclude, now);
+
+  const Candidates *all = &set->all();
+  Candidates others;
+  if (exclude) {
+    others.reserve(all->size());
+    for (const auto &c : *all)
+      if (!(*c.endpoint == *exclude))
+        others.push_back(c);
+    if (others.empty())
+      return Endpoint::default_instance();
+    all = &others;
+  }
+  if (endpointStats_.ejectedCount() == 0)
+    return *balancer_->select(*all).endpoint;
+
+  // 缓存的可用列表，只有需要试探的 endpoint 才访问熔断器
+  auto availability = set->availability(now);
+  const Candidates *usable = &availability->usable;
+  Candidates candidates;
+  if (exclude) {
+    candidates.reserve(usable->size());
+    for (const auto &c : *usable)
+      if (!(*c.endpoint == *exclude))
+        candidates.push_back(c);
+    usable = &candidates;
+  }
+  const int percent = endpointStats_.circuitBreakerOptions().maxEjectionPercent;
+  while (!usable->empty() &&
+         usable->size() * 100 >= all->size() * (100 - percent)) {
+    const Candidate &c = balancer_->select(*usable);
+    if (availability->admission[c.index] == Admission::Free ||
+        c.stats->breaker().tryAcquire(now))
+      return *c.endpoint;
+    // HalfOpen 的 endpoint 试探名额已经被其他线程占用，在副本中删除之后
+    // 重新选择
+    const size_t pos = &c - usable->data();
+    if (usable != &candidates) {
+      candidates = *usable;
+      usable = &candidates;
+    }
+    candidates.erase(candidates.begin() + pos);
+  }
+  // 可用的 endpoint 太少，忽略熔断，避免剩下的 endpoint 被压垮
+  return *balancer_->select(*all).endpoint;
+}
+
+/// @brief 总是在完整的 endpoints 上按照 key 选择，exclude 和被剔除的
+/// endpoint 由 accept 跳过，key 顺时针落到下一个 endpoint
+Endpoint ClientStub::_selectByKey(const EndpointSet &eps, uint64_t hash,
+                                  const Endpoint *exclude, Timestamp now) {
+  auto allowed = [exclude](const Candidate &c) {
+    return !exclude || !(*c.endpoint == *exclude);
+  };
+  const Candidate *selected = nullptr;
+  if (endpointStats_.ejectedCount() > 0) {
+    auto availability = eps.availability(now);
+    const auto &admission = availability->admission;
+    size_t total = eps.size(), available = availability->usable.size();
+    if (exclude) {
+      for (const auto &c : eps.all()) {
+        if (allowed(c))
+          continue;
+        --total;
+        if (admission[c.index] != Admission::Ejected)
+          --available;
+      }
+    }
+    const int percent =
+        endpointStats_.circuitBreakerOptions().maxEjectionPercent;
+    selected = balancer_->selectByKey(eps, hash, [&](const Candidate &c) {
+      if (!allowed(c) || available * 100 < total * (100 - percent))
+        return false;
+      switch (admission[c.index]) {
+      case Admission::Ejected:
+        return false;
+      case Admission::Free:
+        return true;
+      case Admission::Probe:
+        break;
+      }
+      if (c.stats->breaker().tryAcquire(now))
+        return true;
+      // HalfOpen 的试探名额已经被其他线程占用
+      --available;
+      return false;
+    });
+  }
+  // 没有被剔除的 endpoint，或者可用的 endpoint 太少的时候忽略熔断
+  if (!selected)
+    selected = balancer_->selectByKey(eps, hash, allowed);
+  return selected ? *selected->endpoint : Endpoint::default_instance();
 }
 
 /**
- * @brief 连接 service 的 endpoint，返回一个 Future<ClientChannel *>
+ * @brief 连接 service 的 endpoint，返回一个 Future<ClientChannelPtr>
  *
  *
  * @param loop
  * @param ep
- * @return Future<ClientChannel *>
+ * @return Future<ClientChannelPtr>
  */
-Future<ClientChannel *> ClientStub::_connect(EventLoop *loop,
+Future<ClientChannelPtr> ClientStub::_connect(EventLoop *loop,
                                              const Endpoint &ep) {
   assert(loop->isInLoopThread());
   ChannelPromise promise;
@@ -246,6 +457,16 @@ Future<ClientChannel *> ClientStub::_connect(EventLoop *loop,
   return fut;
 }
 
+/// @brief 从 peer address 得到 Endpoint
+static Endpoint peerEndpoint(const InetAddress &peer) {
+  Endpoint ep;
+  std::string addr = peer.toHostPort();
+  int pos = addr.find(':');
+  ep.set_ip(addr.substr(0, pos));
+  ep.set_port(static_cast<uint16_t>(atoi(addr.substr(pos + 1).c_str())));
+  return ep;
+}
+
 /// @brief 连接建立成功回调函数，负责设置连接的各种回调函数
 /// 相当于 TcpClient::newConnection 里面的逻辑都放到这里
 /// TODO 在 RpcClient 中先创建好 TcpConnection，然后调用 _onNewConnection cb
@@ -256,18 +477,9 @@ void ClientStub::_onNewConnection(const TcpConnectionPtr &conn) {
   auto _ = conn;
   // 创建新的 ClientChannel，设置到 TcpConnection
   auto channel = std::make_shared<ClientChannel>(std::move(_), this);
+  channel->endpoint_ = peerEndpoint(conn->peerAddress());
+  channel->stats_ = endpointStats(channel->endpoint_);
   conn->setContext(channel);
-  {
-    // 创建 ep -> ClientChannel 映射，表示已经建立好连接了
-    Endpoint ep;
-    std::string addr = conn->peerAddress().toHostPort();
-    int pos = addr.find(':');
-    ep.set_ip(addr.substr(0, pos));
-    ep.set_port(static_cast<uint16_t>(atoi(addr.substr(pos + 1).c_str())));
-    auto &channelMap = channels_[conn->getLoop()->getId()];
-    bool succ = channelMap.insert({ep, channel}).second;
-    assert(succ);
-  }
   if (onCreateChannel_) // 回调函数
     onCreateChannel_(channel.get());
   conn->setConnectionCallback( // 连接完全初始化好之后回调
@@ -279,36 +491,53 @@ void ClientStub::_onNewConnection(const TcpConnectionPtr &conn) {
                 std::placeholders::_2, std::placeholders::_3));
 }
 
+/// @brief 连接建立之后在连接所属的 loop 中执行
+/// 创建 ep -> ClientChannel 映射，并唤醒等待连接的 promise
 void ClientStub::_onConnect(const TcpConnectionPtr &conn) {
   // see conn->connecEstablished()
   assert(conn->getLoop()->isInLoopThread());
-  // 获取 loop 所属的 unordered_map
-  auto &pendingConns = pendingConns_[conn->getLoop()->getId()];
-  // 检查是否存在 peerAddress()
-  auto req = pendingConns.find(conn->peerAddress());
-  assert(req != pendingConns.end());
-
+  auto channel = conn->getContext<ClientChannel>();
+  const Endpoint ep = peerEndpoint(conn->peerAddress());
+  std::vector<ChannelPromise> promises;
+  if (_isGlobal()) {
+    std::lock_guard<std::mutex> lk(globalMutex_);
+    globalChannels_[ep].push_back(channel);
+    --globalConnecting_[ep];
+    promises.swap(globalWaiters_[ep]);
+  } else {
+    channels_[conn->getLoop()->getId()][ep].push_back(channel);
+    // 获取 loop 所属的 unordered_map，检查是否存在 peerAddress()
+    auto &pendingConns = pendingConns_[conn->getLoop()->getId()];
+    auto req = pendingConns.find(conn->peerAddress());
+    assert(req != pendingConns.end());
+    promises.swap(req->second);
+    pendingConns.erase(req);
+  }
   // 设置所有等待在该 ep 上的 promise
-  std::vector<ChannelPromise> promises(std::move(req->second));
-  pendingConns.erase(req);
   for (auto &pm : promises)
-    pm.setValue(conn->getContext<ClientChannel>().get());
+    pm.setValue(channel);
 }
 
 /// @brief 连接断开的时候执行
 void ClientStub::_onDisconnect(const TcpConnectionPtr &conn) {
-  Endpoint ep;
-  std::string addr = conn->peerAddress().toHostPort();
-  int pos = addr.find(':');
-  ep.set_ip(addr.substr(0, pos));
-  ep.set_port(static_cast<uint16_t>(atoi(addr.substr(pos + 1).c_str())));
-
+  const Endpoint ep = peerEndpoint(conn->peerAddress());
+  auto channel = conn->getContext<ClientChannel>();
+  auto eraseFrom = [&channel](ChannelList &channels) {
+    auto it = std::find(channels.begin(), channels.end(), channel);
+    assert(it != channels.end());
+    channels.erase(it);
+  };
   // 销毁 channels_ 中的 ClientChannel，执行 channel onDestory 函数
-  auto &channelMap = channels_[conn->getLoop()->getId()];
-  auto it = channelMap.find(ep);
-  assert(it != channelMap.end());
-  it->second->onDestory();
-  channelMap.erase(it);
+  if (_isGlobal()) {
+    std::lock_guard<std::mutex> lk(globalMutex_);
+    eraseFrom(globalChannels_[ep]);
+  } else {
+    auto &channelMap = channels_[conn->getLoop()->getId()];
+    eraseFrom(channelMap[ep]);
+    if (channelMap[ep].empty())
+      channelMap.erase(ep);
+  }
+  channel->onDestory();
 
   // baseLoop 处理
   RPC_SERVER.baseLoop()->queueInLoop(
@@ -320,7 +549,7 @@ void ClientStub::_onMessage(const TcpConnectionPtr &conn, Buffer *buffer,
                             Timestamp) {
   ////// TODO 需要保证消息的完整性
   auto channel = conn->getContext<ClientChannel>();
-  const char *data = buffer->peek(), *const start = data;
+  const char *data = buffer->peek();
   while (buffer->readableBytes() >= static_cast<size_t>(kPbHeaderLen)) {
     try {
       // 解析 buffer bytes 数据
@@ -328,8 +557,8 @@ void ClientStub::_onMessage(const TcpConnectionPtr &conn, Buffer *buffer,
       // 否则的话说明 bytes 长度不足一条完整的消息，先返回不做处理
       auto msg = channel->onData(data, buffer->readableBytes());
       if (msg) {
+        buffer->retrieveUntil(data);
         channel->onMessage(std::move(msg));
-        buffer->retrieve(data - start);
       } else {
         break;
       }
@@ -345,23 +574,210 @@ void ClientStub::_onMessage(const TcpConnectionPtr &conn, Buffer *buffer,
 /// @brief 连接 service 出错，设置在该 peer 上等待的 pm 为异常值
 void ClientStub::_onConnFail(EventLoop *loop, const InetAddress &peer) {
   assert(loop->isInLoopThread());
-  auto pendingConns = pendingConns_[loop->getId()];
-  auto req = pendingConns.find(peer);
-  if (req != pendingConns.end()) {
-    for (auto &pm : req->second)
-      pm.setException(std::make_exception_ptr(
-          Exception(ErrorCode::ConnectRefused, peer.toHostPort())));
-    pendingConns.erase(req);
+  std::vector<ChannelPromise> promises;
+  endpointStats(peerEndpoint(peer))->onConnectFailed();
+  if (_isGlobal()) {
+    // 还有可用的连接或者正在建立的连接的时候，等待的 promise 继续等待
+    const Endpoint ep = peerEndpoint(peer);
+    std::lock_guard<std::mutex> lk(globalMutex_);
+    if (--globalConnecting_[ep] == 0 && globalChannels_[ep].empty())
+      promises.swap(globalWaiters_[ep]);
+  } else {
+    auto &pendingConns = pendingConns_[loop->getId()];
+    auto req = pendingConns.find(peer);
+    if (req != pendingConns.end()) {
+      promises.swap(req->second);
+      pendingConns.erase(req);
+    }
   }
+  for (auto &pm : promises)
+    pm.setException(std::make_exception_ptr(
+        Exception(ErrorCode::ConnectRefused, peer.toHostPort())));
 }
 
 void ClientStub::setOnCreateChannel(std::function<void(ClientChannel *)> cb) {
   onCreateChannel_ = std::move(cb);
 }
 
+void ClientStub::setCompression(CompressType type, size_t threshold,
+                                const std::string &dictionary) {
+  compress_ = makeCompressOptions(type, threshold, dictionary);
+}
+
+void ClientStub::setChunkSize(size_t chunkSize) {
+  chunkSize_ = std::min(chunkSize, kMaxChunkSize);
+}
+
+void ClientStub::setConnectionOptions(const ConnectionOptions &options) {
+  connOptions_ = options;
+}
+
+void ClientStub::setLoadBalancer(LoadBalanceType type) {
+  balancer_ = makeLoadBalancer(type);
+}
+
+void ClientStub::setLoadBalancer(std::unique_ptr<LoadBalancer> balancer) {
+  if (balancer)
+    balancer_ = std::move(balancer);
+}
+
+void ClientStub::setRoutingKey(RoutingKeyExtractor extractor) {
+  routingKey_ = std::move(extractor);
+  if (routingKey_)
+    balancer_ = makeLoadBalancer(LoadBalanceType::ConsistentHash);
+}
+
+/// @brief 整数转换成十进制，string 和 bytes 直接使用，message 使用序列化之后
+/// 的字节
+void ClientStub::setRoutingKeyField(const std::string &field) {
+  using google::protobuf::FieldDescriptor;
+  setRoutingKey([field](const std::string &, const Message &req) {
+    const FieldDescriptor *fd = req.GetDescriptor()->FindFieldByName(field);
+    if (!fd || fd->is_repeated())
+      return std::string();
+    const auto *reflection = req.GetReflection();
+    switch (fd->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+      return reflection->GetString(req, fd);
+    case FieldDescriptor::CPPTYPE_INT32:
+      return std::to_string(reflection->GetInt32(req, fd));
+    case FieldDescriptor::CPPTYPE_INT64:
+      return std::to_string(reflection->GetInt64(req, fd));
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return std::to_string(reflection->GetUInt32(req, fd));
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return std::to_string(reflection->GetUInt64(req, fd));
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return std::to_string(reflection->GetEnumValue(req, fd));
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return std::string(reflection->GetBool(req, fd) ? "1" : "0");
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return reflection->GetMessage(req, fd).SerializeAsString();
+    default:
+      return std::string();
+    }
+  });
+}
+
+void ClientStub::setCircuitBreaker(const CircuitBreakerOptions &options) {
+  endpointStats_.setCircuitBreakerOptions(options);
+}
+
+void ClientStub::setHedgeBudget(double ratio, double maxTokens) {
+  hedgeBudget_.reset(ratio, maxTokens);
+}
+
+void ClientStub::setRetryBudget(double ratio, double maxTokens) {
+  retryBudget_.reset(ratio, maxTokens);
+}
+
+std::shared_ptr<void>
+ClientStub::joinCoalesced(const std::string &key,
+                          const std::shared_ptr<void> &call) {
+  std::lock_guard<std::mutex> lk(coalescedMutex_);
+  auto it = coalesced_.find(key);
+  if (it != coalesced_.end())
+    return it->second;
+  coalesced_.emplace(key, call);
+  return nullptr;
+}
+
+void ClientStub::leaveCoalesced(const std::string &key) {
+  std::lock_guard<std::mutex> lk(coalescedMutex_);
+  coalesced_.erase(key);
+}
+
+Future<void> ClientStub::subscribe(const std::string &topic,
+                                   const Endpoint &ep) {
+  {
+    std::lock_guard<std::mutex> lk(subscriptionsMutex_);
+    // 先占位，并发的 subscribe 不会重复订阅
+    if (!subscriptions_.emplace(topic, std::weak_ptr<ClientChannel>()).second)
+      return makeReadyFuture();
+  }
+  auto failed = [this, topic](std::exception_ptr err) {
+    {
+      std::lock_guard<std::mutex> lk(subscriptionsMutex_);
+      subscriptions_.erase(topic);
+    }
+    return makeExceptionFuture<void>(std::move(err));
+  };
+  return getChannel(ep).then([this, topic,
+                              failed](Result<ClientChannelPtr> &&chan) {
+    ClientChannelPtr channel;
+    try {
+      channel = chan.getValue();
+    } catch (...) {
+      return failed(std::current_exception());
+    }
+    {
+      std::lock_guard<std::mutex> lk(subscriptionsMutex_);
+      subscriptions_[topic] = channel;
+    }
+    return channel->subscribe(topic).then([failed](Result<void> &&r) {
+      if (r.hasException())
+        return failed(std::move(r).getException());
+      return makeReadyFuture();
+    });
+  });
+}
+
+Future<void> ClientStub::unsubscribe(const std::string &topic) {
+  std::shared_ptr<ClientChannel> channel;
+  {
+    std::lock_guard<std::mutex> lk(subscriptionsMutex_);
+    auto it = subscriptions_.find(topic);
+    if (it == subscriptions_.end())
+      return makeReadyFuture();
+    channel = it->second.lock();
+    subscriptions_.erase(it);
+  }
+  if (!channel)
+    return makeReadyFuture();
+  return channel->unsubscribe(topic);
+}
+
+void ClientStub::onSubscriptionLost(const std::string &topic,
+                                    ClientChannel *channel,
+                                    const std::exception_ptr &err) {
+  {
+    std::lock_guard<std::mutex> lk(subscriptionsMutex_);
+    auto it = subscriptions_.find(topic);
+    if (it != subscriptions_.end()) {
+      auto current = it->second.lock();
+      if (!current || current.get() == channel)
+        subscriptions_.erase(it);
+    }
+  }
+  if (onPush_)
+    onPush_(topic, Result<std::string>(err));
+}
+
+void ClientStub::setCacheable(const std::string &method,
+                              std::chrono::milliseconds ttl,
+                              std::chrono::milliseconds staleWhileRevalidate) {
+  cachePolicies_[method] = CachePolicy{ttl, staleWhileRevalidate};
+}
+
+const CachePolicy *ClientStub::cachePolicy(const std::string &method) const {
+  if (cachePolicies_.empty())
+    return nullptr;
+  auto it = cachePolicies_.find(method);
+  return it == cachePolicies_.end() ? nullptr : &it->second;
+}
+
+ClientCache &ClientStub::cache(EventLoop *loop) {
+  assert(loop->isInLoopThread());
+  auto &cache = caches_[loop->getId()];
+  if (!cache)
+    cache.reset(new ClientCache(cacheMaxBytes_));
+  return *cache;
+}
+
 void ClientStub::onRegister() {
   channels_.resize(RPC_SERVER.getThreadNum());
   pendingConns_.resize(RPC_SERVER.getThreadNum());
+  caches_.resize(RPC_SERVER.getThreadNum());
 }
 
 /// TODO for RPC SERVER register nameserver stub
@@ -369,6 +785,7 @@ void ClientStub::onRegister() {
 void ClientStub::onRegister(int num) {
   channels_.resize(num);
   pendingConns_.resize(num);
+  caches_.resize(num);
 }
 
 } // namespace lrpc
\ No newline at end of file
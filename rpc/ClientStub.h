@@ -2,12 +2,18 @@
 #define LRPC_CLIENTSTUB_H
 
 #include "Callback.h"
+#include "Chunk.h"
+#include "ClientCache.h"
+#include "Compression.h"
 #include "EventLoop.h"
+#include "LoadBalancer.h"
+#include "RequestBudget.h"
 #include "RpcEndpoint.h"
 #include "TcpConnection.h"
 #include "future.h"
 #include <google/protobuf/message.h>
 #include <string>
+#include <unordered_set>
 
 namespace google {
 
@@ -27,6 +33,23 @@ using lrpc::net::EventLoop;
 using namespace net;
 
 class ClientChannel;
+/// @brief getChannel 返回的 channel 可能属于其他 loop（Shared / Pool 拓扑），
+/// 持有 shared_ptr 保证使用期间 channel 不会因为连接断开被销毁
+using ClientChannelPtr = std::shared_ptr<ClientChannel>;
+
+/// @brief ClientStub 到每个 endpoint 的连接拓扑
+enum class ConnectionTopology {
+  PerLoop, ///< 每个 loop 到每个 endpoint 最多 connections 个连接（默认）
+  Shared,  ///< 每个 endpoint 只有一个连接，其他 loop 通过跨线程提交使用
+  Pool,    ///< 每个 endpoint 全局最多 connections 个连接，分布在不同的 loop
+};
+
+/// @brief 多个连接的时候选择 outstanding 请求最少的连接. 所有连接都有
+/// outstanding 请求并且没有达到上限的时候才会建立新的连接
+struct ConnectionOptions {
+  ConnectionTopology topology{ConnectionTopology::PerLoop};
+  size_t connections{1}; // PerLoop 时为每个 loop 的 K，Pool 时为全局的 M
+};
 
 /**
  * @brief RPC ClientStub
@@ -45,20 +68,134 @@ public:
   /// 直接通过这些地址链接，不会通过 name service
   void setUrlLists(const std::string &hardCodedUrls);
   void setOnCreateChannel(std::function<void(ClientChannel *)>);
+  /// @brief 对超过 threshold 的 request 进行压缩，服务端不支持的时候不压缩.
+  /// dictionary 非空的时候作为预训练字典，服务端需要设置相同的字典
+  void setCompression(CompressType type, size_t threshold = 1024,
+                      const std::string &dictionary = std::string());
+  const CompressOptions &compressOptions() const { return compress_; }
+  /// @brief 序列化之后超过 chunkSize 的 request 分块发送，见 Chunk.h.
+  /// 0 表示不分块（默认），不超过 kMaxChunkSize. 携带附件的 request 不分块
+  void setChunkSize(size_t chunkSize);
+  size_t chunkSize() const { return chunkSize_; }
+  /// @brief 接收分块 response 的限制，见 ChunkLimits. 只能在 RpcServer 启动之前调用
+  void setChunkLimits(const ChunkLimits &limits) { chunkLimits_ = limits; }
+  const ChunkLimits &chunkLimits() const { return chunkLimits_; }
+  /// @brief 设置连接拓扑，只能在 RpcServer 启动之前调用
+  void setConnectionOptions(const ConnectionOptions &options);
+  /// @brief 设置负载均衡策略，只能在 RpcServer 启动之前调用
+  void setLoadBalancer(LoadBalanceType type);
+  void setLoadBalancer(std::unique_ptr<LoadBalancer> balancer);
+  /// @brief 从 request 中提取路由 key，返回空字符串表示没有 key
+  using RoutingKeyExtractor = std::function<std::string(
+      const std::string &method, const Message &request)>;
+  /// @brief 按照 key 路由：没有指定 endpoint 的 call 用 extractor 提取 key，
+  /// 同一个 key 的请求总是发往同一个 endpoint（被熔断剔除的时候发往环上的
+  /// 下一个），hedge 和重试优先选择环上的下一个 endpoint. 同时把负载均衡策略
+  /// 设置为 ConsistentHash. 只能在 RpcServer 启动之前调用
+  void setRoutingKey(RoutingKeyExtractor extractor);
+  /// @brief 使用 request 中名为 field 的字段作为路由 key，没有这个字段的
+  /// request 不使用 key. 只支持非 repeated 的字段
+  void setRoutingKeyField(const std::string &field);
+  /// @brief request 的路由 key，没有设置 extractor 的时候返回空字符串
+  std::string routingKey(const std::string &method, const Message &req) const {
+    return routingKey_ ? routingKey_(method, req) : std::string();
+  }
+  /// @brief 设置熔断和异常剔除的阈值，只能在 RpcServer 启动之前调用
+  void setCircuitBreaker(const CircuitBreakerOptions &options);
+  /// @brief endpoint 的统计信息，ClientChannel 创建的时候获取
+  std::shared_ptr<EndpointStats> endpointStats(const Endpoint &ep) {
+    return endpointStats_.get(ep);
+  }
+  /// @brief hedge 请求占正常请求的比例上限，默认 5%，最多累计 maxTokens 个
+  void setHedgeBudget(double ratio, double maxTokens = 10);
+  RequestBudget &hedgeBudget() { return hedgeBudget_; }
+  /// @brief 重试请求占正常请求的比例上限，默认 10%，最多累计 maxTokens 个
+  void setRetryBudget(double ratio, double maxTokens = 10);
+  RequestBudget &retryBudget() { return retryBudget_; }
+  /// @brief 合并相同的请求：没有指定 endpoint 的 call 发送之前，如果相同
+  /// method、相同 request（序列化之后的字节相同）的请求正在执行，则等待它的
+  /// 结果，不再发送. 合并的请求共享第一个请求的 CallOptions. 默认关闭，
+  /// 只应该用于幂等的 method
+  void setCoalescing(bool on) { coalescing_ = on; }
+  bool coalescing() const { return coalescing_; }
+  /// @brief key 对应的请求正在执行的时候返回它登记的 call，
+  /// 否则登记 call 并返回 nullptr. 由 call<R>() 使用
+  std::shared_ptr<void> joinCoalesced(const std::string &key,
+                                      const std::shared_ptr<void> &call);
+  /// @brief 请求完成，之后相同的请求重新发送
+  void leaveCoalesced(const std::string &key);
+  /// @brief 在客户端缓存 method 的 response，只应该用于幂等并且结果变化较慢的
+  /// method. 没有指定 endpoint 的 call 在 ttl 之内直接返回缓存的结果，
+  /// 之后的 staleWhileRevalidate 之内返回陈旧的结果并在后台刷新.
+  /// 只能在 RpcServer 启动之前调用
+  void setCacheable(const std::string &method, std::chrono::milliseconds ttl,
+                    std::chrono::milliseconds staleWhileRevalidate =
+                        std::chrono::milliseconds(0));
+  /// @brief 每个 loop 的缓存占用内存的上限，默认 16MB
+  void setCacheMaxBytes(size_t bytes) { cacheMaxBytes_ = bytes; }
+  /// @brief method 的缓存时间，不可缓存的时候返回 nullptr
+  const CachePolicy *cachePolicy(const std::string &method) const;
+  /// @brief loop 的缓存，只能在 loop 线程中调用
+  ClientCache &cache(EventLoop *loop);
+  /// @brief 发起调用的线程对应的 loop，不是 IO loop 的时候选择一个 IO loop
+  static EventLoop *callerLoop();
+  /// @brief 把 method 标记为 oneway：call<R>() 发送请求之后立即以默认构造的
+  /// R 完成，不等待 response，服务端也不回复. 只能在 RpcServer 启动之前调用
+  void setOneway(const std::string &method) { onewayMethods_.insert(method); }
+  bool isOneway(const std::string &method) const {
+    return !onewayMethods_.empty() && onewayMethods_.count(method);
+  }
+  /// @brief 服务端推送的回调函数，在连接所属的 loop 中调用，payload 是序列化
+  /// 之后的消息. 订阅所在的连接断开的时候以 ConnectionLost 异常调用一次，
+  /// 之后需要重新 subscribe
+  using PushCallback = std::function<void(const std::string &topic,
+                                          Result<std::string> &&payload)>;
+  /// @brief 只能在 RpcServer 启动之前调用
+  void setOnPush(PushCallback cb) { onPush_ = std::move(cb); }
+  const PushCallback &onPush() const { return onPush_; }
+  /// @brief 在 getChannel(ep) 选择的连接上订阅 topic，已经订阅的 topic 不再
+  /// 重复订阅. 返回的 future 在 SUBSCRIBE 交给连接发送之后完成
+  Future<void> subscribe(const std::string &topic, const Endpoint &ep);
+  Future<void> unsubscribe(const std::string &topic);
+  /// @brief 订阅所在的连接断开，由 ClientChannel 调用
+  void onSubscriptionLost(const std::string &topic, ClientChannel *channel,
+                          const std::exception_ptr &err);
   /// @brief get channel by some load balance
-  Future<ClientChannel *> getChannel();
-  Future<ClientChannel *> getChannel(const Endpoint &ep);
+  Future<ClientChannelPtr> getChannel();
+  Future<ClientChannelPtr> getChannel(const Endpoint &ep);
+  /// @brief ep 无效并且 routingKey 非空的时候按照 key 选择 endpoint
+  Future<ClientChannelPtr> getChannel(const Endpoint &ep,
+                                     const std::string &routingKey);
+  /// @brief 由负载均衡器在除了 ep 之外的 endpoint 中选择，用于 hedge 请求
+  Future<ClientChannelPtr>
+  getChannelExcept(const Endpoint &ep,
+                   const std::string &routingKey = std::string());
+  /// @brief 由负载均衡器选择一个 endpoint，优先选择 exclude 之外的，用于重试
+  Future<Endpoint>
+  selectEndpoint(const Endpoint &exclude,
+                 const std::string &routingKey = std::string());
+  /// @brief service 当前所有的 endpoint，包括被熔断剔除的，用于 fanout
+  Future<std::shared_ptr<std::vector<Endpoint>>> endpoints() {
+    return _getEndpoints();
+  }
 
   void onRegister();
   void onRegister(int);
 
 private:
   using EndpointsPtr = std::shared_ptr<std::vector<Endpoint>>;
-  using ChannelMap =
-      std::unordered_map<Endpoint, std::shared_ptr<ClientChannel>>;
-  using ChannelPromise = Promise<ClientChannel *>;
+  using ChannelList = std::vector<std::shared_ptr<ClientChannel>>;
+  using ChannelMap = std::unordered_map<Endpoint, ChannelList>;
+  using ChannelPromise = Promise<ClientChannelPtr>;
 
-  Future<ClientChannel *> _connect(EventLoop *, const Endpoint &ep);
+  Future<ClientChannelPtr> _connect(EventLoop *, const Endpoint &ep);
+  // Shared / Pool 拓扑下获取 ep 的 channel
+  Future<ClientChannelPtr> _makeGlobalChannel(const Endpoint &ep);
+  bool _isGlobal() const {
+    return connOptions_.topology != ConnectionTopology::PerLoop;
+  }
+  size_t _maxConnections() const;
+  static ClientChannelPtr _leastOutstanding(const ChannelList &channels);
 
   // 各种回调函数
   void _onNewConnection(const TcpConnectionPtr &);
@@ -70,15 +207,46 @@ private:
   // 获取 service endpoints
   Future<EndpointsPtr> _getEndpoints();
   // 调用 _selectEndpoint 和 _makeChannel
-  Future<ClientChannel *> _selectChannel(EventLoop *, Result<EndpointsPtr> &&);
+  Future<ClientChannelPtr> _selectChannel(EventLoop *, Result<EndpointsPtr> &&);
   // 尝试通过 endpoint 建立连接
-  Future<ClientChannel *> _makeChannel(EventLoop *, const Endpoint &);
-  static const Endpoint &_selectEndpoint(EndpointsPtr); // 负载均衡选择 endpoint
+  Future<ClientChannelPtr> _makeChannel(EventLoop *, const Endpoint &);
+  // 跳过被熔断剔除的 endpoint 和 exclude，由负载均衡选择. routingKey 非空
+  // 的时候按照 key 选择
+  Endpoint _selectEndpoint(const EndpointsPtr &,
+                           const std::string &routingKey = std::string(),
+                           const Endpoint *exclude = nullptr);
+  Endpoint _selectByKey(const EndpointSet &, uint64_t hash,
+                        const Endpoint *exclude, Timestamp now);
   // name server reponse 的 callback
   void _onNewEndpointList(Result<EndpointList> &&);
 
-  // 每个 loop 有一个 ChannelMap，记录 Endpoint 连接建立之后对应的 ClientChannel
+  // PerLoop: 每个 loop 有一个 ChannelMap，记录 Endpoint 连接建立之后对应的
+  // ClientChannel
   std::vector<ChannelMap> channels_;
+  // Shared / Pool: 所有 loop 共享，由 globalMutex_ 保护
+  ChannelMap globalChannels_;
+  std::unordered_map<Endpoint, size_t> globalConnecting_; // 正在建立的连接数
+  std::unordered_map<Endpoint, std::vector<ChannelPromise>> globalWaiters_;
+  std::mutex globalMutex_;
+  ConnectionOptions connOptions_;
+  std::unique_ptr<LoadBalancer> balancer_;
+  RoutingKeyExtractor routingKey_;
+  EndpointStatsTable endpointStats_;
+  RequestBudget hedgeBudget_;
+  RequestBudget retryBudget_{0.1};
+  bool coalescing_{false};
+  std::mutex coalescedMutex_;
+  // key -> 正在执行的请求的 SharedFuture<Result<R>>
+  std::unordered_map<std::string, std::shared_ptr<void>> coalesced_;
+  std::unordered_set<std::string> onewayMethods_;
+  PushCallback onPush_;
+  // topic -> 订阅所在的连接，SUBSCRIBE 发送之前为空
+  std::unordered_map<std::string, std::weak_ptr<ClientChannel>> subscriptions_;
+  std::mutex subscriptionsMutex_;
+  std::unordered_map<std::string, CachePolicy> cachePolicies_;
+  size_t cacheMaxBytes_{16 * 1024 * 1024};
+  // 每个 loop 一个，第一次使用的时候创建
+  std::vector<std::unique_ptr<ClientCache>> caches_;
   // 每个 loop 有一个 unordered_map. 记录等待 InetAddress 连接建立的所有 promise
   std::vector<std::unordered_map<InetAddress, std::vector<ChannelPromise>>>
       pendingConns_;
@@ -89,6 +257,9 @@ private:
   std::shared_ptr<GoogleService> service_;
   std::string name_;
   std::function<void(ClientChannel *)> onCreateChannel_;
+  CompressOptions compress_;
+  size_t chunkSize_{0};
+  ChunkLimits chunkLimits_;
   std::mutex endpointsMutex_;
   EndpointsPtr endpoints_;
 
@@ -1,6 +1,9 @@
 #include "Coder.h"
 #include "RpcException.h"
 #include "lrpc.pb.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <limits>
 
 using google::protobuf::Message;
 
@@ -18,31 +21,95 @@ bool hasField(const Message &msg, const std::string &field) {
   return reflection->HasField(msg, fieldDesc);
 }
 
-static int getLength(const char *&data) {
-  int len;
-  memcpy(&len, data, kPbHeaderLen);
-  return len;
+static uint32_t getUint32(const char *data) {
+  uint32_t v;
+  memcpy(&v, data, sizeof v);
+  return v;
 }
 
+// frame 总长度的上限，长度头的高位用来记录压缩信息
+static const int kMaxFrameLen = 256 * 1024 * 1024;
+// 分块传输的消息不受 kMaxFrameLen 的限制，接收端按照 ChunkLimits 限制，
+// 并且不能超过 protobuf 解析的长度限制
+const size_t kMaxChunkedLen = std::numeric_limits<int>::max();
+
 /**
  * @brief 消息解码函数，支持从 bytes 和 Message 数据中解析
  */
 
 std::shared_ptr<Message> bytesDecode(const char *&data, size_t len) {
   assert(len >= kPbHeaderLen);
-  const int totalLen = getLength(data);
-  // 长度超出限制
-  if (totalLen <= kPbHeaderLen || totalLen >= 256 * 1024 * 1024)
+  const uint32_t header = getUint32(data);
+  const int totalLen = static_cast<int>(header & kFrameLenMask);
+  // 长度超出限制，最高位必须为 0
+  if (totalLen <= kPbHeaderLen ||
+      (header & ~(kFrameLenMask | kFrameCodecMask | kFrameDictBit |
+                  kFrameAttachBit)))
     throw Exception(ErrorCode::TooLongFrame,
-                    "abnormal totalLen:" + std::to_string(totalLen));
+                    "abnormal totalLen:" + std::to_string(header));
   if (static_cast<int>(len) < totalLen) // 还没有一条完整的消息
     return nullptr;
 
   RpcMessage *frame = nullptr;
   std::shared_ptr<Message> res(frame = new RpcMessage);
-  // 解析 data 中的数据
-  if (!frame->ParseFromArray(data + kPbHeaderLen, totalLen - kPbHeaderLen))
-    throw Exception(ErrorCode::DecodeFail, "ParseFromArray failed");
+  const auto codec =
+      static_cast<CompressType>((header & kFrameCodecMask) >> kFrameCodecShift);
+  if (header & kFrameAttachBit) {
+    // 携带附件的 frame: attachLen protobuf attachment，不压缩
+    if (codec != CompressType::None || totalLen < kPbHeaderLen + 4)
+      throw Exception(ErrorCode::DecodeFail, "abnormal attachment frame");
+    const uint32_t attachLen = getUint32(data + kPbHeaderLen);
+    if (attachLen > static_cast<uint32_t>(totalLen - kPbHeaderLen - 4))
+      throw Exception(ErrorCode::DecodeFail,
+                      "abnormal attachLen:" + std::to_string(attachLen));
+    const char *pb = data + kPbHeaderLen + 4;
+    const int pbLen = totalLen - kPbHeaderLen - 4 - static_cast<int>(attachLen);
+    if (!frame->ParseFromArray(pb, pbLen))
+      throw Exception(ErrorCode::DecodeFail, "ParseFromArray failed");
+    // 附件不经过 protobuf 解析，只从接收缓冲区中拷贝一次
+    std::string *attachment = nullptr;
+    if (frame->has_request())
+      attachment = frame->mutable_request()->mutable_attachment();
+    else if (frame->has_response())
+      attachment = frame->mutable_response()->mutable_attachment();
+    else
+      throw Exception(ErrorCode::DecodeFail, "attachment on non-call frame");
+    attachment->assign(pb + pbLen, attachLen);
+  } else if (codec == CompressType::None) {
+    // 解析 data 中的数据
+    if (!frame->ParseFromArray(data + kPbHeaderLen, totalLen - kPbHeaderLen))
+      throw Exception(ErrorCode::DecodeFail, "ParseFromArray failed");
+  } else {
+    // 压缩的 frame: [dictId] rawLen compressed
+    const char *p = data + kPbHeaderLen, *const end = data + totalLen;
+    std::shared_ptr<const std::string> dict;
+    if (header & kFrameDictBit) {
+      if (end - p < 4)
+        throw Exception(ErrorCode::DecodeFail, "truncated compressed frame");
+      const uint32_t dictId = getUint32(p);
+      p += 4;
+      dict = findCompressDictionary(dictId);
+      if (!dict)
+        throw Exception(ErrorCode::DecodeFail,
+                        "unknown compress dictionary " + std::to_string(dictId));
+    }
+    if (end - p < 4)
+      throw Exception(ErrorCode::DecodeFail, "truncated compressed frame");
+    const uint32_t rawLen = getUint32(p);
+    p += 4;
+    // 在分配内存之前检查对端声明的长度
+    if (rawLen >= static_cast<uint32_t>(kMaxFrameLen) ||
+        rawLen > maxDecompressedSize() ||
+        rawLen > decompressBound(codec, end - p))
+      throw Exception(ErrorCode::DecodeFail,
+                      "abnormal rawLen:" + std::to_string(rawLen) +
+                          ", compressed len:" + std::to_string(end - p));
+    std::string raw;
+    if (!decompress(codec, p, end - p, rawLen, dict.get(), &raw))
+      throw Exception(ErrorCode::DecodeFail, "decompress failed");
+    if (!frame->ParseFromString(raw))
+      throw Exception(ErrorCode::DecodeFail, "ParseFromArray failed");
+  }
   data += totalLen;
 
   return res;
@@ -92,7 +159,11 @@ bool responseEncode(const Message *msg, RpcMessage &frame) {
     return true;
 }
 lrpc::util::Buffer bytesEncode(const RpcMessage &rpcMsg) {
-  const int bodyLen = rpcMsg.ByteSize();
+  const size_t byteSize = rpcMsg.ByteSizeLong();
+  if (byteSize + kPbHeaderLen >= static_cast<size_t>(kMaxFrameLen))
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal bodyLen:" + std::to_string(byteSize));
+  const int bodyLen = static_cast<int>(byteSize);
   const int totalLen = kPbHeaderLen + bodyLen;
   lrpc::util::Buffer bytes;
   bytes.ensureWritableBytes(sizeof totalLen + bodyLen); // 取保缓冲区大小足够
@@ -107,6 +178,232 @@ lrpc::util::Buffer bytesEncode(const RpcMessage &rpcMsg) {
   return bytes;
 }
 
+// frame 的长度头和 attachLen 占用的字节数
+static size_t framePrefixLen(size_t attachmentSize) {
+  return kPbHeaderLen + (attachmentSize ? 4 : 0);
+}
+
+// 写入长度头，携带附件的时候接着写入 attachLen. totalLen 包括附件的长度
+static void writeFramePrefix(char *start, size_t byteSize,
+                             size_t attachmentSize) {
+  const size_t prefix = framePrefixLen(attachmentSize);
+  if (byteSize + prefix + attachmentSize >= static_cast<size_t>(kMaxFrameLen))
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal bodyLen:" +
+                        std::to_string(byteSize + attachmentSize));
+  uint32_t header = static_cast<uint32_t>(prefix + byteSize + attachmentSize);
+  if (attachmentSize) {
+    header |= kFrameAttachBit;
+    const uint32_t attachLen = static_cast<uint32_t>(attachmentSize);
+    memcpy(start + kPbHeaderLen, &attachLen, sizeof attachLen);
+  }
+  memcpy(start, &header, sizeof header);
+}
+
+lrpc::util::Buffer attachedBytesEncode(const RpcMessage &rpcMsg,
+                                       size_t attachmentSize) {
+  if (attachmentSize == 0)
+    return bytesEncode(rpcMsg);
+  const size_t byteSize = rpcMsg.ByteSizeLong();
+  const size_t prefix = framePrefixLen(attachmentSize);
+  char buf[8];
+  writeFramePrefix(buf, byteSize, attachmentSize);
+  lrpc::util::Buffer bytes;
+  bytes.ensureWritableBytes(prefix + byteSize);
+  bytes.append(buf, prefix);
+  if (!rpcMsg.SerializeToArray(bytes.beginWrite(), static_cast<int>(byteSize))) {
+    bytes.retrieveAll();
+    throw Exception(ErrorCode::EncodeFail);
+  }
+  bytes.hasWritten(byteSize);
+  return bytes;
+}
+
+// RpcMessage { response: Response { header..., serialized_response: response } }
+// 各层的长度，用于不经过 serialized_response 直接序列化 response
+struct ResponseLayout {
+  ResponseLayout(const Response &header, const Message *response) {
+    using google::protobuf::io::CodedOutputStream;
+    assert(header.Body_case() != Response::kSerializedResponse);
+    const size_t headerLen = header.ByteSizeLong();
+    payloadLen = response ? response->ByteSizeLong() : 0;
+    respLen = headerLen;
+    if (response)
+      respLen += 1 + CodedOutputStream::VarintSize64(payloadLen) + payloadLen;
+    byteSize = 1 + CodedOutputStream::VarintSize64(respLen) + respLen;
+  }
+
+  // 序列化到 [start, start + byteSize)，返回写入的结尾
+  uint8_t *write(const Response &header, const Message *response,
+                 uint8_t *p) const {
+    using google::protobuf::io::CodedOutputStream;
+    using google::protobuf::internal::WireFormatLite;
+    p = WireFormatLite::WriteTagToArray(
+        RpcMessage::kResponseFieldNumber,
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED, p);
+    p = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(respLen),
+                                                p);
+    p = header.SerializeWithCachedSizesToArray(p);
+    if (response) {
+      p = WireFormatLite::WriteTagToArray(
+          Response::kSerializedResponseFieldNumber,
+          WireFormatLite::WIRETYPE_LENGTH_DELIMITED, p);
+      p = CodedOutputStream::WriteVarint32ToArray(
+          static_cast<uint32_t>(payloadLen), p);
+      p = response->SerializeWithCachedSizesToArray(p);
+    }
+    return p;
+  }
+
+  size_t payloadLen;
+  size_t respLen;
+  size_t byteSize;
+};
+
+void responseBytesEncode(const Response &header, const Message *response,
+                         lrpc::util::Buffer *out, size_t attachmentSize) {
+  const ResponseLayout layout(header, response);
+  const size_t byteSize = layout.byteSize;
+  const size_t prefix = framePrefixLen(attachmentSize);
+  if (byteSize + prefix + attachmentSize >= static_cast<size_t>(kMaxFrameLen))
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal bodyLen:" + std::to_string(byteSize));
+  // 预留长度头，直接在 out 的可写区域中序列化，最后回填长度
+  out->ensureWritableBytes(prefix + byteSize);
+  char *const start = out->beginWrite();
+  uint8_t *p = layout.write(header, response,
+                            reinterpret_cast<uint8_t *>(start + prefix));
+  if (reinterpret_cast<char *>(p) != start + prefix + byteSize)
+    throw Exception(ErrorCode::EncodeFail, "message changed while encoding");
+  writeFramePrefix(start, byteSize, attachmentSize);
+  out->hasWritten(prefix + byteSize);
+}
+
+void responseSerialize(const Response &header, const Message *response,
+                       std::string *out) {
+  const ResponseLayout layout(header, response);
+  if (layout.byteSize >= kMaxChunkedLen)
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal bodyLen:" + std::to_string(layout.byteSize));
+  out->resize(layout.byteSize);
+  uint8_t *const start = reinterpret_cast<uint8_t *>(&(*out)[0]);
+  if (layout.write(header, response, start) != start + layout.byteSize)
+    throw Exception(ErrorCode::EncodeFail, "message changed while encoding");
+}
+
+void chunkBytesEncode(uint32_t id, uint64_t totalLen, const char *data,
+                      size_t len, lrpc::util::Buffer *out) {
+  using google::protobuf::io::CodedOutputStream;
+  using google::protobuf::internal::WireFormatLite;
+  // RpcMessage { chunk: ChunkFrame { id, total_len, data } }，data 直接拷贝到
+  // out 中，不经过 ChunkFrame
+  size_t chunkLen = 1 + CodedOutputStream::VarintSize64(len) + len;
+  if (id)
+    chunkLen += 1 + CodedOutputStream::VarintSize32(id);
+  if (totalLen)
+    chunkLen += 1 + CodedOutputStream::VarintSize64(totalLen);
+  const size_t byteSize =
+      1 + CodedOutputStream::VarintSize64(chunkLen) + chunkLen;
+  if (byteSize + kPbHeaderLen >= static_cast<size_t>(kMaxFrameLen))
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal chunkLen:" + std::to_string(len));
+  out->ensureWritableBytes(kPbHeaderLen + byteSize);
+  char *const start = out->beginWrite();
+  uint8_t *p = reinterpret_cast<uint8_t *>(start + kPbHeaderLen);
+  p = WireFormatLite::WriteTagToArray(
+      RpcMessage::kChunkFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      p);
+  p = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(chunkLen),
+                                              p);
+  if (id)
+    p = WireFormatLite::WriteUInt32ToArray(ChunkFrame::kIdFieldNumber, id, p);
+  if (totalLen)
+    p = WireFormatLite::WriteUInt64ToArray(ChunkFrame::kTotalLenFieldNumber,
+                                           totalLen, p);
+  p = WireFormatLite::WriteTagToArray(ChunkFrame::kDataFieldNumber,
+                                      WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+                                      p);
+  p = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(len), p);
+  memcpy(p, data, len);
+  p += len;
+  assert(reinterpret_cast<char *>(p) == start + kPbHeaderLen + byteSize);
+  writeFramePrefix(start, byteSize, 0);
+  out->hasWritten(kPbHeaderLen + byteSize);
+}
+
+void requestBytesEncode(const Request &header, const std::string &request,
+                        lrpc::util::Buffer *out) {
+  using google::protobuf::io::CodedOutputStream;
+  using google::protobuf::internal::WireFormatLite;
+  assert(header.serialized_request().empty());
+  // RpcMessage { request: Request { header..., serialized_request } }，
+  // 已经序列化的 request 直接拷贝到 out 中
+  const size_t headerLen = header.ByteSizeLong();
+  const size_t reqLen = headerLen + 1 +
+                        CodedOutputStream::VarintSize64(request.size()) +
+                        request.size();
+  const size_t byteSize = 1 + CodedOutputStream::VarintSize64(reqLen) + reqLen;
+  if (byteSize + kPbHeaderLen >= static_cast<size_t>(kMaxFrameLen))
+    throw Exception(ErrorCode::TooLongFrame,
+                    "abnormal bodyLen:" + std::to_string(byteSize));
+  out->ensureWritableBytes(kPbHeaderLen + byteSize);
+  char *const start = out->beginWrite();
+  uint8_t *p = reinterpret_cast<uint8_t *>(start + kPbHeaderLen);
+  p = WireFormatLite::WriteTagToArray(
+      RpcMessage::kRequestFieldNumber,
+      WireFormatLite::WIRETYPE_LENGTH_DELIMITED, p);
+  p = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(reqLen), p);
+  p = header.SerializeWithCachedSizesToArray(p);
+  p = WireFormatLite::WriteBytesToArray(Request::kSerializedRequestFieldNumber,
+                                        request, p);
+  assert(reinterpret_cast<char *>(p) == start + kPbHeaderLen + byteSize);
+  writeFramePrefix(start, byteSize, 0);
+  out->hasWritten(kPbHeaderLen + byteSize);
+}
+
+lrpc::util::Buffer compressedBytesEncode(const RpcMessage &rpcMsg,
+                                         const CompressOptions &options) {
+  if (options.type == CompressType::None ||
+      rpcMsg.ByteSizeLong() < options.threshold)
+    return bytesEncode(rpcMsg);
+
+  std::string raw;
+  if (!rpcMsg.SerializeToString(&raw))
+    throw Exception(ErrorCode::EncodeFail);
+  std::shared_ptr<const std::string> dict;
+  if (options.dictId)
+    dict = findCompressDictionary(options.dictId);
+
+  // 预留长度头、字典 id 和 rawLen 的位置
+  const size_t prefix = kPbHeaderLen + (dict ? 4 : 0) + 4;
+  std::string packed(prefix, '\0');
+  lrpc::util::Buffer bytes;
+  if (!compress(options.type, raw.data(), raw.size(), dict.get(), &packed) ||
+      packed.size() >= raw.size() + kPbHeaderLen ||
+      packed.size() >= static_cast<size_t>(kMaxFrameLen)) {
+    // 压缩失败或者没有收益，按原样发送
+    if (raw.size() + kPbHeaderLen >= static_cast<size_t>(kMaxFrameLen))
+      throw Exception(ErrorCode::TooLongFrame,
+                      "abnormal bodyLen:" + std::to_string(raw.size()));
+    const uint32_t totalLen = static_cast<uint32_t>(kPbHeaderLen + raw.size());
+    bytes.append(&totalLen, sizeof totalLen);
+    bytes.append(raw);
+    return bytes;
+  }
+  uint32_t header = static_cast<uint32_t>(packed.size()) |
+                    (static_cast<uint32_t>(options.type) << kFrameCodecShift);
+  char *p = &packed[0];
+  if (dict) {
+    header |= kFrameDictBit;
+    memcpy(p + kPbHeaderLen, &options.dictId, 4);
+  }
+  memcpy(p, &header, sizeof header);
+  const uint32_t rawLen = static_cast<uint32_t>(raw.size());
+  memcpy(p + prefix - 4, &rawLen, sizeof rawLen);
+  bytes.append(packed);
+  return bytes;
+}
+
 /**
  * @brief Decoder
  *
@@ -151,10 +448,24 @@ void Encoder::clear() {
 }
 
 void Encoder::setMessageEncoder(MessageEncoder encoder) {
+  custom_ = true;
   messageEncoder_ = std::move(encoder);
 }
 void Encoder::setBytesEncoder(BytesEncoder encoder) {
+  custom_ = true;
   bytesEncoder_ = std::move(encoder);
 }
 
+void Encoder::setCompression(const CompressOptions &options) {
+  // 自定义协议的 frame 格式不一定有长度头，不做压缩
+  if (!default_)
+    return;
+  compressed_ = options.type != CompressType::None;
+  if (options.type == CompressType::None)
+    bytesEncoder_ = bytesEncode;
+  else
+    bytesEncoder_ = std::bind(compressedBytesEncode, std::placeholders::_1,
+                              options);
+}
+
 } // namespace lrpc
\ No newline at end of file
@@ -13,6 +13,7 @@
 #define LRPC_CODER_H
 
 #include "Buffer.h"
+#include "Compression.h"
 #include <functional>
 #include <google/protobuf/message.h>
 #include <memory>
@@ -22,6 +23,8 @@
 namespace lrpc {
 
 class RpcMessage;
+class Request;
+class Response;
 
 enum class DecodeState {
   None,
@@ -31,6 +34,8 @@ enum class DecodeState {
 };
 
 extern const int kPbHeaderLen;
+/// @brief 分块传输的消息（序列化之后的 RpcMessage）的长度上限
+extern const size_t kMaxChunkedLen;
 
 /**
  * @brief decode
@@ -58,6 +63,36 @@ bool responseEncode(const google::protobuf::Message *, RpcMessage &);
 /// @brief Frame -> Bytes Encoder
 using BytesEncoder = std::function<lrpc::util::Buffer(const RpcMessage &)>;
 lrpc::util::Buffer bytesEncode(const RpcMessage &);
+/// @brief 把 header 和 response 编码成一个 frame 追加到 out 中，等价于
+/// responseEncode + bytesEncode，但是 response 直接序列化到 out 中，不经过
+/// serialized_response 和临时缓冲区. header 不能设置 serialized_response，
+/// response 为 nullptr 的时候只编码 header. 抛出异常的时候 out 不变.
+/// attachmentSize 不为 0 的时候编码为携带附件的 frame，调用者需要紧接着
+/// 发送 attachmentSize 字节的附件
+void responseBytesEncode(const Response &header,
+                         const google::protobuf::Message *response,
+                         lrpc::util::Buffer *out, size_t attachmentSize = 0);
+/// @brief 同 responseBytesEncode，但是序列化成没有长度头的 RpcMessage，
+/// 用于分块发送，长度不受 frame 长度的限制
+void responseSerialize(const Response &header,
+                       const google::protobuf::Message *response,
+                       std::string *out);
+/// @brief 把分块传输的一个 chunk 编码成一个 frame 追加到 out 中.
+/// totalLen 是完整消息的长度，只在第一个 chunk 中不为 0
+void chunkBytesEncode(uint32_t id, uint64_t totalLen, const char *data,
+                      size_t len, lrpc::util::Buffer *out);
+/// @brief 把 header 和已经序列化的 request 编码成一个 frame 追加到 out 中，
+/// 等价于 requestEncode + bytesEncode. 同一个 request 发送给多个 server 的
+/// 时候只需要序列化一次. header 不能设置 serialized_request
+void requestBytesEncode(const Request &header, const std::string &request,
+                        lrpc::util::Buffer *out);
+/// @brief 同 bytesEncode，attachmentSize 不为 0 的时候编码为携带附件的 frame
+/// （不压缩），调用者需要紧接着发送 attachmentSize 字节的附件
+lrpc::util::Buffer attachedBytesEncode(const RpcMessage &,
+                                       size_t attachmentSize);
+/// @brief 序列化之后超过 options.threshold 的 frame 按照 options 压缩
+lrpc::util::Buffer compressedBytesEncode(const RpcMessage &,
+                                         const CompressOptions &options);
 
 bool hasField(const google::protobuf::Message &msg, const std::string &field);
 
@@ -87,11 +122,20 @@ public:
   void clear();
   void setMessageEncoder(MessageEncoder func);
   void setBytesEncoder(BytesEncoder func);
+  /// @brief 设置 frame 压缩，只对默认的 bytesEncoder 生效
+  void setCompression(const CompressOptions &options);
+  /// @brief 使用默认的编码器并且没有压缩，可以用 responseBytesEncode
+  /// 直接编码到发送缓冲区
+  bool inPlace() const { return framed() && !compressed_; }
+  /// @brief 使用默认的 frame 格式，可以发送附件
+  bool framed() const { return default_ && !custom_; }
   MessageEncoder messageEncoder_;
   BytesEncoder bytesEncoder_;
 
 private:
   bool default_;
+  bool compressed_{false};
+  bool custom_{false}; // 设置了自定义的 messageEncoder 或者 bytesEncoder
 };
 
 } // namespace lrpc
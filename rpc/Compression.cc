@@ -0,0 +1,285 @@
+#include "Compression.h"
+#include "Logging.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <zlib.h>
+#ifdef LRPC_HAVE_LZ4
+#include <lz4.h>
+#endif
+#ifdef LRPC_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace lrpc {
+
+const uint32_t kFrameLenMask = (1u << 28) - 1;
+const int kFrameCodecShift = 28;
+const uint32_t kFrameCodecMask = 3u << kFrameCodecShift;
+const uint32_t kFrameDictBit = 1u << 30;
+const uint32_t kFrameAttachBit = 1u << 31;
+
+namespace {
+
+std::atomic<size_t> g_maxDecompressedSize{256 * 1024 * 1024};
+std::mutex g_dictMutex;
+std::unordered_map<uint32_t, std::shared_ptr<const std::string>> g_dicts;
+
+bool zlibCompress(const char *data, size_t len, const std::string *dict,
+                  std::string *out) {
+  z_stream zs{};
+  if (deflateInit(&zs, Z_DEFAULT_COMPRESSION) != Z_OK)
+    return false;
+  if (dict && deflateSetDictionary(&zs, (const Bytef *)dict->data(),
+                                   static_cast<uInt>(dict->size())) != Z_OK) {
+    deflateEnd(&zs);
+    return false;
+  }
+  const size_t offset = out->size();
+  out->resize(offset + deflateBound(&zs, static_cast<uLong>(len)));
+  zs.next_in = (Bytef *)data;
+  zs.avail_in = static_cast<uInt>(len);
+  zs.next_out = (Bytef *)&(*out)[offset];
+  zs.avail_out = static_cast<uInt>(out->size() - offset);
+  const int ret = deflate(&zs, Z_FINISH);
+  out->resize(offset + zs.total_out);
+  deflateEnd(&zs);
+  return ret == Z_STREAM_END;
+}
+
+/// @brief 缓冲区按照实际解压出来的数据逐步扩大，rawLen 只是上限，
+/// 声明了很大的 rawLen 但是数据很少的 frame 不会占用 rawLen 的内存
+bool zlibDecompress(const char *data, size_t len, size_t rawLen,
+                    const std::string *dict, std::string *out) {
+  z_stream zs{};
+  if (inflateInit(&zs) != Z_OK)
+    return false;
+  out->resize(std::min(rawLen, std::max<size_t>(len * 4, 64 * 1024)));
+  zs.next_in = (Bytef *)data;
+  zs.avail_in = static_cast<uInt>(len);
+  int ret;
+  for (;;) {
+    zs.next_out = (Bytef *)&(*out)[zs.total_out];
+    zs.avail_out = static_cast<uInt>(out->size() - zs.total_out);
+    ret = inflate(&zs, Z_NO_FLUSH);
+    if (ret == Z_NEED_DICT) {
+      // 压缩端使用了字典，设置字典之后继续解压
+      if (!dict || inflateSetDictionary(&zs, (const Bytef *)dict->data(),
+                                        static_cast<uInt>(dict->size())) !=
+                       Z_OK)
+        break;
+      continue;
+    }
+    // 输出缓冲区没有用完说明输入已经耗尽，数据被截断
+    if ((ret != Z_OK && ret != Z_BUF_ERROR) || zs.avail_out > 0 ||
+        out->size() >= rawLen)
+      break;
+    out->resize(std::min(rawLen, out->size() * 2));
+  }
+  const bool ok = ret == Z_STREAM_END && zs.total_out == rawLen;
+  inflateEnd(&zs);
+  return ok;
+}
+
+#ifdef LRPC_HAVE_LZ4
+bool lz4Compress(const char *data, size_t len, const std::string *dict,
+                 std::string *out) {
+  const int bound = LZ4_compressBound(static_cast<int>(len));
+  const size_t offset = out->size();
+  out->resize(offset + bound);
+  int n;
+  if (dict) {
+    LZ4_stream_t stream;
+    LZ4_initStream(&stream, sizeof stream);
+    LZ4_loadDict(&stream, dict->data(), static_cast<int>(dict->size()));
+    n = LZ4_compress_fast_continue(&stream, data, &(*out)[offset],
+                                   static_cast<int>(len), bound, 1);
+  } else {
+    n = LZ4_compress_default(data, &(*out)[offset], static_cast<int>(len),
+                             bound);
+  }
+  out->resize(offset + (n > 0 ? n : 0));
+  return n > 0;
+}
+
+bool lz4Decompress(const char *data, size_t len, size_t rawLen,
+                   const std::string *dict, std::string *out) {
+  out->resize(rawLen);
+  int n;
+  if (dict)
+    n = LZ4_decompress_safe_usingDict(data, &(*out)[0], static_cast<int>(len),
+                                      static_cast<int>(rawLen), dict->data(),
+                                      static_cast<int>(dict->size()));
+  else
+    n = LZ4_decompress_safe(data, &(*out)[0], static_cast<int>(len),
+                            static_cast<int>(rawLen));
+  return n >= 0 && static_cast<size_t>(n) == rawLen;
+}
+#endif
+
+#ifdef LRPC_HAVE_ZSTD
+bool zstdCompress(const char *data, size_t len, const std::string *dict,
+                  std::string *out) {
+  // 每个线程复用一个 context，避免每次压缩都分配内存
+  thread_local std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx *)> cctx(
+      ZSTD_createCCtx(), ZSTD_freeCCtx);
+  const size_t offset = out->size();
+  out->resize(offset + ZSTD_compressBound(len));
+  size_t n;
+  if (dict)
+    n = ZSTD_compress_usingDict(cctx.get(), &(*out)[offset],
+                                out->size() - offset, data, len, dict->data(),
+                                dict->size(), 1);
+  else
+    n = ZSTD_compressCCtx(cctx.get(), &(*out)[offset], out->size() - offset,
+                          data, len, 1);
+  if (ZSTD_isError(n)) {
+    out->resize(offset);
+    return false;
+  }
+  out->resize(offset + n);
+  return true;
+}
+
+bool zstdDecompress(const char *data, size_t len, size_t rawLen,
+                    const std::string *dict, std::string *out) {
+  thread_local std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx *)> dctx(
+      ZSTD_createDCtx(), ZSTD_freeDCtx);
+  out->resize(rawLen);
+  size_t n;
+  if (dict)
+    n = ZSTD_decompress_usingDict(dctx.get(), &(*out)[0], rawLen, data, len,
+                                  dict->data(), dict->size());
+  else
+    n = ZSTD_decompressDCtx(dctx.get(), &(*out)[0], rawLen, data, len);
+  return !ZSTD_isError(n) && n == rawLen;
+}
+#endif
+
+} // namespace
+
+uint32_t supportedCompressMask() {
+  uint32_t mask = 1u << static_cast<int>(CompressType::Zlib);
+#ifdef LRPC_HAVE_LZ4
+  mask |= 1u << static_cast<int>(CompressType::Lz4);
+#endif
+#ifdef LRPC_HAVE_ZSTD
+  mask |= 1u << static_cast<int>(CompressType::Zstd);
+#endif
+  return mask;
+}
+
+bool isCompressSupported(CompressType type) {
+  return type != CompressType::None &&
+         (supportedCompressMask() & (1u << static_cast<int>(type)));
+}
+
+uint32_t addCompressDictionary(std::string dict) {
+  // 字典 id 是字典内容的 adler32，两端注册相同的字典得到相同的 id
+  uint32_t id = adler32(adler32(0L, Z_NULL, 0), (const Bytef *)dict.data(),
+                        static_cast<uInt>(dict.size()));
+  if (id == 0)
+    id = 1;
+  std::lock_guard<std::mutex> lk(g_dictMutex);
+  g_dicts[id] = std::make_shared<const std::string>(std::move(dict));
+  return id;
+}
+
+std::shared_ptr<const std::string> findCompressDictionary(uint32_t dictId) {
+  std::lock_guard<std::mutex> lk(g_dictMutex);
+  auto it = g_dicts.find(dictId);
+  return it == g_dicts.end() ? nullptr : it->second;
+}
+
+CompressOptions makeCompressOptions(CompressType type, size_t threshold,
+                                    const std::string &dictionary) {
+  CompressOptions options;
+  if (type != CompressType::None && !isCompressSupported(type)) {
+    LOG_WARN << "compress type " << static_cast<int>(type)
+             << " is not supported by this build, disable compression";
+    return options;
+  }
+  options.type = type;
+  options.threshold = threshold;
+  if (!dictionary.empty())
+    options.dictId = addCompressDictionary(dictionary);
+  return options;
+}
+
+CompressOptions negotiateCompress(const CompressOptions &local,
+                                  uint32_t peerMask, uint32_t peerDict) {
+  CompressOptions res = local;
+  if (!isCompressSupported(local.type) ||
+      !(peerMask & (1u << static_cast<int>(local.type))))
+    res.type = CompressType::None;
+  if (local.dictId != peerDict)
+    res.dictId = 0;
+  return res;
+}
+
+bool compress(CompressType type, const char *data, size_t len,
+              const std::string *dict, std::string *out) {
+  switch (type) {
+  case CompressType::Zlib:
+    return zlibCompress(data, len, dict, out);
+#ifdef LRPC_HAVE_LZ4
+  case CompressType::Lz4:
+    return lz4Compress(data, len, dict, out);
+#endif
+#ifdef LRPC_HAVE_ZSTD
+  case CompressType::Zstd:
+    return zstdCompress(data, len, dict, out);
+#endif
+  default:
+    LOG_ERROR << "unsupported compress type " << static_cast<int>(type);
+    return false;
+  }
+}
+
+void setMaxDecompressedSize(size_t bytes) { g_maxDecompressedSize = bytes; }
+
+size_t maxDecompressedSize() { return g_maxDecompressedSize; }
+
+/// @brief deflate 的最大压缩比约为 1032:1，lz4 约为 255:1. zstd 的 RLE block
+/// 用 4 个字节表示 128KB，按照 32768:1 计算. 另外留出一些固定开销
+size_t decompressBound(CompressType type, size_t len) {
+  size_t ratio;
+  switch (type) {
+  case CompressType::Zlib:
+    ratio = 1032;
+    break;
+  case CompressType::Lz4:
+    ratio = 255;
+    break;
+  case CompressType::Zstd:
+    ratio = 32768;
+    break;
+  default:
+    return 0;
+  }
+  return len * ratio + 64;
+}
+
+bool decompress(CompressType type, const char *data, size_t len, size_t rawLen,
+                const std::string *dict, std::string *out) {
+  if (rawLen > maxDecompressedSize() || rawLen > decompressBound(type, len))
+    return false;
+  switch (type) {
+  case CompressType::Zlib:
+    return zlibDecompress(data, len, rawLen, dict, out);
+#ifdef LRPC_HAVE_LZ4
+  case CompressType::Lz4:
+    return lz4Decompress(data, len, rawLen, dict, out);
+#endif
+#ifdef LRPC_HAVE_ZSTD
+  case CompressType::Zstd:
+    return zstdDecompress(data, len, rawLen, dict, out);
+#endif
+  default:
+    LOG_ERROR << "unsupported decompress type " << static_cast<int>(type);
+    return false;
+  }
+}
+
+} // namespace lrpc
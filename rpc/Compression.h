@@ -0,0 +1,89 @@
+/**
+ * @file Compression.h
+ * @brief frame 级别的 payload 压缩
+ *
+ * 压缩的 frame 在长度头的高位记录压缩算法，格式如下:
+ * +----------------------------+-----------------+-----------+-------------+
+ * | totalLen | codec | dictBit | dictId (可选)    | rawLen    | compressed  |
+ * | 4 bytes                    | 4 bytes         | 4 bytes   |             |
+ * +----------------------------+-----------------+-----------+-------------+
+ * totalLen 占低 28 位，codec 占 28~29 位，dictBit 是第 30 位.
+ * 只有对端在 Request/Response 的 accept_compress 中声明支持的算法才会被使用.
+ *
+ * 第 31 位表示 frame 携带附件，这样的 frame 不压缩:
+ * +--------------------+-----------+----------+------------+
+ * | totalLen | attach  | attachLen | protobuf | attachment |
+ * | 4 bytes            | 4 bytes   |          | attachLen  |
+ * +--------------------+-----------+----------+------------+
+ */
+
+#ifndef LRPC_COMPRESSION_H
+#define LRPC_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace lrpc {
+
+enum class CompressType : uint8_t {
+  None = 0,
+  Zlib = 1,
+  Lz4 = 2,  ///< 需要定义 LRPC_HAVE_LZ4 并链接 -llz4
+  Zstd = 3, ///< 需要定义 LRPC_HAVE_ZSTD 并链接 -lzstd
+};
+
+/// @brief frame 长度头中的位划分
+extern const uint32_t kFrameLenMask;
+extern const int kFrameCodecShift;
+extern const uint32_t kFrameCodecMask;
+extern const uint32_t kFrameDictBit;
+extern const uint32_t kFrameAttachBit;
+
+/// @brief 发送端的压缩配置，Service / ClientStub 各自持有一份
+struct CompressOptions {
+  CompressType type{CompressType::None};
+  size_t threshold{1024}; // RpcMessage 序列化之后超过这个大小才压缩
+  uint32_t dictId{0};     // 预训练字典的 id，0 表示不使用字典
+};
+
+/// @brief 当前编译版本支持的算法，按 1 << CompressType 组成的位图
+uint32_t supportedCompressMask();
+bool isCompressSupported(CompressType type);
+
+/// @brief 注册一个预训练字典，返回字典 id，通信两端必须注册相同的字典.
+/// 只能在 RpcServer 启动之前调用
+uint32_t addCompressDictionary(std::string dict);
+/// @brief 根据 id 查找字典，没有找到的时候返回 nullptr
+std::shared_ptr<const std::string> findCompressDictionary(uint32_t dictId);
+
+/// @brief Service / ClientStub::setCompression 使用，当前编译版本不支持 type
+/// 的时候返回不压缩的配置. dictionary 非空的时候会被注册为字典
+CompressOptions makeCompressOptions(CompressType type, size_t threshold,
+                                    const std::string &dictionary);
+
+/// @brief 根据对端声明的算法位图和字典 id 得到实际使用的压缩配置.
+/// 对端不支持 local.type 的时候不压缩，字典 id 不一致的时候不使用字典
+CompressOptions negotiateCompress(const CompressOptions &local,
+                                  uint32_t peerMask, uint32_t peerDict);
+
+/// @brief 压缩 [data, data + len) 追加到 out，失败的时候返回 false
+bool compress(CompressType type, const char *data, size_t len,
+              const std::string *dict, std::string *out);
+/// @brief 解压之后允许的最大长度，默认 256MB. 对端声明的 rawLen 超过这个值
+/// 的 frame 直接解码失败，不分配内存. 只能在 RpcServer 启动之前调用
+void setMaxDecompressedSize(size_t bytes);
+size_t maxDecompressedSize();
+/// @brief len 字节的 type 压缩数据解压之后可能的最大长度（算法的最大压缩比）.
+/// 对端声明的 rawLen 超过这个值说明 frame 是伪造的
+size_t decompressBound(CompressType type, size_t len);
+
+/// @brief 解压 [data, data + len) 到 out，rawLen 是对端声明的压缩之前的长度.
+/// rawLen 超过 maxDecompressedSize 或者 decompressBound 的时候直接返回 false
+bool decompress(CompressType type, const char *data, size_t len, size_t rawLen,
+                const std::string *dict, std::string *out);
+
+} // namespace lrpc
+
+#endif
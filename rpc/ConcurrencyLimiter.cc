@@ -0,0 +1,132 @@
+#include "ConcurrencyLimiter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace lrpc {
+
+// Vegas 每隔多少个窗口重新测量最小延迟
+static const int kVegasProbeWindows = 100;
+
+/// -------------- ConcurrencyLimiter --------------
+
+/// @brief priority 可以使用的名额
+static int priorityLimit(int limit, Priority priority) {
+  switch (priority) {
+  case PRIORITY_CRITICAL:
+    return limit + std::max(1, limit / 4);
+  case PRIORITY_BATCH:
+    return std::max(1, limit / 2);
+  default:
+    return limit;
+  }
+}
+
+bool ConcurrencyLimiter::tryAcquire(Priority priority) {
+  if (priority == PRIORITY_CONTROL) {
+    // 控制流量不会被拒绝，但是仍然计入正在执行的请求数
+    inflight_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  int cur = inflight_.load(std::memory_order_relaxed);
+  do {
+    if (cur >= priorityLimit(limit(), priority))
+      return false;
+  } while (!inflight_.compare_exchange_weak(cur, cur + 1,
+                                            std::memory_order_relaxed));
+  return true;
+}
+
+void ConcurrencyLimiter::onComplete(std::chrono::microseconds latency) {
+  const int inflight = inflight_.fetch_sub(1, std::memory_order_relaxed);
+  _onSample(latency, inflight);
+}
+
+void ConcurrencyLimiter::onDropped() {
+  inflight_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::unique_ptr<ConcurrencyLimiter>
+makeConcurrencyLimiter(const ConcurrencyLimitOptions &options) {
+  switch (options.type) {
+  case ConcurrencyLimitType::Static:
+    return std::unique_ptr<ConcurrencyLimiter>(
+        new StaticLimiter(options.maxInflight));
+  case ConcurrencyLimitType::Gradient:
+    return std::unique_ptr<ConcurrencyLimiter>(new GradientLimiter(options));
+  case ConcurrencyLimitType::Vegas:
+    return std::unique_ptr<ConcurrencyLimiter>(new VegasLimiter(options));
+  case ConcurrencyLimitType::None:
+  default:
+    return nullptr;
+  }
+}
+
+/// -------------- GradientLimiter --------------
+
+GradientLimiter::GradientLimiter(const ConcurrencyLimitOptions &options)
+    : ConcurrencyLimiter(options.initialLimit), options_(options),
+      estimate_(options.initialLimit) {}
+
+void GradientLimiter::_onSample(std::chrono::microseconds latency,
+                                int inflight) {
+  std::lock_guard<std::mutex> lk(mutex_);
+  windowSum_ += static_cast<double>(latency.count());
+  windowMaxInflight_ = std::max(windowMaxInflight_, inflight);
+  if (++windowCount_ < options_.windowSamples)
+    return;
+  const double shortRtt = std::max(windowSum_ / windowCount_, 1.0);
+  const int maxInflight = windowMaxInflight_;
+  windowSum_ = 0;
+  windowCount_ = 0;
+  windowMaxInflight_ = 0;
+
+  // 长期延迟是短期延迟的 EWMA，短期延迟持续偏低的时候长期延迟也跟着下降
+  longRtt_ = longRtt_ <= 0 ? shortRtt : longRtt_ * 0.95 + shortRtt * 0.05;
+  if (longRtt_ > shortRtt * 2)
+    longRtt_ = shortRtt * 2;
+  // 请求数没有接近 limit 的时候延迟不能反映容量，不增大 limit
+  if (maxInflight * 2 < estimate_ && longRtt_ <= shortRtt)
+    return;
+  const double gradient = std::max(0.5, std::min(1.0, longRtt_ / shortRtt));
+  const double newLimit = estimate_ * gradient + std::sqrt(estimate_);
+  estimate_ = estimate_ * 0.8 + newLimit * 0.2;
+  estimate_ = std::max<double>(options_.minLimit,
+                               std::min<double>(options_.maxInflight, estimate_));
+  limit_.store(static_cast<int>(estimate_), std::memory_order_relaxed);
+}
+
+/// -------------- VegasLimiter --------------
+
+VegasLimiter::VegasLimiter(const ConcurrencyLimitOptions &options)
+    : ConcurrencyLimiter(options.initialLimit), options_(options) {}
+
+void VegasLimiter::_onSample(std::chrono::microseconds latency, int inflight) {
+  const double rtt = std::max(static_cast<double>(latency.count()), 1.0);
+  std::lock_guard<std::mutex> lk(mutex_);
+  windowMin_ = windowCount_ == 0 ? rtt : std::min(windowMin_, rtt);
+  windowMaxInflight_ = std::max(windowMaxInflight_, inflight);
+  if (++windowCount_ < options_.windowSamples)
+    return;
+  const double windowRtt = windowMin_;
+  const int maxInflight = windowMaxInflight_;
+  windowCount_ = 0;
+  windowMaxInflight_ = 0;
+  if (minRtt_ <= 0 || windowRtt < minRtt_ || ++windows_ >= kVegasProbeWindows) {
+    minRtt_ = windowRtt;
+    windows_ = 0;
+  }
+
+  int limit = this->limit();
+  const double log = std::max(1.0, std::log10(static_cast<double>(limit)));
+  const double queue = limit * (1 - minRtt_ / windowRtt);
+  if (queue >= 6 * log) {
+    limit = static_cast<int>(limit - log);
+  } else if (queue <= 3 * log && maxInflight * 2 >= limit) {
+    // 只有请求数接近 limit 的时候才增大
+    limit = static_cast<int>(limit + log);
+  }
+  limit = std::max(options_.minLimit, std::min(options_.maxInflight, limit));
+  limit_.store(limit, std::memory_order_relaxed);
+}
+
+} // namespace lrpc
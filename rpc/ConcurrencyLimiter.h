@@ -0,0 +1,124 @@
+/**
+ * @file ConcurrencyLimiter.h
+ * @brief 服务端的并发限制
+ *
+ * Service 正在执行的请求数达到 limit() 之后，新的请求在解码 payload 之前
+ * 就以 Overloaded 错误拒绝，避免过载的时候请求在 outputBuffer 中无限排队.
+ * limit 可以是固定的，也可以根据 handler 的延迟自适应调整:
+ * 1. Gradient: 比较短期和长期的平均延迟，延迟上升的时候按比例减小 limit
+ * 2. Vegas: 根据最小延迟估计排队的请求数，排队过多的时候减小 limit
+ *
+ * 不同优先级的请求可以使用的名额不同，过载的时候先拒绝低优先级的请求:
+ * CONTROL 不受限制，CRITICAL 可以超出 limit 的 1/4，BATCH 只能使用一半.
+ *
+ * 所有成员函数都是线程安全的，同一个 Service 的所有 loop 共享一个 limiter
+ */
+
+#ifndef LRPC_CONCURRENCYLIMITER_H
+#define LRPC_CONCURRENCYLIMITER_H
+
+#include "lrpc.pb.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace lrpc {
+
+enum class ConcurrencyLimitType {
+  None,     ///< 不限制（默认）
+  Static,   ///< 固定的 maxInflight
+  Gradient, ///< 根据延迟梯度自适应
+  Vegas,    ///< 根据估计的排队长度自适应
+};
+
+struct ConcurrencyLimitOptions {
+  ConcurrencyLimitType type{ConcurrencyLimitType::None};
+  /// @brief Static 的限制，也是自适应算法的上限
+  int maxInflight{1000};
+  /// @brief 自适应算法的初始值和下限
+  int initialLimit{20};
+  int minLimit{4};
+  /// @brief 自适应算法每收集 windowSamples 个延迟样本调整一次 limit
+  int windowSamples{50};
+};
+
+class ConcurrencyLimiter {
+public:
+  virtual ~ConcurrencyLimiter() = default;
+
+  /// @brief 占用一个名额，正在执行的请求数达到 priority 可以使用的限制的
+  /// 时候返回 false
+  bool tryAcquire(Priority priority = PRIORITY_DEFAULT);
+  /// @brief 请求执行完成，latency 为 handler 的执行时间
+  void onComplete(std::chrono::microseconds latency);
+  /// @brief 占用了名额的请求没有执行（过期或者出错）
+  void onDropped();
+
+  int inflight() const { return inflight_.load(std::memory_order_relaxed); }
+  int limit() const { return limit_.load(std::memory_order_relaxed); }
+
+protected:
+  explicit ConcurrencyLimiter(int limit) : limit_(limit) {}
+
+  /// @brief 收到一个延迟样本，inflight 为请求完成时正在执行的请求数
+  virtual void _onSample(std::chrono::microseconds latency, int inflight) = 0;
+
+  std::atomic<int> limit_;
+
+private:
+  std::atomic<int> inflight_{0};
+};
+
+class StaticLimiter : public ConcurrencyLimiter {
+public:
+  explicit StaticLimiter(int maxInflight) : ConcurrencyLimiter(maxInflight) {}
+
+protected:
+  void _onSample(std::chrono::microseconds, int) override {}
+};
+
+/// @brief Gradient2: gradient = longRtt / shortRtt (限制在 [0.5, 1])，
+/// newLimit = limit * gradient + sqrt(limit)
+class GradientLimiter : public ConcurrencyLimiter {
+public:
+  explicit GradientLimiter(const ConcurrencyLimitOptions &options);
+
+protected:
+  void _onSample(std::chrono::microseconds latency, int inflight) override;
+
+private:
+  const ConcurrencyLimitOptions options_;
+  std::mutex mutex_;
+  double estimate_; // 浮点数的 limit，平滑之后取整
+  double longRtt_{0};
+  double windowSum_{0};
+  int windowCount_{0};
+  int windowMaxInflight_{0};
+};
+
+/// @brief queue = limit * (1 - minRtt / rtt)，queue 小于 alpha 的时候增大
+/// limit，超过 beta 的时候减小
+class VegasLimiter : public ConcurrencyLimiter {
+public:
+  explicit VegasLimiter(const ConcurrencyLimitOptions &options);
+
+protected:
+  void _onSample(std::chrono::microseconds latency, int inflight) override;
+
+private:
+  const ConcurrencyLimitOptions options_;
+  std::mutex mutex_;
+  double minRtt_{0}; // 没有排队时的延迟估计
+  double windowMin_{0};
+  int windowCount_{0};
+  int windowMaxInflight_{0};
+  int windows_{0}; // 定期重置 minRtt_，适应 handler 本身的延迟变化
+};
+
+std::unique_ptr<ConcurrencyLimiter>
+makeConcurrencyLimiter(const ConcurrencyLimitOptions &options);
+
+} // namespace lrpc
+
+#endif
@@ -0,0 +1,70 @@
+#include "DeadlineQueue.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcChannel.h"
+#include <algorithm>
+
+namespace lrpc {
+
+// 堆的大小超过这个值之后才会考虑整理
+static const size_t kCompactThreshold = 1024;
+
+DeadlineQueue::DeadlineQueue(EventLoop *loop) : loop_(loop) {}
+
+DeadlineQueue::~DeadlineQueue() = default;
+
+void DeadlineQueue::add(Timestamp deadline,
+                        const std::weak_ptr<ClientChannel> &chan, int id) {
+  loop_->assertInLoopThread();
+  heap_.push_back(Entry{deadline, chan, id});
+  std::push_heap(heap_.begin(), heap_.end(), Later());
+  // 只有新的 deadline 早于当前定时器的时候才需要重新设置定时器
+  if (timer_.empty() || deadline < armedAt_)
+    _arm();
+}
+
+void DeadlineQueue::cancelled(size_t n) {
+  stale_ += n;
+  if (heap_.size() > kCompactThreshold && stale_ * 2 > heap_.size())
+    _compact();
+}
+
+/// @brief 弹出所有到期的请求，通知对应的 ClientChannel
+void DeadlineQueue::_onTimer() {
+  timer_.reset(); // 定时器已经触发，不需要再 cancel
+  const Timestamp now = Timestamp::now();
+  while (!heap_.empty() && !(now < heap_.front().deadline)) {
+    std::pop_heap(heap_.begin(), heap_.end(), Later());
+    Entry entry = std::move(heap_.back());
+    heap_.pop_back();
+    auto chan = entry.chan.lock();
+    if (chan && chan->pendingCalls_.contains(entry.id))
+      chan->_onDeadline(entry.id);
+    else if (stale_ > 0)
+      --stale_;
+  }
+  if (!heap_.empty())
+    _arm();
+}
+
+void DeadlineQueue::_arm() {
+  if (!timer_.empty())
+    loop_->cancel(timer_);
+  armedAt_ = heap_.front().deadline;
+  timer_ = loop_->runAt(armedAt_, std::bind(&DeadlineQueue::_onTimer, this));
+}
+
+/// @brief 删除堆中已经失效的元素：请求已经完成或者 channel 已经销毁
+void DeadlineQueue::_compact() {
+  auto last = std::remove_if(heap_.begin(), heap_.end(), [](const Entry &e) {
+    auto chan = e.chan.lock();
+    return !chan || !chan->pendingCalls_.contains(e.id);
+  });
+  LOG_DEBUG << "DeadlineQueue compact " << heap_.size() << " -> "
+            << (last - heap_.begin());
+  heap_.erase(last, heap_.end());
+  std::make_heap(heap_.begin(), heap_.end(), Later());
+  stale_ = 0;
+}
+
+} // namespace lrpc
@@ -0,0 +1,70 @@
+#ifndef LRPC_DEADLINEQUEUE_H
+#define LRPC_DEADLINEQUEUE_H
+
+#include "TimerId.h"
+#include "Timestamp.h"
+#include <memory>
+#include <vector>
+
+namespace lrpc {
+
+namespace net {
+class EventLoop;
+}
+
+class ClientChannel;
+
+using lrpc::net::EventLoop;
+using lrpc::net::TimerId;
+using lrpc::util::Timestamp;
+
+/**
+ * @brief 每个 EventLoop 一个 DeadlineQueue，负责 loop 上所有 ClientChannel
+ * 的请求超时. 内部是按照 deadline 排序的小顶堆，只占用一个 loop 定时器，
+ * 定时器总是设置为堆顶的 deadline.
+ * 请求正常返回的时候不从堆中删除（惰性删除），只记录失效的数量，
+ * 失效的元素超过一半的时候整理一次堆
+ *
+ * 只能在所属的 loop 线程中使用
+ */
+class DeadlineQueue {
+public:
+  explicit DeadlineQueue(EventLoop *loop);
+  ~DeadlineQueue();
+  DeadlineQueue(const DeadlineQueue &) = delete;
+  DeadlineQueue &operator=(const DeadlineQueue &) = delete;
+
+  /// @brief 添加 channel 上 id 请求的超时时间
+  void add(Timestamp deadline, const std::weak_ptr<ClientChannel> &chan,
+           int id);
+  /// @brief 有 n 个请求在超时之前完成了，它们在堆中的元素已经失效
+  void cancelled(size_t n = 1);
+
+  size_t size() const { return heap_.size(); }
+
+private:
+  struct Entry {
+    Timestamp deadline;
+    std::weak_ptr<ClientChannel> chan;
+    int id;
+  };
+  struct Later {
+    bool operator()(const Entry &lhs, const Entry &rhs) const {
+      return rhs.deadline < lhs.deadline;
+    }
+  };
+
+  void _onTimer();
+  void _arm();
+  void _compact();
+
+  EventLoop *loop_;
+  std::vector<Entry> heap_;
+  size_t stale_{0};    // 堆中已经失效的元素数量（估计值）
+  TimerId timer_;      // 当前设置的 loop 定时器
+  Timestamp armedAt_;  // 定时器触发的时间
+};
+
+} // namespace lrpc
+
+#endif
@@ -0,0 +1,53 @@
+#include "DispatchQueue.h"
+#include "EventLoop.h"
+#include "TcpConnection.h"
+
+namespace lrpc {
+
+DispatchQueue::DispatchQueue(EventLoop *loop,
+                             std::chrono::microseconds timeBudget)
+    : loop_(loop), timeBudget_(timeBudget) {}
+
+void DispatchQueue::push(const TcpConnectionPtr &conn, Resume resume) {
+  loop_->assertInLoopThread();
+  ready_.push_back(Entry{conn, std::move(resume)});
+  _schedule();
+}
+
+void DispatchQueue::_schedule() {
+  if (scheduled_)
+    return;
+  scheduled_ = true;
+  loop_->queueInLoop([this] { _run(); });
+}
+
+bool DispatchQueue::_overBudget() const {
+  const auto elapsed =
+      lrpc::util::Timestamp::now().microSecondsSinceEpoch() -
+      loop_->pollReturnTime().microSecondsSinceEpoch();
+  return elapsed >= timeBudget_.count();
+}
+
+void DispatchQueue::_run() {
+  scheduled_ = false;
+  // 只处理这一轮开始的时候已经在队列中的连接，重新入队的连接排到下一轮.
+  // 每一轮至少处理一个连接，保证 IO 事件本身超过预算的时候也能前进
+  size_t n = ready_.size();
+  bool first = true;
+  while (n-- > 0 && !ready_.empty()) {
+    if (!first && _overBudget())
+      break;
+    first = false;
+    Entry entry = std::move(ready_.front());
+    ready_.pop_front();
+    auto conn = entry.conn.lock();
+    if (conn && entry.resume(conn))
+      ready_.push_back(std::move(entry));
+  }
+  // 在 pending functor 中调用 queueInLoop 会唤醒 loop，下一轮迭代先处理
+  // 定时器和 IO 事件
+  if (!ready_.empty())
+    _schedule();
+}
+
+} // namespace lrpc
@@ -0,0 +1,68 @@
+#ifndef LRPC_DISPATCHQUEUE_H
+#define LRPC_DISPATCHQUEUE_H
+
+#include "Callback.h"
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+
+namespace lrpc {
+
+namespace net {
+class EventLoop;
+}
+
+using lrpc::net::EventLoop;
+using lrpc::net::TcpConnection;
+using lrpc::net::TcpConnectionPtr;
+
+/// @brief 每个连接每次最多解码分发的 frame 数和字节数
+struct DispatchBudget {
+  size_t frames{64};
+  size_t bytes{1024 * 1024};
+};
+
+/**
+ * @brief 每个 EventLoop 一个 DispatchQueue，在连接之间公平地分发 frame.
+ * Service::_onMessage 每次只分发一个连接的一份 DispatchBudget，缓冲区中
+ * 剩下的 frame 留到之后处理，连接进入 ready 队列. 队列在 loop 的 pending
+ * functor 中按照 round-robin 处理，每个连接每次同样只处理一份预算.
+ * loop 的一轮迭代（从 poll 返回开始计算）超过 timeBudget 之后停止处理，
+ * 让 loop 先处理定时器和其他连接的 IO 事件，下一轮迭代再继续
+ *
+ * 只能在所属的 loop 线程中使用
+ */
+class DispatchQueue {
+public:
+  /// @brief 分发一份预算，返回 true 表示缓冲区中可能还有没有分发的 frame
+  using Resume = std::function<bool(const TcpConnectionPtr &)>;
+
+  DispatchQueue(EventLoop *loop, std::chrono::microseconds timeBudget);
+  DispatchQueue(const DispatchQueue &) = delete;
+  DispatchQueue &operator=(const DispatchQueue &) = delete;
+
+  /// @brief conn 进入 ready 队列，轮到它的时候调用 resume
+  void push(const TcpConnectionPtr &conn, Resume resume);
+  size_t size() const { return ready_.size(); }
+
+private:
+  struct Entry {
+    std::weak_ptr<TcpConnection> conn;
+    Resume resume;
+  };
+
+  void _run();
+  void _schedule();
+  // 当前迭代是否已经用完了时间预算
+  bool _overBudget() const;
+
+  EventLoop *const loop_;
+  const std::chrono::microseconds timeBudget_;
+  std::deque<Entry> ready_;
+  bool scheduled_{false};
+};
+
+} // namespace lrpc
+
+#endif
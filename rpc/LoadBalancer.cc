@@ -0,0 +1,398 @@
+#include "LoadBalancer.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace lrpc {
+
+// peak-EWMA 的衰减时间常数（秒）
+static const double kEwmaDecaySeconds = 10.0;
+
+/// -------------- EndpointStats --------------
+
+EndpointStats::EndpointStats(const Endpoint &ep,
+                             const CircuitBreakerOptions &options,
+                             std::atomic<int> *ejected,
+                             std::atomic<uint64_t> *transitions)
+    : firstSeen_(Timestamp::now()),
+      breaker_(ep.ip() + ":" + std::to_string(ep.port()), options, ejected,
+               transitions) {}
+
+void EndpointStats::onSend() {
+  outstanding_.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// @brief 延迟大于当前值的时候立即取峰值，否则按照时间间隔指数衰减
+void EndpointStats::onComplete(std::chrono::microseconds latency, bool ok) {
+  outstanding_.fetch_sub(1, std::memory_order_relaxed);
+  const double rtt = static_cast<double>(latency.count());
+  const Timestamp now = Timestamp::now();
+  breaker_.onResult(ok, now);
+  std::lock_guard<std::mutex> lk(mutex_);
+  if (ewma_ <= 0 || rtt > ewma_) {
+    ewma_ = rtt;
+  } else {
+    const double w =
+        std::exp(-timeDifference(now, lastSample_) / kEwmaDecaySeconds);
+    ewma_ = ewma_ * w + rtt * (1 - w);
+  }
+  lastSample_ = now;
+  if (samples_.size() < kLatencySamples)
+    samples_.push_back(latency.count());
+  else
+    samples_[nextSample_] = latency.count();
+  nextSample_ = (nextSample_ + 1) % kLatencySamples;
+}
+
+void EndpointStats::onAbandoned(int n) {
+  outstanding_.fetch_sub(n, std::memory_order_relaxed);
+  if (n > 0)
+    breaker_.onResult(false, Timestamp::now());
+}
+
+void EndpointStats::onConnectFailed() {
+  breaker_.onResult(false, Timestamp::now());
+}
+
+double EndpointStats::ewmaLatency() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return ewma_;
+}
+
+std::chrono::microseconds EndpointStats::latencyPercentile(double q) const {
+  std::vector<int64_t> samples;
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    samples = samples_;
+  }
+  if (samples.empty())
+    return std::chrono::microseconds(0);
+  q = std::min(std::max(q, 0.0), 1.0);
+  auto nth = samples.begin() +
+             static_cast<size_t>(q * static_cast<double>(samples.size() - 1));
+  std::nth_element(samples.begin(), nth, samples.end());
+  return std::chrono::microseconds(*nth);
+}
+
+std::shared_ptr<EndpointStats> EndpointStatsTable::get(const Endpoint &ep) {
+  std::lock_guard<std::mutex> lk(mutex_);
+  auto &stats = stats_[ep];
+  if (!stats)
+    stats = std::make_shared<EndpointStats>(ep, options_, &ejected_,
+                                            &transitions_);
+  return stats;
+}
+
+EndpointSet::EndpointSet(EndpointsPtr members,
+                         std::vector<std::shared_ptr<EndpointStats>> stats,
+                         const std::atomic<uint64_t> *transitions)
+    : members_(std::move(members)), stats_(std::move(stats)),
+      transitions_(transitions) {
+  all_.reserve(members_->size());
+  for (uint32_t i = 0; i < members_->size(); ++i)
+    all_.push_back(Candidate{&(*members_)[i], stats_[i].get(), i});
+}
+
+/// @brief 先读取状态转换计数再读取熔断器的状态，计算期间发生的状态转换
+/// 会让下一次调用重新计算
+std::shared_ptr<const Availability>
+EndpointSet::availability(Timestamp now) const {
+  const uint64_t version = transitions_->load(std::memory_order_acquire);
+  auto cached = std::atomic_load(&availability_);
+  if (cached && cached->version == version && now < cached->validUntil)
+    return cached;
+  auto fresh = std::make_shared<Availability>();
+  fresh->version = version;
+  fresh->validUntil = Timestamp(std::numeric_limits<int64_t>::max());
+  fresh->usable.reserve(all_.size());
+  fresh->admission.resize(all_.size(), Admission::Free);
+  for (const auto &c : all_) {
+    const CircuitBreaker &breaker = c.stats->breaker();
+    switch (breaker.state()) {
+    case CircuitBreaker::State::Closed:
+      break;
+    case CircuitBreaker::State::Open: {
+      const Timestamp until = breaker.openUntil();
+      if (now < until) {
+        fresh->admission[c.index] = Admission::Ejected;
+        if (until < fresh->validUntil)
+          fresh->validUntil = until;
+        continue;
+      }
+      fresh->admission[c.index] = Admission::Probe;
+      break;
+    }
+    case CircuitBreaker::State::HalfOpen:
+      fresh->admission[c.index] = Admission::Probe;
+      break;
+    }
+    fresh->usable.push_back(c);
+  }
+  std::shared_ptr<const Availability> result = std::move(fresh);
+  std::atomic_store(&availability_, result);
+  return result;
+}
+
+std::shared_ptr<const EndpointSet>
+EndpointStatsTable::resolve(const EndpointsPtr &eps) {
+  auto set = std::atomic_load(&set_);
+  if (set && set->members() == eps)
+    return set;
+  std::vector<std::shared_ptr<EndpointStats>> stats;
+  stats.reserve(eps->size());
+  for (const auto &ep : *eps)
+    stats.push_back(get(ep));
+  set = std::make_shared<const EndpointSet>(eps, std::move(stats),
+                                            &transitions_);
+  std::atomic_store(&set_, set);
+  return set;
+}
+
+/// @brief peak-EWMA 延迟超过中位数 latencyFactor 倍的 endpoint 被剔除.
+/// 多个线程同时调用的时候只有一个线程执行检查
+void EndpointStatsTable::detectOutliers(const EndpointSet &endpoints,
+                                        Timestamp now) {
+  if (!options_.enabled || endpoints.size() < 2)
+    return;
+  int64_t last = lastDetect_.load(std::memory_order_relaxed);
+  if ((now.microSecondsSinceEpoch() - last) / 1000 <
+          options_.outlierInterval.count() ||
+      !lastDetect_.compare_exchange_strong(last, now.microSecondsSinceEpoch(),
+                                           std::memory_order_relaxed))
+    return;
+  std::vector<std::pair<double, EndpointStats *>> latencies;
+  for (const auto &c : endpoints.all()) {
+    const double ewma = c.stats->ewmaLatency();
+    if (ewma > 0 && c.stats->breaker().state() == CircuitBreaker::State::Closed)
+      latencies.emplace_back(ewma, c.stats);
+  }
+  if (latencies.size() < 2)
+    return;
+  auto mid = latencies.begin() + (latencies.size() - 1) / 2;
+  std::nth_element(latencies.begin(), mid, latencies.end(),
+                   [](const std::pair<double, EndpointStats *> &a,
+                      const std::pair<double, EndpointStats *> &b) {
+                     return a.first < b.first;
+                   });
+  const double threshold =
+      std::max(mid->first * options_.latencyFactor,
+               options_.minOutlierLatency.count() * 1000.0);
+  // 剔除的数量不超过 maxEjectionPercent
+  const int maxEjected =
+      static_cast<int>(endpoints.size()) * options_.maxEjectionPercent / 100;
+  for (auto &item : latencies) {
+    if (ejectedCount() >= maxEjected)
+      break;
+    if (item.first > threshold)
+      item.second->breaker().eject(now);
+  }
+}
+
+/// -------------- LoadBalancer --------------
+
+/// @brief 先在完整的列表中选择，被拒绝的时候从候选中删除之后重新选择
+const Candidate *LoadBalancer::selectByKey(const EndpointSet &eps, uint64_t,
+                                           const CandidateFilter &accept) {
+  const Candidate &first = select(eps.all());
+  if (accept(first))
+    return &first;
+  Candidates candidates(eps.all());
+  candidates.erase(candidates.begin() + first.index);
+  while (!candidates.empty()) {
+    auto it = candidates.begin() + (&select(candidates) - candidates.data());
+    if (accept(*it))
+      return &eps.all()[it->index];
+    candidates.erase(it);
+  }
+  return nullptr;
+}
+
+std::unique_ptr<LoadBalancer> makeLoadBalancer(LoadBalanceType type) {
+  switch (type) {
+  case LoadBalanceType::PowerOfTwoChoices:
+    return std::unique_ptr<LoadBalancer>(new PowerOfTwoChoicesBalancer);
+  case LoadBalanceType::PeakEwma:
+    return std::unique_ptr<LoadBalancer>(new PeakEwmaBalancer);
+  case LoadBalanceType::LeastOutstanding:
+    return std::unique_ptr<LoadBalancer>(new LeastOutstandingBalancer);
+  case LoadBalanceType::WeightedRoundRobin:
+    return std::unique_ptr<LoadBalancer>(new WeightedRoundRobinBalancer);
+  case LoadBalanceType::ConsistentHash:
+    return std::unique_ptr<LoadBalancer>(new ConsistentHashBalancer);
+  case LoadBalanceType::RoundRobin:
+  default:
+    return std::unique_ptr<LoadBalancer>(new RoundRobinBalancer);
+  }
+}
+
+/// @brief FNV-1a，再用 splitmix64 的 finalizer 打散低位，
+/// 相近的 key（例如只有最后一位不同的虚拟节点名字）也能均匀分布在环上
+uint64_t hashRoutingKey(const char *data, size_t len) {
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= static_cast<unsigned char>(data[i]);
+    h *= 1099511628211ULL;
+  }
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+/// @brief 随机选择两个不同的下标
+static std::pair<size_t, size_t> pickTwo(size_t n) {
+  thread_local std::minstd_rand rng(std::random_device{}());
+  const size_t a = rng() % n;
+  size_t b = rng() % (n - 1);
+  if (b >= a)
+    ++b;
+  return {a, b};
+}
+
+const Candidate &RoundRobinBalancer::select(const Candidates &cs) {
+  return cs[next_.fetch_add(1, std::memory_order_relaxed) % cs.size()];
+}
+
+const Candidate &PowerOfTwoChoicesBalancer::select(const Candidates &cs) {
+  if (cs.size() == 1)
+    return cs[0];
+  const auto ab = pickTwo(cs.size());
+  const int a = cs[ab.first].stats->outstanding();
+  const int b = cs[ab.second].stats->outstanding();
+  return a <= b ? cs[ab.first] : cs[ab.second];
+}
+
+/// @brief 代价是延迟乘以负载，没有样本的 endpoint 代价最低，会被优先探测
+const Candidate &PeakEwmaBalancer::select(const Candidates &cs) {
+  if (cs.size() == 1)
+    return cs[0];
+  auto cost = [](const Candidate &c) {
+    return (c.stats->ewmaLatency() + 1) * (c.stats->outstanding() + 1);
+  };
+  const auto ab = pickTwo(cs.size());
+  return cost(cs[ab.first]) <= cost(cs[ab.second]) ? cs[ab.first]
+                                                    : cs[ab.second];
+}
+
+const Candidate &LeastOutstandingBalancer::select(const Candidates &cs) {
+  const size_t start = next_.fetch_add(1, std::memory_order_relaxed);
+  size_t best = start % cs.size();
+  int bestLoad = cs[best].stats->outstanding();
+  for (size_t i = 1; i < cs.size() && bestLoad > 0; ++i) {
+    const size_t idx = (start + i) % cs.size();
+    const int load = cs[idx].stats->outstanding();
+    if (load < bestLoad) {
+      best = idx;
+      bestLoad = load;
+    }
+  }
+  return cs[best];
+}
+
+WeightedRoundRobinBalancer::WeightedRoundRobinBalancer(
+    std::chrono::milliseconds slowStart)
+    : slowStart_(slowStart) {}
+
+/// @brief nginx 的平滑加权轮询. 每次选择的时候所有 endpoint 的当前权重加上
+/// 有效权重，选出当前权重最大的一个，再减去有效权重之和
+const Candidate &WeightedRoundRobinBalancer::select(const Candidates &cs) {
+  const Timestamp now = Timestamp::now();
+  const double slowStart = slowStart_.count() / 1000.0;
+  std::lock_guard<std::mutex> lk(mutex_);
+  // 删除已经下线的 endpoint
+  if (current_.size() > cs.size() * 2) {
+    std::unordered_map<Endpoint, double> live;
+    for (const auto &c : cs)
+      live[*c.endpoint] = current_[*c.endpoint];
+    current_.swap(live);
+  }
+  double total = 0;
+  size_t best = 0;
+  double bestCurrent = 0;
+  for (size_t i = 0; i < cs.size(); ++i) {
+    const Endpoint &ep = *cs[i].endpoint;
+    double weight = ep.weight() > 0 ? ep.weight() : 1;
+    if (slowStart > 0) {
+      const double age = timeDifference(now, cs[i].stats->firstSeen());
+      if (age < slowStart)
+        weight *= std::max(0.1, age / slowStart);
+    }
+    double &current = current_[ep];
+    current += weight;
+    total += weight;
+    if (i == 0 || current > bestCurrent) {
+      best = i;
+      bestCurrent = current;
+    }
+  }
+  current_[*cs[best].endpoint] -= total;
+  return cs[best];
+}
+
+ConsistentHashBalancer::ConsistentHashBalancer(size_t virtualNodes)
+    : virtualNodes_(std::max<size_t>(virtualNodes, 1)) {}
+
+const Candidate &ConsistentHashBalancer::select(const Candidates &cs) {
+  return cs[next_.fetch_add(1, std::memory_order_relaxed) % cs.size()];
+}
+
+const Candidate *
+ConsistentHashBalancer::selectByKey(const EndpointSet &eps, uint64_t hash,
+                                    const CandidateFilter &accept) {
+  const Candidates &all = eps.all();
+  if (all.size() == 1)
+    return accept(all[0]) ? &all[0] : nullptr;
+  auto ring = _ring(eps.members());
+  const auto &points = ring->points;
+  auto it = std::lower_bound(points.begin(), points.end(),
+                             std::make_pair(hash, uint32_t(0)));
+  // 顺时针跳过被拒绝的 endpoint，每个 endpoint 最多判断一次
+  std::vector<bool> rejected;
+  size_t nRejected = 0;
+  for (size_t n = 0; n < points.size(); ++n, ++it) {
+    if (it == points.end())
+      it = points.begin();
+    const uint32_t i = it->second;
+    if (!rejected.empty() && rejected[i])
+      continue;
+    if (accept(all[i]))
+      return &all[i];
+    if (rejected.empty())
+      rejected.resize(all.size());
+    rejected[i] = true;
+    if (++nRejected == all.size())
+      break;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<const ConsistentHashBalancer::Ring>
+ConsistentHashBalancer::_ring(const EndpointsPtr &eps) {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (ring_ && ring_->members == eps)
+      return ring_;
+  }
+  auto ring = std::make_shared<Ring>();
+  ring->members = eps;
+  for (uint32_t i = 0; i < eps->size(); ++i) {
+    const Endpoint &ep = (*eps)[i];
+    const size_t vnodes =
+        virtualNodes_ * static_cast<size_t>(std::max(ep.weight(), 1));
+    const std::string prefix = getStringAddrFromEndpoint(ep) + "#";
+    std::string name;
+    for (size_t v = 0; v < vnodes; ++v) {
+      name = prefix + std::to_string(v);
+      ring->points.emplace_back(hashRoutingKey(name), i);
+    }
+  }
+  std::sort(ring->points.begin(), ring->points.end());
+  std::lock_guard<std::mutex> lk(mutex_);
+  ring_ = ring;
+  return ring;
+}
+
+} // namespace lrpc
@@ -0,0 +1,274 @@
+/**
+ * @file LoadBalancer.h
+ * @brief ClientStub 选择 endpoint 的负载均衡策略
+ *
+ * 每个 endpoint 有一个 EndpointStats，由连接到该 endpoint 的所有 ClientChannel
+ * 共同更新（outstanding 请求数、peak-EWMA 延迟），负载均衡器根据这些统计选择
+ * endpoint. name service 返回的 endpoint 列表由 EndpointStatsTable::resolve
+ * 解析成 EndpointSet，每个 endpoint 的 EndpointStats 只查找一次，之后按照
+ * 列表的指针缓存，选择的时候只读取原子变量，不经过 EndpointStatsTable 的锁.
+ * select 可能在多个 loop 线程中同时调用，实现必须是线程安全的.
+ * 被熔断剔除的 endpoint 在调用 select 之前已经被过滤掉了.
+ * 带有路由 key 的请求（见 ClientStub::setRoutingKey）调用 selectByKey，
+ * ConsistentHash 按照 key 选择 endpoint，同一个 key 总是落在同一个 endpoint.
+ * selectByKey 总是传入完整的 endpoint 列表，被剔除或者排除的 endpoint 由
+ * accept 跳过，环不会因为列表的子集而重建
+ */
+
+#ifndef LRPC_LOADBALANCER_H
+#define LRPC_LOADBALANCER_H
+
+#include "CircuitBreaker.h"
+#include "RpcEndpoint.h"
+#include "Timestamp.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace lrpc {
+
+using lrpc::util::Timestamp;
+
+/// @brief 一个 endpoint 的统计信息，所有成员函数都是线程安全的
+class EndpointStats {
+public:
+  EndpointStats(const Endpoint &ep, const CircuitBreakerOptions &options,
+                std::atomic<int> *ejected,
+                std::atomic<uint64_t> *transitions);
+
+  /// @brief 发送请求的时候调用
+  void onSend();
+  /// @brief 请求完成（包括失败和超时）的时候调用，ok 表示是否成功
+  void onComplete(std::chrono::microseconds latency, bool ok = true);
+  /// @brief 连接断开，n 个请求没有结果，记为一次失败
+  void onAbandoned(int n);
+  /// @brief 连接失败，记为一次失败
+  void onConnectFailed();
+
+  int outstanding() const {
+    return outstanding_.load(std::memory_order_relaxed);
+  }
+  /// @brief peak-EWMA 延迟（微秒），还没有样本的时候返回 0
+  double ewmaLatency() const;
+  /// @brief 最近 kLatencySamples 个请求延迟的 q 分位数，还没有样本的时候返回 0
+  std::chrono::microseconds latencyPercentile(double q) const;
+  /// @brief 第一次发现这个 endpoint 的时间，用于 slow start
+  Timestamp firstSeen() const { return firstSeen_; }
+  CircuitBreaker &breaker() { return breaker_; }
+
+private:
+  std::atomic<int> outstanding_{0};
+  static const size_t kLatencySamples = 128;
+
+  mutable std::mutex mutex_; // 保护 ewma_、lastSample_ 和 samples_
+  double ewma_{0};
+  Timestamp lastSample_;
+  std::vector<int64_t> samples_; // 环形缓冲区，保存最近的延迟
+  size_t nextSample_{0};
+  const Timestamp firstSeen_;
+  CircuitBreaker breaker_;
+};
+
+/// @brief name service 返回的 endpoint 列表，更新的时候整体替换，
+/// 同一个列表的指针不变
+using EndpointsPtr = std::shared_ptr<std::vector<Endpoint>>;
+
+/// @brief 负载均衡的候选 endpoint 和它的统计信息
+struct Candidate {
+  const Endpoint *endpoint;
+  EndpointStats *stats;
+  uint32_t index; // 在 endpoint 列表中的下标
+};
+using Candidates = std::vector<Candidate>;
+
+/// @brief 选择 endpoint 的时候熔断器的状态
+enum class Admission : uint8_t {
+  Ejected, ///< 剔除时间没有结束，不能选择
+  Free,    ///< Closed，选中之后直接使用
+  Probe,   ///< HalfOpen 或者剔除时间已经结束，选中之后需要 tryAcquire
+};
+
+/// @brief 某一时刻 endpoint 列表中可以选择的 endpoint. 熔断器的状态改变
+/// 或者有 endpoint 的剔除时间结束之后失效
+struct Availability {
+  uint64_t version;    // 计算时 EndpointStatsTable 的状态转换计数
+  Timestamp validUntil; // 最早结束剔除的时间
+  Candidates usable;    // 不是 Ejected 的 endpoint
+  std::vector<Admission> admission; // 按照 Candidate::index
+};
+
+/// @brief 一个 endpoint 列表和它们的 EndpointStats，创建之后不再修改
+class EndpointSet {
+public:
+  EndpointSet(EndpointsPtr members,
+              std::vector<std::shared_ptr<EndpointStats>> stats,
+              const std::atomic<uint64_t> *transitions);
+
+  const EndpointsPtr &members() const { return members_; }
+  /// @brief 按照列表的顺序排列的所有 endpoint
+  const Candidates &all() const { return all_; }
+  size_t size() const { return all_.size(); }
+  /// @brief 当前的可用列表. 没有状态转换并且没有 endpoint 结束剔除的时候
+  /// 返回缓存，不访问熔断器
+  std::shared_ptr<const Availability> availability(Timestamp now) const;
+
+private:
+  const EndpointsPtr members_;
+  const std::vector<std::shared_ptr<EndpointStats>> stats_; // 保持 all_ 有效
+  const std::atomic<uint64_t> *const transitions_;
+  Candidates all_;
+  // 通过 std::atomic_load 访问
+  mutable std::shared_ptr<const Availability> availability_;
+};
+
+/// @brief Endpoint -> EndpointStats，ClientStub 持有一份
+class EndpointStatsTable {
+public:
+  /// @brief 只能在创建 EndpointStats 之前调用
+  void setCircuitBreakerOptions(const CircuitBreakerOptions &options) {
+    options_ = options;
+  }
+  const CircuitBreakerOptions &circuitBreakerOptions() const {
+    return options_;
+  }
+  /// @brief 获取 ep 的统计信息，不存在则创建
+  std::shared_ptr<EndpointStats> get(const Endpoint &ep);
+  /// @brief endpoints 对应的 EndpointSet. 和上一次的列表是同一个的时候
+  /// 直接返回缓存，不加锁；否则查找每个 endpoint 的统计信息之后替换缓存
+  std::shared_ptr<const EndpointSet> resolve(const EndpointsPtr &endpoints);
+  /// @brief 没有被剔除（Closed 状态）的 endpoint 数量为 0 的时候可以跳过过滤
+  int ejectedCount() const { return ejected_.load(std::memory_order_relaxed); }
+  /// @brief 每隔 outlierInterval 检查一次，剔除延迟异常的 endpoint
+  void detectOutliers(const EndpointSet &endpoints, Timestamp now);
+
+private:
+  std::mutex mutex_;
+  std::unordered_map<Endpoint, std::shared_ptr<EndpointStats>> stats_;
+  std::shared_ptr<const EndpointSet> set_; // 通过 std::atomic_load 访问
+  CircuitBreakerOptions options_;
+  std::atomic<int> ejected_{0};
+  std::atomic<uint64_t> transitions_{0}; // 熔断器的状态转换次数
+  std::atomic<int64_t> lastDetect_{0}; // 上一次检查延迟的时间（微秒）
+};
+
+/// @brief 路由 key 的哈希值，与平台和进程无关，不同的客户端对同一个 key
+/// 得到相同的结果
+uint64_t hashRoutingKey(const char *data, size_t len);
+inline uint64_t hashRoutingKey(const std::string &key) {
+  return hashRoutingKey(key.data(), key.size());
+}
+
+/// @brief 返回 false 的 endpoint 不能被选择. 可能有副作用（例如占用
+/// HalfOpen 的试探名额），返回 true 的 endpoint 一定被选中
+using CandidateFilter = std::function<bool(const Candidate &)>;
+
+/// @brief 负载均衡策略的接口
+class LoadBalancer {
+public:
+  virtual ~LoadBalancer() = default;
+  /// @brief 从非空的 candidates 中选择一个
+  virtual const Candidate &select(const Candidates &candidates) = 0;
+  /**
+   * @brief 带有路由 key 的请求，hash 为 hashRoutingKey(key)
+   *
+   * @param endpoints 非空的完整列表
+   * @param accept 依次判断候选的 endpoint，跳过返回 false 的
+   * @return endpoints.all() 中的元素，没有可以选择的 endpoint 的时候返回
+   * nullptr. 默认忽略 key，按照 select 选择
+   */
+  virtual const Candidate *selectByKey(const EndpointSet &endpoints,
+                                       uint64_t hash,
+                                       const CandidateFilter &accept);
+};
+
+enum class LoadBalanceType {
+  RoundRobin,         ///< 轮询（默认）
+  PowerOfTwoChoices,  ///< 随机选择两个，取 outstanding 较少的
+  PeakEwma,           ///< 随机选择两个，取 peak-EWMA 延迟 * 负载较小的
+  LeastOutstanding,   ///< outstanding 最少的
+  WeightedRoundRobin, ///< 按照 Endpoint.weight 平滑加权轮询，新的 endpoint
+                      ///< 在 slow start 时间内权重逐渐增加
+  ConsistentHash,     ///< 按照路由 key 一致性哈希，没有 key 的请求轮询
+};
+
+std::unique_ptr<LoadBalancer> makeLoadBalancer(LoadBalanceType type);
+
+class RoundRobinBalancer : public LoadBalancer {
+public:
+  const Candidate &select(const Candidates &candidates) override;
+
+private:
+  std::atomic<size_t> next_{0};
+};
+
+class PowerOfTwoChoicesBalancer : public LoadBalancer {
+public:
+  const Candidate &select(const Candidates &candidates) override;
+};
+
+class PeakEwmaBalancer : public LoadBalancer {
+public:
+  const Candidate &select(const Candidates &candidates) override;
+};
+
+class LeastOutstandingBalancer : public LoadBalancer {
+public:
+  const Candidate &select(const Candidates &candidates) override;
+
+private:
+  std::atomic<size_t> next_{0}; // outstanding 相同的时候轮流选择
+};
+
+class WeightedRoundRobinBalancer : public LoadBalancer {
+public:
+  explicit WeightedRoundRobinBalancer(
+      std::chrono::milliseconds slowStart = std::chrono::seconds(30));
+
+  const Candidate &select(const Candidates &candidates) override;
+
+private:
+  const std::chrono::milliseconds slowStart_;
+  std::mutex mutex_;
+  std::unordered_map<Endpoint, double> current_; // 平滑加权轮询的当前权重
+};
+
+/**
+ * @brief ketama 一致性哈希环. 每个 endpoint 按照 ip:port 在环上放置
+ * weight * virtualNodes 个虚拟节点，key 的哈希值顺时针遇到的第一个虚拟节点
+ * 决定 endpoint. 虚拟节点的位置只和 endpoint 自己的地址有关，name service
+ * 增加或者删除一个 endpoint 只会重新映射与它相邻的 key（大约 1/n），
+ * 被熔断剔除的 endpoint 上的 key 落到环上的下一个 endpoint，恢复之后回来.
+ * 环按照 endpoint 列表的指针缓存，name service 更新列表的时候重新建环
+ */
+class ConsistentHashBalancer : public LoadBalancer {
+public:
+  explicit ConsistentHashBalancer(size_t virtualNodes = 160);
+
+  /// @brief 没有 key 的请求轮询
+  const Candidate &select(const Candidates &candidates) override;
+  /// @brief 从 key 的位置顺时针找到第一个 accept 的 endpoint
+  const Candidate *selectByKey(const EndpointSet &endpoints, uint64_t hash,
+                               const CandidateFilter &accept) override;
+
+private:
+  struct Ring {
+    EndpointsPtr members; // 建环时的 endpoint 列表
+    // (虚拟节点的哈希值, members 的下标)，按照哈希值排序
+    std::vector<std::pair<uint64_t, uint32_t>> points;
+  };
+  // 返回 endpoints 对应的环，与上一次的列表不是同一个的时候重新建环
+  std::shared_ptr<const Ring> _ring(const EndpointsPtr &endpoints);
+
+  const size_t virtualNodes_;
+  std::atomic<size_t> next_{0};
+  std::mutex mutex_; // 保护 ring_
+  std::shared_ptr<const Ring> ring_;
+};
+
+} // namespace lrpc
+
+#endif
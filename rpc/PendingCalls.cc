@@ -0,0 +1,66 @@
+#include "PendingCalls.h"
+
+namespace lrpc {
+
+// id 是 int32，最高位不用，generation 一共有 31 - kSlotBits 位
+static const uint32_t kMaxGeneration = (1u << (31 - PendingCalls::kSlotBits)) - 1;
+
+int PendingCalls::add(Call &&call) {
+  uint32_t index;
+  // 优先分配新的 slot，让释放的 slot 间隔足够多的请求之后再复用
+  if (freeSlots_.size() < kMinFreeSlots && slots_.size() < kMaxSlots) {
+    index = static_cast<uint32_t>(slots_.size());
+    slots_.emplace_back();
+  } else if (!freeSlots_.empty()) {
+    index = freeSlots_.front();
+    freeSlots_.pop_front();
+  } else {
+    return -1;
+  }
+  Slot &slot = slots_[index];
+  assert(!slot.used);
+  slot.used = true;
+  slot.call = std::move(call);
+  size_.store(size() + 1, std::memory_order_relaxed);
+  return static_cast<int>((slot.generation << kSlotBits) | index);
+}
+
+bool PendingCalls::contains(int id) const {
+  if (id <= 0)
+    return false;
+  const uint32_t index = indexOf(id);
+  return index < slots_.size() && slots_[index].used &&
+         slots_[index].generation == generationOf(id);
+}
+
+bool PendingCalls::take(int id, Call *call) {
+  if (!contains(id))
+    return false;
+  Slot &slot = slots_[indexOf(id)];
+  *call = std::move(slot.call);
+  slot.call = Call();
+  slot.used = false;
+  // slot 被释放之后更换 generation，旧的 id 全部失效
+  slot.generation = slot.generation == kMaxGeneration ? 1 : slot.generation + 1;
+  freeSlots_.push_back(indexOf(id));
+  size_.store(size() - 1, std::memory_order_relaxed);
+  return true;
+}
+
+void PendingCalls::takeAll(std::vector<Call> *calls) {
+  calls->reserve(calls->size() + size());
+  for (uint32_t index = 0; index < slots_.size(); ++index) {
+    Slot &slot = slots_[index];
+    if (!slot.used)
+      continue;
+    calls->push_back(std::move(slot.call));
+    slot.call = Call();
+    slot.used = false;
+    slot.generation =
+        slot.generation == kMaxGeneration ? 1 : slot.generation + 1;
+    freeSlots_.push_back(index);
+  }
+  size_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace lrpc
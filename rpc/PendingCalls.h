@@ -0,0 +1,80 @@
+#ifndef LRPC_PENDINGCALLS_H
+#define LRPC_PENDINGCALLS_H
+
+#include "Timestamp.h"
+#include "future.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <google/protobuf/message.h>
+#include <memory>
+#include <vector>
+
+namespace lrpc {
+
+using google::protobuf::Message;
+using lrpc::util::Timestamp;
+
+/**
+ * @brief ClientChannel 上等待 response 的请求表
+ * call id 由 slot 下标和 generation 组成: id = (generation << kSlotBits) | index
+ * 1. 查找/释放都是 O(1) 的数组下标访问
+ * 2. slot 被复用之后 generation 会变化，迟到的 response 或者过期的超时事件
+ *    携带旧的 id，不会误匹配到新的请求
+ * 3. generation 只有 31 - kSlotBits 位，会回绕. 空闲的 slot 按照释放的顺序
+ *    复用，并且至少有 kMinFreeSlots 个空闲 slot 的时候才复用，否则分配新的
+ *    slot. 这样同一个 slot 两次使用之间至少间隔 kMinFreeSlots 个请求，
+ *    generation 回绕一次至少需要 kMinFreeSlots * 32767 个请求，远远超过
+ *    超时时间内一个连接能发出的请求数
+ */
+class PendingCalls {
+public:
+  /// @brief 每个 request 的上下文
+  struct Call {
+    Promise<std::shared_ptr<Message>> promise;
+    Timestamp sendTime; // 请求发送的时间
+    Timestamp deadline; // 请求超时的时间
+  };
+
+  static const int kSlotBits = 16;
+  static const uint32_t kMaxSlots = 1u << kSlotBits;
+  /// @brief 空闲 slot 少于这个数的时候分配新的 slot，不复用刚释放的 slot
+  static const size_t kMinFreeSlots = 1024;
+
+  PendingCalls() = default;
+  PendingCalls(const PendingCalls &) = delete;
+  PendingCalls &operator=(const PendingCalls &) = delete;
+
+  /// @brief 分配一个 slot 保存 call，返回 call id. slot 用完的时候返回 -1
+  int add(Call &&call);
+  /// @brief 检查 id 对应的请求是否还在等待
+  bool contains(int id) const;
+  /// @brief 取出 id 对应的请求并释放 slot，id 无效的时候返回 false
+  bool take(int id, Call *call);
+  /// @brief 取出所有的请求，用于连接断开的时候
+  void takeAll(std::vector<Call> *calls);
+
+  /// @brief 可以在其他线程读取，用于选择 outstanding 最少的连接
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0; }
+
+private:
+  struct Slot {
+    uint32_t generation{1};
+    bool used{false};
+    Call call;
+  };
+
+  static uint32_t indexOf(int id) { return id & (kMaxSlots - 1); }
+  static uint32_t generationOf(int id) {
+    return static_cast<uint32_t>(id) >> kSlotBits;
+  }
+
+  std::vector<Slot> slots_;
+  std::deque<uint32_t> freeSlots_; // 空闲的 slot 下标，按照释放的顺序
+  std::atomic<size_t> size_{0}; // 只在 loop 线程修改
+};
+
+} // namespace lrpc
+
+#endif
@@ -0,0 +1,45 @@
+#include "RequestBatcher.h"
+#include "EventLoop.h"
+#include <algorithm>
+
+namespace lrpc {
+
+RequestBatcher::RequestBatcher(EventLoop *loop, const BatchOptions &options,
+                               Flush flush)
+    : loop_(loop), options_(options), flush_(std::move(flush)) {
+  options_.maxBatch = std::max<size_t>(options_.maxBatch, 1);
+}
+
+void RequestBatcher::add(Call &&call) {
+  loop_->assertInLoopThread();
+  calls_.push_back(std::move(call));
+  if (calls_.size() >= options_.maxBatch)
+    _flush();
+  else if (calls_.size() == 1)
+    _arm();
+}
+
+void RequestBatcher::_arm() {
+  const uint64_t generation = generation_;
+  auto onTimeout = [this, generation] {
+    // 这一批已经因为攒够了请求提前执行
+    if (generation == generation_ && !calls_.empty())
+      _flush();
+  };
+  if (options_.window.count() > 0)
+    loop_->runAfter(options_.window.count() / 1e6, onTimeout);
+  else
+    // pending functor 在这一轮迭代的 IO 事件都处理完之后执行，
+    // 同一次 poll 返回的所有连接上的请求合并成一批
+    loop_->queueInLoop(onTimeout);
+}
+
+void RequestBatcher::_flush() {
+  ++generation_;
+  std::vector<Call> calls;
+  calls.swap(calls_);
+  calls_.reserve(options_.maxBatch);
+  flush_(std::move(calls));
+}
+
+} // namespace lrpc
@@ -0,0 +1,101 @@
+/**
+ * @file RequestBatcher.h
+ * @brief 服务端请求的自动批处理
+ *
+ * 注册了批处理 handler 的 method（Service::setBatchHandler）不再一次只处理
+ * 一个请求：同一个 loop 上并发到达的请求（可以来自不同的连接）先放进这个
+ * method 在该 loop 的 RequestBatcher，攒够 maxBatch 个或者第一个请求等待了
+ * window 之后一起交给 handler 执行一次. handler 按照 method 的执行策略在
+ * IO loop 或者 worker 线程池中执行，每个请求的 response 仍然单独发回各自的
+ * 连接，并发限制、缓存和 oneway 也按照单个请求生效
+ */
+
+#ifndef LRPC_REQUESTBATCHER_H
+#define LRPC_REQUESTBATCHER_H
+
+#include "Callback.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <google/protobuf/message.h>
+#include <memory>
+#include <vector>
+
+namespace lrpc {
+
+namespace net {
+class EventLoop;
+}
+
+class Controller;
+class ServerChannel;
+
+using google::protobuf::Message;
+using lrpc::net::EventLoop;
+using lrpc::net::TcpConnectionPtr;
+
+struct BatchOptions {
+  /// @brief 一批最多的请求数，攒够之后立即执行
+  size_t maxBatch{64};
+  /// @brief 一批中第一个请求最多等待的时间. 0 表示不额外等待，只合并 loop
+  /// 同一轮迭代中分发的请求
+  std::chrono::microseconds window{0};
+};
+
+/**
+ * @brief 批处理 handler 的参数，下标相同的元素属于同一个请求.
+ * response 已经创建好，由 handler 填充；单个请求失败的时候调用对应
+ * controller 的 SetFailed. handler 抛出异常的时候整批请求都以
+ * ThrowInMethod 失败. handler 返回之后 response 立即发送，不能异步完成
+ */
+struct Batch {
+  std::vector<const Message *> requests;
+  std::vector<Message *> responses;
+  std::vector<Controller *> controllers;
+
+  size_t size() const { return requests.size(); }
+};
+
+using BatchHandler = std::function<void(Batch &)>;
+
+/**
+ * @brief 每个 EventLoop、每个批处理 method 一个 RequestBatcher，收集请求并
+ * 决定什么时候执行一批. 执行本身由 flush 回调负责（见 Service::_batcher）
+ *
+ * 只能在所属的 loop 线程中使用
+ */
+class RequestBatcher {
+public:
+  struct Call {
+    TcpConnectionPtr conn; // 持有连接，执行期间 ServerChannel 不会被销毁
+    ServerChannel *channel;
+    int id;
+    std::shared_ptr<Message> request; // 还没有解码的 request
+    std::shared_ptr<Controller> controller;
+  };
+  using Flush = std::function<void(std::vector<Call> &&)>;
+
+  RequestBatcher(EventLoop *loop, const BatchOptions &options, Flush flush);
+  RequestBatcher(const RequestBatcher &) = delete;
+  RequestBatcher &operator=(const RequestBatcher &) = delete;
+
+  void add(Call &&call);
+  /// @brief 正在等待的请求数
+  size_t size() const { return calls_.size(); }
+
+private:
+  void _flush();
+  // 一批中的第一个请求到达的时候设置，到期之后执行这一批
+  void _arm();
+
+  EventLoop *const loop_;
+  BatchOptions options_;
+  const Flush flush_;
+  std::vector<Call> calls_;
+  // 每执行一批加一，之前设置的定时器或者 pending functor 随之失效
+  uint64_t generation_{0};
+};
+
+} // namespace lrpc
+
+#endif
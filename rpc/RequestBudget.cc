@@ -0,0 +1,39 @@
+#include "RequestBudget.h"
+#include <algorithm>
+
+namespace lrpc {
+
+RequestBudget::RequestBudget(double ratio, double maxTokens)
+    : tokens_(0), deposit_(0), max_(0) {
+  reset(ratio, maxTokens);
+}
+
+void RequestBudget::reset(double ratio, double maxTokens) {
+  deposit_.store(static_cast<int64_t>(std::max(ratio, 0.0) * kScale),
+                 std::memory_order_relaxed);
+  max_.store(static_cast<int64_t>(std::max(maxTokens, 0.0) * kScale),
+             std::memory_order_relaxed);
+  tokens_.store(0, std::memory_order_relaxed);
+}
+
+void RequestBudget::onRequest() {
+  const int64_t deposit = deposit_.load(std::memory_order_relaxed);
+  const int64_t max = max_.load(std::memory_order_relaxed);
+  int64_t cur = tokens_.load(std::memory_order_relaxed);
+  while (cur < max && !tokens_.compare_exchange_weak(
+                          cur, std::min(cur + deposit, max),
+                          std::memory_order_relaxed))
+    ;
+}
+
+bool RequestBudget::tryAcquire() {
+  int64_t cur = tokens_.load(std::memory_order_relaxed);
+  while (cur >= kScale) {
+    if (tokens_.compare_exchange_weak(cur, cur - kScale,
+                                      std::memory_order_relaxed))
+      return true;
+  }
+  return false;
+}
+
+} // namespace lrpc
@@ -0,0 +1,38 @@
+#ifndef LRPC_REQUESTBUDGET_H
+#define LRPC_REQUESTBUDGET_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace lrpc {
+
+/**
+ * @brief 按照请求数补充的 token 预算，限制额外请求（hedge / retry）占正常请求的
+ * 比例. 每个正常请求补充 ratio 个 token，最多累计 maxTokens 个，
+ * 每个额外请求消耗一个 token. 所有成员函数都是线程安全的
+ */
+class RequestBudget {
+public:
+  explicit RequestBudget(double ratio = 0.05, double maxTokens = 10);
+  RequestBudget(const RequestBudget &) = delete;
+  RequestBudget &operator=(const RequestBudget &) = delete;
+
+  /// @brief 重新设置比例和上限，token 清零
+  void reset(double ratio, double maxTokens);
+  /// @brief 发送了一个正常请求
+  void onRequest();
+  /// @brief 尝试消耗一个 token，预算不足的时候返回 false
+  bool tryAcquire();
+
+private:
+  // token 按照 1/kScale 为单位保存成整数，避免对 double 做 CAS
+  static const int64_t kScale = 1000;
+
+  std::atomic<int64_t> tokens_;
+  std::atomic<int64_t> deposit_; // 每个请求补充的量
+  std::atomic<int64_t> max_;
+};
+
+} // namespace lrpc
+
+#endif
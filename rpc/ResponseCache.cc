@@ -0,0 +1,68 @@
+#include "ResponseCache.h"
+#include <functional>
+
+namespace lrpc {
+
+// 每个 entry 除了 request 和 response 之外的内存开销估计
+static const size_t kEntryOverhead = 128;
+
+ResponseCache::ResponseCache(std::chrono::milliseconds ttl, size_t maxBytes,
+                             size_t shards)
+    : ttl_(ttl.count() / 1000.0),
+      shardBytes_(maxBytes / (shards > 0 ? shards : 1)) {
+  shards_.reserve(shards > 0 ? shards : 1);
+  for (size_t i = 0; i < shards_.capacity(); ++i)
+    shards_.emplace_back(new Shard);
+}
+
+ResponseCache::Shard &ResponseCache::_shard(std::string_view request) {
+  return *shards_[std::hash<std::string_view>()(request) % shards_.size()];
+}
+
+void ResponseCache::_erase(Shard &shard, EntryList::iterator it) {
+  shard.bytes -= it->bytes;
+  shard.index.erase(std::string_view(it->request));
+  shard.lru.erase(it);
+}
+
+std::shared_ptr<const std::string>
+ResponseCache::get(const std::string &request, Timestamp now) {
+  Shard &shard = _shard(request);
+  std::lock_guard<std::mutex> lk(shard.mutex);
+  auto it = shard.index.find(std::string_view(request));
+  if (it == shard.index.end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  auto entry = it->second;
+  if (!(now < entry->expire)) {
+    _erase(shard, entry);
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  shard.lru.splice(shard.lru.begin(), shard.lru, entry);
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return entry->response;
+}
+
+void ResponseCache::put(const std::string &request, const std::string &response,
+                        Timestamp now) {
+  const size_t bytes = request.size() + response.size() + kEntryOverhead;
+  if (bytes > shardBytes_)
+    return;
+  Shard &shard = _shard(request);
+  auto value = std::make_shared<const std::string>(response);
+  std::lock_guard<std::mutex> lk(shard.mutex);
+  auto it = shard.index.find(std::string_view(request));
+  if (it != shard.index.end())
+    _erase(shard, it->second);
+  while (!shard.lru.empty() && shard.bytes + bytes > shardBytes_)
+    _erase(shard, std::prev(shard.lru.end()));
+  shard.lru.push_front(
+      Entry{request, std::move(value), addTime(now, ttl_), bytes});
+  shard.index.emplace(std::string_view(shard.lru.front().request),
+                      shard.lru.begin());
+  shard.bytes += bytes;
+}
+
+} // namespace lrpc
@@ -0,0 +1,74 @@
+/**
+ * @file ResponseCache.h
+ * @brief 服务端幂等 method 的 response 缓存
+ *
+ * key 是序列化之后的 request，value 是序列化之后的 response，每个可缓存的
+ * method 一个 ResponseCache. 命中的请求不调用 CallMethod，直接发送缓存的
+ * response. 内部按照 key 的 hash 分成多个 shard，每个 shard 有自己的锁、
+ * LRU 链表和内存预算，可以在多个 loop 和 worker 线程中同时使用
+ */
+
+#ifndef LRPC_RESPONSECACHE_H
+#define LRPC_RESPONSECACHE_H
+
+#include "Timestamp.h"
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace lrpc {
+
+using lrpc::util::Timestamp;
+
+class ResponseCache {
+public:
+  /// @brief ttl 之后缓存失效，所有 shard 占用的内存不超过 maxBytes
+  ResponseCache(std::chrono::milliseconds ttl, size_t maxBytes,
+                size_t shards = 16);
+
+  /// @brief 查找 request 对应的 response，没有或者已经过期返回 nullptr
+  std::shared_ptr<const std::string> get(const std::string &request,
+                                         Timestamp now);
+  void put(const std::string &request, const std::string &response,
+           Timestamp now);
+
+  int64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  int64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+  struct Entry {
+    std::string request;
+    std::shared_ptr<const std::string> response;
+    Timestamp expire;
+    size_t bytes;
+  };
+  using EntryList = std::list<Entry>;
+
+  struct Shard {
+    std::mutex mutex;
+    EntryList lru; // 最近使用的在前面
+    // key 指向 lru 中 Entry 的 request，查找的时候不需要拷贝 request
+    std::unordered_map<std::string_view, EntryList::iterator> index;
+    size_t bytes{0};
+  };
+
+  Shard &_shard(std::string_view request);
+  // 调用之前需要持有 shard.mutex
+  static void _erase(Shard &shard, EntryList::iterator it);
+
+  const double ttl_; // 秒
+  const size_t shardBytes_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+};
+
+} // namespace lrpc
+
+#endif
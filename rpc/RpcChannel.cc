@@ -3,36 +3,104 @@
 #include "Logging.h"
 #include "RpcClosure.h"
 #include "RpcException.h"
+#include "Server.h"
 
 namespace lrpc {
 
 /// -------------- ServerChannel --------------
 
 ServerChannel::ServerChannel(TcpConnectionPtr &conn, Service *service)
-    : conn_(conn), service_(service), encoder_(responseEncode) {}
+    : conn_(conn), service_(service), encoder_(responseEncode),
+      assembler_(conn->getLoop(), service->chunkLimits()) {}
 
 void ServerChannel::setContext(std::shared_ptr<void> ctx) {
   ctx_ = std::move(ctx);
 }
 
+/// @brief 分块消息组装完成的时候代替最后一个 chunk 返回，
+/// 没有完成的 chunk 由 onMessage 忽略
 std::shared_ptr<Message> ServerChannel::onData(const char *&data, size_t len) {
-  return decoder_.bytesDecoder_(data, len);
+  auto msg = decoder_.bytesDecoder_(data, len);
+  auto frame = dynamic_cast<RpcMessage *>(msg.get());
+  if (frame && frame->has_chunk()) {
+    if (auto whole = assembler_.onChunk(*frame->mutable_chunk()))
+      return whole;
+  }
+  return msg;
+}
+
+/// @brief 根据 request 携带的超时信息计算截止时间，没有设置则返回无效的时间
+static Timestamp requestDeadline(const Request &req, Timestamp receiveTime) {
+  Timestamp deadline;
+  if (req.timeout_ms() > 0)
+    deadline = addTime(receiveTime, req.timeout_ms() / 1000.0);
+  if (req.deadline_us() > 0) {
+    Timestamp absolute(req.deadline_us());
+    if (!deadline.valid() || absolute < deadline)
+      deadline = absolute;
+  }
+  return deadline;
 }
 
 /// @brief 处理解析得到的 Message 请求
-bool ServerChannel::onMessage(std::shared_ptr<Message> &&req) {
+/// 返回 false 表示请求在 dispatch 之前已经过期，被直接丢弃
+bool ServerChannel::onMessage(std::shared_ptr<Message> &&req,
+                              Timestamp receiveTime) {
   std::string method;
+  Timestamp deadline;
+  Priority priority = PRIORITY_DEFAULT;
+  ResponseCache *cache = nullptr;
+  currentOneway_ = false;
   // 解析函数名
   RpcMessage *msg = dynamic_cast<RpcMessage *>(req.get());
   if (msg) {
+    if (msg->has_chunk())
+      return true;
+    if (msg->has_stream()) {
+      _onStreamFrame(*msg->mutable_stream());
+      return true;
+    }
+    if (msg->has_push()) {
+      _onPushFrame(msg->push());
+      return true;
+    }
+    if (msg->has_batch_request()) {
+      _onBatchRequest(*msg->mutable_batch_request(), receiveTime);
+      return true;
+    }
     if (msg->has_request()) {
       currentId_ = msg->request().id();
+      currentOneway_ = msg->request().oneway();
+      if (!compressNegotiated_)
+        _negotiateCompress(msg->request());
       method = msg->request().method_name();
+      priority = msg->request().priority();
+      // 客户端已经放弃等待的请求不再执行，也不需要回复
+      deadline = requestDeadline(msg->request(), receiveTime);
+      if (deadline.valid() && !(Timestamp::now() < deadline)) {
+        LOG_DEBUG << "drop expired request " << currentId_ << " [" << method
+                  << "] from " << conn_->peerAddress().toHostPort();
+        return false;
+      }
       if (msg->request().service_name() != service_->fullName()) {
         throw Exception(ErrorCode::NoSuchService,
                         msg->request().service_name() + " got, but expect [" +
                             service_->fullName() + "]");
       }
+      // oneway 请求不需要 response，携带附件的请求不能只用 request 作为
+      // key，都不使用缓存
+      cache = currentOneway_ || !msg->request().attachment().empty()
+                  ? nullptr
+                  : service_->responseCache(method);
+      if (cache) {
+        // 命中缓存的请求不占用并发限制的名额，也不调用 handler
+        auto cached =
+            cache->get(msg->request().serialized_request(), receiveTime);
+        if (cached) {
+          _sendCached(currentId_, *cached);
+          return true;
+        }
+      }
     } else {
       throw Exception(ErrorCode::EmptyRequest,
                       "Service  [" + service_->fullName() +
@@ -52,12 +120,176 @@ bool ServerChannel::onMessage(std::shared_ptr<Message> &&req) {
       method = service_->methodSelector_(req.get());
     }
   }
-  invoke(method, std::move(req));
+  // controller 记录请求的截止时间，生命周期持续到 done->Run()
+  auto controller = std::make_shared<Controller>(deadline);
+  controller->priority_ = priority;
+  controller->oneway_ = currentOneway_;
+  if (msg && !msg->request().attachment().empty())
+    controller->requestAttachment_ =
+        Attachment(std::move(*msg->mutable_request()->mutable_attachment()));
+  _admit(*controller);
+  if (cache) {
+    controller->cache_ = cache;
+    controller->cacheKey_ = msg->request().serialized_request();
+  }
+  try {
+    invoke(method, std::move(req), controller);
+  } catch (...) {
+    // handler 没有执行或者没有调用 done，归还名额
+    _release(*controller, false);
+    throw;
+  }
   return true;
 }
 
+/// @brief 每个 request 有自己的 Controller，和单独的请求一样经过并发限制、
+/// 执行策略和批处理 handler，只是 response 记录到 BatchReply 中.
+/// 整批都不能执行的错误抛出异常，由 Service::_dispatch 以普通的 Response 回复
+void ServerChannel::_onBatchRequest(BatchRequest &batch,
+                                    Timestamp receiveTime) {
+  const Request &header = batch.header();
+  currentId_ = header.id();
+  currentOneway_ = false;
+  if (!compressNegotiated_)
+    _negotiateCompress(header);
+  const Timestamp deadline = requestDeadline(header, receiveTime);
+  if (deadline.valid() && !(Timestamp::now() < deadline)) {
+    LOG_DEBUG << "drop expired batch " << currentId_ << " ["
+              << header.method_name() << "] from "
+              << conn_->peerAddress().toHostPort();
+    return;
+  }
+  if (header.service_name() != service_->fullName())
+    throw Exception(ErrorCode::NoSuchService,
+                    header.service_name() + " got, but expect [" +
+                        service_->fullName() + "]");
+  const std::string &method = header.method_name();
+  if (!service_->getService()->GetDescriptor()->FindMethodByName(method))
+    throw Exception(ErrorCode::NoSuchMethod,
+                    "Not find method [" + method + "]");
+  auto reply =
+      std::make_shared<BatchReply>(conn_, currentId_, batch.requests_size());
+  if (batch.requests_size() == 0) {
+    _sendBatchReply(conn_, *reply);
+    return;
+  }
+  for (int i = 0; i < batch.requests_size(); ++i) {
+    auto controller = std::make_shared<Controller>(deadline);
+    controller->priority_ = header.priority();
+    controller->batch_ = reply;
+    controller->batchIndex_ = i;
+    // 按照单个请求的 frame 格式交给 invoke，request 的字节不拷贝
+    auto req = std::make_shared<RpcMessage>();
+    Request *single = req->mutable_request();
+    single->set_id(currentId_);
+    single->set_method_name(method);
+    single->mutable_serialized_request()->swap(*batch.mutable_requests(i));
+    try {
+      _admit(*controller);
+      invoke(method, std::move(req), controller);
+    } catch (const std::exception &e) {
+      _release(*controller, false);
+      int code = static_cast<int>(ErrorCode::ThrowInMethod);
+      auto err = dynamic_cast<const std::system_error *>(&e);
+      if (err && err->code().category() == lrpcCategory())
+        code = err->code().value();
+      if (controller->batch_)
+        _completeBatchItem(*controller, nullptr, e.what(), code);
+    }
+  }
+}
+
+void ServerChannel::_completeBatchItem(Controller &controller,
+                                       const Message *response,
+                                       const std::string &error, int code) {
+  // 每个 request 只完成一次
+  auto reply = std::move(controller.batch_);
+  Response &item = reply->responses[controller.batchIndex_];
+  if (!code && controller.Failed()) {
+    code = static_cast<int>(ErrorCode::ThrowInMethod);
+    item.mutable_error()->set_msg(controller.ErrorText());
+  } else if (code) {
+    item.mutable_error()->set_msg(error);
+  } else if (!response ||
+             !response->SerializeToString(item.mutable_serialized_response())) {
+    code = static_cast<int>(ErrorCode::EncodeFail);
+    item.mutable_error()->set_msg("encode response failed");
+  }
+  if (code)
+    item.mutable_error()->set_errnum(code);
+  // 最后一个完成的 request 发送整批的 response
+  if (reply->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+  auto conn = reply->conn.lock();
+  if (!conn)
+    return;
+  if (conn->getLoop()->isInLoopThread())
+    _sendBatchReply(conn, *reply);
+  else
+    conn->getLoop()->runInLoop(
+        [this, conn, reply] { _sendBatchReply(conn, *reply); });
+}
+
+/// @brief 超过 chunkSize 的 BatchResponse 分块发送
+void ServerChannel::_sendBatchReply(const TcpConnectionPtr &conn,
+                                    BatchReply &reply) {
+  assert(conn->getLoop()->isInLoopThread());
+  RpcMessage message;
+  BatchResponse *batch = message.mutable_batch_response();
+  batch->mutable_header()->set_id(reply.id);
+  _fillCompressInfo(batch->mutable_header());
+  batch->mutable_responses()->Reserve(static_cast<int>(reply.responses.size()));
+  for (auto &response : reply.responses)
+    batch->add_responses()->Swap(&response);
+  const size_t chunkSize = service_->chunkSize();
+  if (chunkSize && encoder_.framed() && message.ByteSizeLong() > chunkSize) {
+    std::string bytes;
+    if (!message.SerializeToString(&bytes)) {
+      LOG_ERROR << "encode batch response " << reply.id << " failed";
+      return;
+    }
+    if (!chunkWriter_)
+      chunkWriter_ = std::make_shared<ChunkWriter>(conn, chunkSize);
+    chunkWriter_->write(std::move(bytes));
+    return;
+  }
+  Buffer bytes = encoder_.bytesEncoder_(message);
+  conn->send(bytes);
+}
+
+/// @brief 占用 Service 并发限制的一个名额，超过限制的时候抛出 Overloaded，
+/// 此时 request 还没有解码，handler 也不会执行
+void ServerChannel::_admit(Controller &controller) {
+  auto limiter = service_->concurrencyLimiter();
+  if (!limiter)
+    return;
+  if (!limiter->tryAcquire(controller.priority_))
+    throw Exception(ErrorCode::Overloaded,
+                    service_->fullName() + " inflight limit " +
+                        std::to_string(limiter->limit()));
+  controller.limiter_ = limiter;
+  controller.startTime_ = Timestamp::now();
+}
+
+/// @brief 归还名额，completed 表示 handler 正常完成，此时用执行时间调整限制.
+/// 不访问 ServerChannel，handler 完成的时候连接可能已经销毁
+void ServerChannel::_release(Controller &controller, bool completed) {
+  auto limiter = controller.limiter_;
+  if (!limiter)
+    return;
+  controller.limiter_ = nullptr;
+  if (!completed) {
+    limiter->onDropped();
+    return;
+  }
+  const int64_t us = Timestamp::now().microSecondsSinceEpoch() -
+                     controller.startTime_.microSecondsSinceEpoch();
+  limiter->onComplete(std::chrono::microseconds(us > 0 ? us : 0));
+}
+
 void ServerChannel::invoke(const std::string &methodName,
-                           std::shared_ptr<Message> &&req) {
+                           std::shared_ptr<Message> &&req,
+                           const std::shared_ptr<Controller> &controller) {
   const auto googleService = service_->getService();
   auto method = googleService->GetDescriptor()->FindMethodByName(methodName);
   if (!method) {
@@ -65,14 +297,126 @@ void ServerChannel::invoke(const std::string &methodName,
     throw Exception(ErrorCode::NoSuchMethod,
                     "Not find method [" + methodName + "]");
   }
+  if (auto batcher = service_->_batcher(method, conn_->getLoop())) {
+    batcher->add(RequestBatcher::Call{conn_, this, currentId_, std::move(req),
+                                      controller});
+    return;
+  }
+  auto pool = service_->_executor(method);
+  if (!pool) {
+    _callMethod(method, std::move(req), controller, currentId_);
+    return;
+  }
+  // 解码和 handler 都在 worker 线程中执行，IO loop 只负责收发数据.
+  // worker 持有连接，执行期间 ServerChannel 不会被销毁. 线程池先执行
+  // 高优先级的请求
+  TcpConnectionPtr conn(conn_->shared_from_this());
+  const int id = currentId_;
+  pool->Schedule([this, conn, method, req = std::move(req), controller, id]() {
+    if (controller->expired()) {
+      // 在线程池队列中等待的时候已经过期，和 IO loop 中一样直接丢弃
+      _release(*controller, false);
+      return;
+    }
+    try {
+      _callMethod(method, req, controller, id);
+    } catch (const std::exception &e) {
+      _replyException(conn, id, *controller, method, e);
+    }
+  }, priorityRank(controller->priority()));
+}
+
+void ServerChannel::_replyException(const TcpConnectionPtr &conn, int id,
+                                    Controller &controller,
+                                    const MethodDescriptor *method,
+                                    const std::exception &e) {
+  _release(controller, false);
+  int code = static_cast<int>(ErrorCode::ThrowInMethod);
+  auto err = dynamic_cast<const std::system_error *>(&e);
+  if (err && err->code().category() == lrpcCategory())
+    code = err->code().value();
+  LOG_WARN << "exception in worker, method " << method->full_name() << ": "
+           << e.what();
+  if (controller.batch_) {
+    _completeBatchItem(controller, nullptr, e.what(), code);
+    return;
+  }
+  if (controller.oneway())
+    return;
+  conn->getLoop()->runInLoop(std::bind(&ServerChannel::_sendError, this, conn,
+                                       id, std::string(e.what()), code));
+}
 
+std::shared_ptr<Message>
+ServerChannel::_decodeRequest(const MethodDescriptor *method,
+                              std::shared_ptr<Message> req) const {
   // TODO 为啥要 MessageToMessage decoder
   if (decoder_.messageDecoder_) {
     std::unique_ptr<Message> request(
-        googleService->GetRequestPrototype(method).New());
+        service_->getService()->GetRequestPrototype(method).New());
     decoder_.messageDecoder_(*req, *request);
     req.reset(request.release());
   }
+  return req;
+}
+
+/// @brief 过期的请求直接丢弃，解码失败的请求单独回复错误，剩下的请求
+/// 一起交给 handler. handler 返回之后每个请求按照 handleMethodDone 发送
+void ServerChannel::_runBatch(const MethodDescriptor *method,
+                              const BatchHandler &handler,
+                              std::vector<RequestBatcher::Call> &calls) {
+  std::vector<RequestBatcher::Call *> live;
+  std::vector<std::shared_ptr<Message>> responses;
+  Batch batch;
+  live.reserve(calls.size());
+  responses.reserve(calls.size());
+  batch.requests.reserve(calls.size());
+  batch.responses.reserve(calls.size());
+  batch.controllers.reserve(calls.size());
+  for (auto &call : calls) {
+    if (call.controller->expired()) {
+      _release(*call.controller, false);
+      continue;
+    }
+    try {
+      call.request = call.channel->_decodeRequest(method, std::move(call.request));
+    } catch (const std::exception &e) {
+      call.channel->_replyException(call.conn, call.id, *call.controller,
+                                    method, e);
+      continue;
+    }
+    responses.emplace_back(call.channel->service_->getService()
+                               ->GetResponsePrototype(method)
+                               .New());
+    live.push_back(&call);
+    batch.requests.push_back(call.request.get());
+    batch.responses.push_back(responses.back().get());
+    batch.controllers.push_back(call.controller.get());
+  }
+  if (live.empty())
+    return;
+  try {
+    handler(batch);
+  } catch (const std::exception &e) {
+    for (auto call : live)
+      call->channel->_replyException(call->conn, call->id, *call->controller,
+                                     method, e);
+    return;
+  }
+  for (size_t i = 0; i < live.size(); ++i) {
+    auto call = live[i];
+    call->channel->handleMethodDone(call->conn, call->id, call->controller,
+                                    std::move(responses[i]));
+  }
+}
+
+/// @brief 解码 request 并调用 handler，可能在 IO loop 或者 worker 线程中执行
+void ServerChannel::_callMethod(const MethodDescriptor *method,
+                                std::shared_ptr<Message> req,
+                                const std::shared_ptr<Controller> &controller,
+                                int id) {
+  const auto googleService = service_->getService();
+  req = _decodeRequest(method, std::move(req));
   /**
    * @brief protobuf callMethod 函数接受 raw pointer
    * 因此会导致内存泄漏，这里在 Closure::Run 执行结束的时候 delete this
@@ -81,30 +425,154 @@ void ServerChannel::invoke(const std::string &methodName,
       googleService->GetResponsePrototype(method).New());
   std::weak_ptr<TcpConnection> wconn(conn_->shared_from_this());
   // 绑定 CallMethod 回调函数
-  auto done = new Closure(&ServerChannel::handleMethodDone, this, wconn,
-                          currentId_, response);
-  // 执行函数
-  googleService->CallMethod(method, nullptr, req.get(), response.get(), done);
+  auto done = new Closure(&ServerChannel::handleMethodDone, this, wconn, id,
+                          controller, response);
+  // 执行函数，handler 中嵌套的 call() 通过 Controller::current() 继承截止时间
+  Controller::CurrentScope scope(controller.get());
+  googleService->CallMethod(method, controller.get(), req.get(),
+                            response.get(), done);
 }
 
-/// @brief rpc call 执行结束的时候会调用
+/// @brief rpc call 执行结束的时候会调用，可能在任意线程中执行.
+/// response 在调用线程中序列化，只有发送在连接所属的 loop 中执行
 void ServerChannel::handleMethodDone(std::weak_ptr<TcpConnection> wconn, int id,
+                                     std::shared_ptr<Controller> controller,
                                      std::shared_ptr<Message> response) {
-  // 判断连接是否已经断开
-  if (!wconn.lock())
+  // 连接断开的时候 handler 也已经执行完了，先归还名额
+  _release(*controller, true);
+  if (controller->batch_) {
+    _completeBatchItem(*controller, response.get());
+    return;
+  }
+  if (controller->oneway()) {
+    if (controller->Failed())
+      LOG_DEBUG << "oneway request " << id << " failed: "
+                << controller->ErrorText();
     return;
+  }
+  // 判断连接是否已经断开
   auto conn = wconn.lock();
+  if (!conn)
+    return;
+  // 携带附件的 response 只能用默认的 frame 格式发送，不进入缓存
+  const bool attached =
+      !controller->Failed() && !controller->responseAttachment_.empty();
+  const size_t chunkSize = service_->chunkSize();
+  if (!attached && chunkSize && response && !controller->Failed() &&
+      encoder_.framed() && response->ByteSizeLong() > chunkSize) {
+    _sendChunked(conn, id, *controller, *response);
+    return;
+  }
+  if (attached ? encoder_.framed()
+               : encoder_.inPlace() && !controller->cache_) {
+    _sendInPlace(conn, id, *controller, response.get());
+    return;
+  }
+  if (attached)
+    LOG_ERROR << "response attachment of request " << id
+              << " dropped: custom encoder of [" << service_->fullName()
+              << "] does not support attachments";
   // 解析 Protobuf ResponseMessage
-  RpcMessage message;
-  Response *resp = message.mutable_response();
+  auto message = std::make_shared<RpcMessage>();
+  Response *resp = message->mutable_response();
   if (id >= 0)
     resp->set_id(id);
-  bool success = encoder_.messageEncoder_(response.get(), message);
+  bool success;
+  if (controller->Failed()) {
+    // handler 调用了 SetFailed，返回错误信息
+    resp->mutable_error()->set_msg(controller->ErrorText());
+    resp->mutable_error()->set_errnum(
+        static_cast<int>(ErrorCode::ThrowInMethod));
+    success = encoder_.messageEncoder_(nullptr, *message);
+  } else {
+    success = encoder_.messageEncoder_(response.get(), *message);
+    if (controller->cache_)
+      controller->cache_->put(controller->cacheKey_,
+                              resp->serialized_response(), Timestamp::now());
+  }
   assert(success);
+  (void)success;
 
+  if (conn->getLoop()->isInLoopThread())
+    _sendResponse(conn, *message);
+  else
+    conn->getLoop()->runInLoop([this, conn, message] {
+      _sendResponse(conn, *message);
+    });
+}
+
+/// @brief 默认编码器的 response 不经过 serialized_response：在 loop 中直接
+/// 编码到连接的发送缓冲区，在 worker 线程中编码到一个 Buffer 再转移给 loop
+void ServerChannel::_sendInPlace(const TcpConnectionPtr &conn, int id,
+                                 const Controller &controller,
+                                 const Message *response) {
+  Response header;
+  if (id >= 0)
+    header.set_id(id);
+  if (controller.Failed()) {
+    // handler 调用了 SetFailed，返回错误信息
+    header.mutable_error()->set_msg(controller.ErrorText());
+    header.mutable_error()->set_errnum(
+        static_cast<int>(ErrorCode::ThrowInMethod));
+    response = nullptr;
+  }
+  _fillCompressInfo(&header);
+  // 附件紧跟在 frame 的 protobuf 部分之后发送，不拷贝到临时缓冲区
+  const Attachment *attachment =
+      response && !controller.responseAttachment_.empty()
+          ? &controller.responseAttachment_
+          : nullptr;
+  const size_t attachmentSize = attachment ? attachment->size() : 0;
+  if (conn->getLoop()->isInLoopThread()) {
+    if (conn->sendInPlace([&](Buffer *out) {
+          responseBytesEncode(header, response, out, attachmentSize);
+        }) &&
+        attachment)
+      attachment->sendTo(conn);
+  } else {
+    Buffer bytes;
+    responseBytesEncode(header, response, &bytes, attachmentSize);
+    // send 和附件的发送按照顺序在 loop 中执行
+    if (conn->send(bytes) && attachment)
+      conn->getLoop()->runInLoop(
+          [conn, attachment = *attachment] { attachment.sendTo(conn); });
+  }
+}
+
+/// @brief 超过 chunkSize 的 response 序列化之后交给 ChunkWriter 分块发送，
+/// 分块的 response 不压缩
+void ServerChannel::_sendChunked(const TcpConnectionPtr &conn, int id,
+                                 const Controller &controller,
+                                 const Message &response) {
+  Response header;
+  if (id >= 0)
+    header.set_id(id);
+  _fillCompressInfo(&header);
+  auto message = std::make_shared<std::string>();
+  responseSerialize(header, &response, message.get());
+  if (controller.cache_)
+    controller.cache_->put(controller.cacheKey_, response.SerializeAsString(),
+                           Timestamp::now());
+  auto send = [this, conn, message] {
+    if (!chunkWriter_)
+      chunkWriter_ = std::make_shared<ChunkWriter>(conn, service_->chunkSize());
+    chunkWriter_->write(std::move(*message));
+  };
+  if (conn->getLoop()->isInLoopThread())
+    send();
+  else
+    conn->getLoop()->runInLoop(std::move(send));
+}
+
+/// @brief 补充压缩信息，编码之后发送，在连接所属的 loop 中调用
+void ServerChannel::_sendResponse(const TcpConnectionPtr &conn,
+                                  RpcMessage &message) {
+  assert(conn->getLoop()->isInLoopThread());
+  Response *resp = message.mutable_response();
+  _fillCompressInfo(resp);
   if (encoder_.bytesEncoder_) {
     Buffer bytes = encoder_.bytesEncoder_(message);
-    conn->send(bytes.retrieveAsString());
+    conn->send(bytes);
   } else {
     // TODO serialized_response 什么意思
     const auto &bytes = resp->serialized_response();
@@ -112,25 +580,117 @@ void ServerChannel::handleMethodDone(std::weak_ptr<TcpConnection> wconn, int id,
   }
 }
 
-/// @brief rpc call 出现错误的时候会被调用
-void ServerChannel::_onError(const std::exception &err, int code) {
-  assert(conn_->getLoop()->isInLoopThread());
+/// @brief 发送缓存的 response，不需要再次序列化 response message
+void ServerChannel::_sendCached(int id, const std::string &response) {
   RpcMessage message;
   Response *resp = message.mutable_response();
-  if (currentId_ != -1)
-    resp->set_id(currentId_);
-  resp->mutable_error()->set_msg(err.what());
+  if (id != -1)
+    resp->set_id(id);
+  resp->set_serialized_response(response);
+  _sendResponse(conn_, message);
+}
+
+void ServerChannel::_sendError(const TcpConnectionPtr &conn, int id,
+                               const std::string &msg, int code) {
+  RpcMessage message;
+  Response *resp = message.mutable_response();
+  if (id != -1)
+    resp->set_id(id);
+  resp->mutable_error()->set_msg(msg);
   resp->mutable_error()->set_errnum(code);
   bool success = encoder_.messageEncoder_(nullptr, message);
   assert(success);
-  if (encoder_.bytesEncoder_) {
-    Buffer bytes = encoder_.bytesEncoder_(message);
-    conn_->send(bytes.retrieveAsString());
-  } else {
-    // TODO serialized_response 什么意思
-    const auto &bytes = resp->serialized_response();
-    conn_->send(bytes);
+  (void)success;
+  _sendResponse(conn, message);
+}
+
+/// @brief rpc call 出现错误的时候会被调用
+void ServerChannel::_onError(const std::exception &err, int code) {
+  if (currentOneway_)
+    return;
+  _sendError(conn_, currentId_, err.what(), code);
+}
+
+/// @brief 连接断开的时候调用，结束连接上所有的 stream，取消所有的订阅
+void ServerChannel::onDestory() {
+  if (streams_)
+    streams_->closeAll(Exception(ErrorCode::ConnectionLost,
+                                 conn_->peerAddress().toHostPort()));
+  for (const auto &topic : topics_)
+    service_->_unsubscribe(topic, conn_.get());
+  topics_.clear();
+}
+
+void ServerChannel::_onPushFrame(const PushFrame &frame) {
+  if (frame.service_name() != service_->fullName()) {
+    LOG_ERROR << "subscribe " << frame.topic() << " of "
+              << frame.service_name() << ", but expect ["
+              << service_->fullName() << "]";
+    return;
+  }
+  switch (frame.type()) {
+  case PushFrame::SUBSCRIBE:
+    if (topics_.insert(frame.topic()).second)
+      service_->_subscribe(frame.topic(), conn_);
+    break;
+  case PushFrame::UNSUBSCRIBE:
+    if (topics_.erase(frame.topic()))
+      service_->_unsubscribe(frame.topic(), conn_.get());
+    break;
+  default:
+    LOG_ERROR << "unexpected push frame " << frame.type() << " from "
+              << conn_->peerAddress().toHostPort();
+    break;
+  }
+}
+
+void ServerChannel::_onStreamFrame(StreamFrame &frame) {
+  if (!streams_)
+    streams_ = std::make_shared<StreamSet>(conn_, &encoder_);
+  if (frame.type() != StreamFrame::OPEN) {
+    streams_->onFrame(frame);
+    return;
+  }
+  if (streams_->find(frame.id())) {
+    LOG_ERROR << "duplicate stream id " << frame.id() << " from "
+              << conn_->peerAddress().toHostPort();
+    return;
+  }
+  if (frame.service_name() != service_->fullName()) {
+    streams_->cancel(frame.id(), ErrorCode::NoSuchService,
+                     frame.service_name() + " got, but expect [" +
+                         service_->fullName() + "]");
+    return;
   }
+  auto it = service_->streamHandlers_.find(frame.method_name());
+  if (it == service_->streamHandlers_.end()) {
+    streams_->cancel(frame.id(), ErrorCode::NoSuchMethod,
+                     "Not find stream method [" + frame.method_name() + "]");
+    return;
+  }
+  const auto googleService = service_->getService();
+  auto method =
+      googleService->GetDescriptor()->FindMethodByName(frame.method_name());
+  auto stream = std::make_shared<Stream>(
+      frame.id(), conn_->getLoop(), &googleService->GetRequestPrototype(method));
+  streams_->add(stream);
+  it->second(stream);
+}
+
+/// @brief 每个连接只协商一次，之后的 response 都按照协商的结果压缩
+void ServerChannel::_negotiateCompress(const Request &req) {
+  compressNegotiated_ = true;
+  const auto options = negotiateCompress(
+      service_->compressOptions(), req.accept_compress(), req.compress_dict());
+  if (options.type != CompressType::None)
+    encoder_.setCompression(options);
+}
+
+/// @brief 在 response 中告诉客户端服务端支持的解压算法
+void ServerChannel::_fillCompressInfo(Response *resp) const {
+  resp->set_accept_compress(supportedCompressMask());
+  if (service_->compressOptions().dictId)
+    resp->set_compress_dict(service_->compressOptions().dictId);
 }
 
 /// -------------- ClientChannel --------------
@@ -138,20 +698,40 @@ void ServerChannel::_onError(const std::exception &err, int code) {
 static const std::string idStr("id");
 static const std::string svrStr("service_name");
 static const std::string methodStr("method_name");
-thread_local int ClientChannel::reqId_{0};
 
-/// @brief 构造函数，启动一个 run every 事件，用来检查过期的请求
 ClientChannel::ClientChannel(TcpConnectionPtr &&conn, ClientStub *service)
-    : conn_(std::move(conn)), service_(service), encoder_(requestEncode) {
-  pendingTimeoutId_ = conn->getLoop()->runEvery(
-      1.0, std::bind(&ClientChannel::_checkPendingTimeout, this));
-}
+    : conn_(conn), service_(service),
+      assembler_(conn->getLoop(), service->chunkLimits()),
+      encoder_(requestEncode) {}
 
-int ClientChannel::generateId() { return ++reqId_; }
+/// @brief 保存请求上下文，并在所属 loop 的 DeadlineQueue 中登记超时时间
+int ClientChannel::_addPendingCall(Promise<std::shared_ptr<Message>> &&promise,
+                                   std::chrono::milliseconds timeout) {
+  if (!deadlines_)
+    deadlines_ = RPC_SERVER.deadlineQueue(conn_.lock()->getLoop());
+  PendingCalls::Call call;
+  call.promise = std::move(promise);
+  call.sendTime = Timestamp::now();
+  call.deadline = addTime(call.sendTime, timeout.count() / 1000.0);
+  const Timestamp deadline = call.deadline;
+  const int id = pendingCalls_.add(std::move(call));
+  if (id < 0)
+    return id;
+  deadlines_->add(deadline, shared_from_this(), id);
+  if (stats_)
+    stats_->onSend();
+  if (!encoder_.bytesEncoder_)
+    orderedCalls_.push_back(id);
+  return id;
+}
 
-/// @brief 对客户端请求编码
-Buffer ClientChannel::_messageToBytesEncoder(std::string &&method,
-                                             const Message &request) {
+/// @brief 对客户端请求编码并发送. 附件紧跟在 frame 的 protobuf 部分之后；
+/// 序列化之后超过 chunkSize 的请求交给 ChunkWriter 分块发送
+bool ClientChannel::_sendRequest(const TcpConnectionPtr &conn,
+                                 std::string &&method, const Message &request,
+                                 int id, std::chrono::milliseconds timeout,
+                                 Priority priority, bool oneway,
+                                 const Attachment &attachment) {
   RpcMessage rpcMsg;
   encoder_.messageEncoder_(&request, rpcMsg);
   // mutable 方法的含义
@@ -160,78 +740,489 @@ Buffer ClientChannel::_messageToBytesEncoder(std::string &&method,
     req->set_service_name(service_->fullName());
   if (!hasField(*req, methodStr))
     req->set_method_name(std::move(method));
-  if (!hasField(*req, idStr))
-    req->set_id(generateId()); // id 唯一标识了 request
-  else
-    reqId_ = req->id();
+  req->set_id(id); // id 唯一标识了 request，对应 pendingCalls_ 中的 slot
+  // 剩余的时间预算，服务端据此丢弃已经过期的请求
+  req->set_timeout_ms(timeout.count());
+  req->set_priority(priority);
+  if (oneway)
+    req->set_oneway(true);
+  // 告诉服务端客户端支持的解压算法
+  req->set_accept_compress(supportedCompressMask());
+  if (service_->compressOptions().dictId)
+    req->set_compress_dict(service_->compressOptions().dictId);
 
-  if (encoder_.bytesEncoder_)
-    return encoder_.bytesEncoder_(rpcMsg);
-  else {
+  // 携带附件的请求由调用者保证使用默认的 frame 格式
+  if (!attachment.empty()) {
+    Buffer bytes = attachedBytesEncode(rpcMsg, attachment.size());
+    return conn->send(bytes) && attachment.sendTo(conn);
+  }
+  if (encoder_.bytesEncoder_) {
+    return _sendFrame(conn, rpcMsg);
+  } else {
     Buffer bytes;
     const auto &data = req->serialized_request();
     bytes.append(data.data(), data.size());
-    return bytes;
+    return conn->send(bytes);
+  }
+}
+
+bool ClientChannel::_sendFrame(const TcpConnectionPtr &conn,
+                               const RpcMessage &frame) {
+  const size_t chunkSize = service_->chunkSize();
+  if (chunkSize && encoder_.framed() && frame.ByteSizeLong() > chunkSize) {
+    std::string message;
+    if (!frame.SerializeToString(&message))
+      throw Exception(ErrorCode::EncodeFail);
+    if (!chunkWriter_)
+      chunkWriter_ = std::make_shared<ChunkWriter>(conn_, chunkSize);
+    return chunkWriter_->write(std::move(message));
   }
+  Buffer bytes = encoder_.bytesEncoder_(frame);
+  return conn->send(bytes);
+}
+
+Future<std::shared_ptr<Message>>
+ClientChannel::invokeBatch(const std::string &method,
+                           const std::vector<std::shared_ptr<Message>> &requests,
+                           const CallOptions &options) {
+  auto conn = conn_.lock();
+  if (!conn)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::ConnectionLost,
+                  "Connection lost: method [" + method + "] service [" +
+                      service_->fullName() + "]"));
+  return _execute<std::shared_ptr<Message>>(
+      conn, [method, requests, options](ClientChannel *channel) {
+        return channel->_invokeBatch(method, requests, options);
+      });
+}
+
+/// @brief 在连接所属的 loop 中编码并发送整批请求，request 直接序列化到
+/// BatchRequest 中
+Future<std::shared_ptr<Message>> ClientChannel::_invokeBatch(
+    const std::string &method,
+    const std::vector<std::shared_ptr<Message>> &requests,
+    const CallOptions &options) {
+  auto conn = _connection();
+  if (!conn)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::ConnectionLost, service_->fullName()));
+  if (!service_->getService()->GetDescriptor()->FindMethodByName(method))
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::NoSuchMethod, "method [" + method +
+                                               "], sevice [" +
+                                               service_->fullName() + "]"));
+  // 自定义协议没有 frame 格式，不能把多个请求放在一个 frame 中
+  if (!encoder_.framed())
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::EncodeFail, "batch call needs lrpc protocol: "
+                                         "method [" +
+                                             method + "], service [" +
+                                             service_->fullName() + "]"));
+  RpcMessage frame;
+  BatchRequest *batch = frame.mutable_batch_request();
+  batch->mutable_requests()->Reserve(static_cast<int>(requests.size()));
+  for (const auto &request : requests) {
+    if (!request->SerializeToString(batch->add_requests()))
+      return makeExceptionFuture<std::shared_ptr<Message>>(Exception(
+          ErrorCode::EncodeFail, "batch request of method [" + method + "]"));
+  }
+  Promise<std::shared_ptr<Message>> promise;
+  auto fut = promise.getFuture();
+  const auto timeout =
+      options.timeout.count() > 0 ? options.timeout : kDefaultCallTimeout;
+  const int id = _addPendingCall(std::move(promise), timeout);
+  if (id < 0)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::TooManyPendingCalls,
+                  "too many pending calls: method [" + method +
+                      "], service [" + service_->fullName() + "]"));
+  _fillHeader(batch->mutable_header(), method, id, timeout, options.priority);
+  if (!_sendFrame(conn, frame))
+    return _sendFailed(id, method);
+  return fut;
+}
+
+Future<std::shared_ptr<Message>> ClientChannel::invokeSerialized(
+    const std::string &method, const std::shared_ptr<const std::string> &request,
+    const CallOptions &options) {
+  auto conn = conn_.lock();
+  if (!conn)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::ConnectionLost,
+                  "Connection lost: method [" + method + "] service [" +
+                      service_->fullName() + "]"));
+  return _execute<std::shared_ptr<Message>>(
+      conn, [method, request, options](ClientChannel *channel) {
+        return channel->_invokeSerialized(method, request, options);
+      });
+}
+
+/// @brief 没有压缩和分块的时候 request 的字节直接拷贝到连接的发送缓冲区，
+/// 否则拷贝到 serialized_request 之后按照普通的 frame 发送
+Future<std::shared_ptr<Message>> ClientChannel::_invokeSerialized(
+    const std::string &method, const std::shared_ptr<const std::string> &request,
+    const CallOptions &options) {
+  auto conn = _connection();
+  if (!conn)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::ConnectionLost, service_->fullName()));
+  if (!service_->getService()->GetDescriptor()->FindMethodByName(method))
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::NoSuchMethod, "method [" + method +
+                                               "], sevice [" +
+                                               service_->fullName() + "]"));
+  if (!encoder_.framed())
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::EncodeFail, "serialized call needs lrpc "
+                                         "protocol: method [" +
+                                             method + "], service [" +
+                                             service_->fullName() + "]"));
+  Promise<std::shared_ptr<Message>> promise;
+  auto fut = promise.getFuture();
+  const auto timeout =
+      options.timeout.count() > 0 ? options.timeout : kDefaultCallTimeout;
+  const int id = _addPendingCall(std::move(promise), timeout);
+  if (id < 0)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        Exception(ErrorCode::TooManyPendingCalls,
+                  "too many pending calls: method [" + method +
+                      "], service [" + service_->fullName() + "]"));
+  RpcMessage frame;
+  Request *header = frame.mutable_request();
+  _fillHeader(header, method, id, timeout, options.priority);
+  const size_t chunkSize = service_->chunkSize();
+  bool sent;
+  if (encoder_.inPlace() && !(chunkSize && request->size() > chunkSize)) {
+    sent = conn->sendInPlace(
+        [&](Buffer *out) { requestBytesEncode(*header, *request, out); });
+  } else {
+    header->set_serialized_request(*request);
+    sent = _sendFrame(conn, frame);
+  }
+  if (!sent)
+    return _sendFailed(id, method);
+  return fut;
+}
+
+void ClientChannel::_fillHeader(Request *header, const std::string &method,
+                                int id, std::chrono::milliseconds timeout,
+                                Priority priority) const {
+  header->set_id(id);
+  header->set_service_name(service_->fullName());
+  header->set_method_name(method);
+  header->set_timeout_ms(timeout.count());
+  header->set_priority(priority);
+  header->set_accept_compress(supportedCompressMask());
+  if (service_->compressOptions().dictId)
+    header->set_compress_dict(service_->compressOptions().dictId);
+}
+
+void ClientChannel::_dropPendingCall(int id) {
+  PendingCalls::Call call;
+  if (!pendingCalls_.take(id, &call))
+    return;
+  // 没有发送出去的请求不会有 response，不能在 orderedCalls_ 中占位
+  if (!orderedCalls_.empty() && orderedCalls_.back() == id)
+    orderedCalls_.pop_back();
+  deadlines_->cancelled();
+  _onCallDone(call, false);
+}
+
+Future<std::shared_ptr<Message>>
+ClientChannel::_sendFailed(int id, const std::string &method) {
+  _dropPendingCall(id);
+  return makeExceptionFuture<std::shared_ptr<Message>>(
+      Exception(ErrorCode::ConnectionReset,
+                "send failed: method [" + method + "], service [" +
+                    service_->fullName() + "]"));
 }
 
 /// @brief 收到消息的时候会被调用，返回解码之后的消息
+/// 分块消息组装完成的时候代替最后一个 chunk 返回
 std::shared_ptr<Message> ClientChannel::onData(const char *&data, size_t len) {
-  return decoder_.bytesDecoder_(data, len); // bytes -> Message
+  auto msg = decoder_.bytesDecoder_(data, len); // bytes -> Message
+  auto frame = dynamic_cast<RpcMessage *>(msg.get());
+  if (frame && frame->has_chunk()) {
+    if (auto whole = assembler_.onChunk(*frame->mutable_chunk()))
+      return whole;
+  }
+  return msg;
 }
 
 /// @brief 在 onData 之后会被调用，
 bool ClientChannel::onMessage(std::shared_ptr<Message> msg) {
+  PendingCalls::Call call;
   RpcMessage *frame = dynamic_cast<RpcMessage *>(msg.get());
+  if (frame && frame->has_chunk())
+    return true; // 还没有组装完成的分块消息
+  if (frame && frame->has_stream()) {
+    if (streams_)
+      streams_->onFrame(*frame->mutable_stream());
+    return true;
+  }
+  if (frame && frame->has_push()) {
+    _onPushFrame(*frame->mutable_push());
+    return true;
+  }
   if (frame) {
-    assert(hasField(frame->response(), idStr));
-    // 找到请求对应的 RequestContext，如果没有则可能这个请求已经超时了
-    const int id = frame->response().id();
-    auto it = pendingCalls_.find(id);
-    if (it != pendingCalls_.end()) {
+    // 批量请求的 response 由 header 标识
+    const Response &resp = frame->has_batch_response()
+                               ? frame->batch_response().header()
+                               : frame->response();
+    assert(hasField(resp, idStr));
+    // 找到请求对应的 slot，并从 waiting list 中删除这个请求
+    // 如果没有则可能这个请求已经超时了
+    const int id = resp.id();
+    if (!compressNegotiated_ && resp.accept_compress())
+      _negotiateCompress(resp);
+    if (pendingCalls_.take(id, &call)) {
+      deadlines_->cancelled();
+      // 服务端返回的错误也计入 endpoint 的失败次数
+      _onCallDone(call, !resp.has_error());
       // 设置 request 对应的 promise
-      it->second.promise.setValue(std::move(msg));
+      call.promise.setValue(std::move(msg));
     } else {
       LOG_ERROR << "ClientChannel::onMessage can not find " << id
                 << ", maybe TIMEOUT already";
     }
-    // 从 waiting list 中删除这个请求
-    pendingCalls_.erase(it);
     return true;
   }
-  // TODO Message 无法向下转型
+  // 自定义协议的 response 按照发送顺序匹配最早发送的请求. 超时的请求仍然
+  // 留在 orderedCalls_ 中占位，它迟到的 response 在这里被丢弃，
+  // 不会错配给后面的请求
   LOG_INFO << "Don't panic: RpcMessage bad_cast, may be text message";
-  auto it = pendingCalls_.begin();
-  it->second.promise.setValue(std::move(msg));
-  pendingCalls_.erase(it);
+  if (orderedCalls_.empty()) {
+    LOG_ERROR << "ClientChannel::onMessage unexpected response, service "
+              << service_->fullName();
+    return false;
+  }
+  const int id = orderedCalls_.front();
+  orderedCalls_.pop_front();
+  if (pendingCalls_.take(id, &call)) {
+    deadlines_->cancelled();
+    _onCallDone(call, true);
+    call.promise.setValue(std::move(msg));
+  } else {
+    LOG_ERROR << "ClientChannel::onMessage drop response of call " << id
+              << ", maybe TIMEOUT already";
+  }
   return false;
 }
 
-/// @brief channel 被销毁的时候会执行
-/// 如果有定时任务并且 connection 还没有销毁，则取消定时任务
+/// @brief channel 被销毁的时候会执行，等待 response 的请求立即以
+/// ConnectionLost 失败，它们在 DeadlineQueue 中的元素都会失效
 void ClientChannel::onDestory() {
-  if (!pendingTimeoutId_.empty()) {
-    auto conn = conn_.lock();
-    if (conn)
-      conn->getLoop()->cancel(pendingTimeoutId_);
-    pendingTimeoutId_.reset();
+  destroyed_ = true;
+  std::vector<PendingCalls::Call> calls;
+  pendingCalls_.takeAll(&calls);
+  orderedCalls_.clear();
+  if (deadlines_)
+    deadlines_->cancelled(calls.size());
+  if (stats_)
+    stats_->onAbandoned(static_cast<int>(calls.size()));
+  const auto lost = Exception(ErrorCode::ConnectionLost,
+                              "service " + service_->fullName());
+  if (streams_)
+    streams_->closeAll(lost);
+  for (auto &call : calls)
+    call.promise.setException(std::make_exception_ptr(lost));
+  std::unordered_set<std::string> topics;
+  topics.swap(topics_);
+  for (const auto &topic : topics)
+    service_->onSubscriptionLost(topic, this, std::make_exception_ptr(lost));
+}
+
+void ClientChannel::_onPushFrame(PushFrame &frame) {
+  if (frame.type() != PushFrame::PUBLISH) {
+    LOG_ERROR << "unexpected push frame " << frame.type() << " from "
+              << endpoint_.ip() << ":" << endpoint_.port();
+    return;
   }
+  // 取消订阅之后仍然可能收到已经在路上的推送
+  if (!topics_.count(frame.topic()))
+    return;
+  if (service_->onPush())
+    service_->onPush()(frame.topic(),
+                       Result<std::string>(std::move(*frame.mutable_payload())));
 }
 
-void ClientChannel::_checkPendingTimeout() {
-  auto now = Timestamp::now();
-  for (auto it = pendingCalls_.begin(); it != pendingCalls_.end();) {
-    // it 后续的都不会到期，按照时间排序
-    if (now < addTime(it->second.timestamp, 60.0))
-      return;
-    if (it->second.promise.isReady()) { // 提示删除了已经准备好的 context
-      LOG_DEBUG << "checkout for erase pending call id: " << it->first;
-    } else { // 提示删除了超时的 context
-      LOG_ERROR << "TIMEOUT: Checkout for pending call id: " << it->first;
-    }
-    // 从 waiting list 中移除 context
-    it = pendingCalls_.erase(it);
+Future<void> ClientChannel::subscribe(const std::string &topic) {
+  auto conn = conn_.lock();
+  if (!conn)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::ConnectionLost,
+                  "subscribe [" + topic + "] service [" +
+                      service_->fullName() + "]"));
+  return _execute<void>(conn, [topic](ClientChannel *channel) {
+    return channel->_subscribe(topic, true);
+  });
+}
+
+Future<void> ClientChannel::unsubscribe(const std::string &topic) {
+  auto conn = conn_.lock();
+  if (!conn)
+    return makeReadyFuture();
+  return _execute<void>(conn, [topic](ClientChannel *channel) {
+    return channel->_subscribe(topic, false);
+  });
+}
+
+/// @brief 在连接所属的 loop 中发送 SUBSCRIBE / UNSUBSCRIBE
+Future<void> ClientChannel::_subscribe(const std::string &topic, bool on) {
+  auto conn = _connection();
+  if (!conn)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::ConnectionLost, service_->fullName()));
+  // 自定义协议没有 frame 格式，不支持推送
+  if (!encoder_.bytesEncoder_)
+    return makeExceptionFuture<void>(Exception(
+        ErrorCode::EncodeFail, "subscribe needs lrpc protocol: " + topic));
+  if (on ? !topics_.insert(topic).second : !topics_.erase(topic))
+    return makeReadyFuture();
+  RpcMessage frame;
+  PushFrame *f = frame.mutable_push();
+  f->set_type(on ? PushFrame::SUBSCRIBE : PushFrame::UNSUBSCRIBE);
+  f->set_service_name(service_->fullName());
+  f->set_topic(topic);
+  Buffer bytes = encoder_.bytesEncoder_(frame);
+  if (!conn->send(bytes)) {
+    if (on)
+      topics_.erase(topic);
+    return makeExceptionFuture<void>(Exception(
+        ErrorCode::ConnectionReset, "send failed: subscribe [" + topic + "]"));
+  }
+  return makeReadyFuture();
+}
+
+/// @brief 在连接所属的 loop 中编码并发送 oneway 请求，不登记 pendingCalls_，
+/// 请求交给连接之后 future 就完成
+Future<void> ClientChannel::notify(const std::string &method,
+                                   const std::shared_ptr<Message> &request,
+                                   const CallOptions &options) {
+  auto conn = conn_.lock();
+  if (!conn)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::ConnectionLost,
+                  "method [" + method + "] service [" + service_->fullName() +
+                      "]"));
+  return _execute<void>(conn,
+                        [method, request, options](ClientChannel *channel) {
+                          return channel->_notify(method, request, options);
+                        });
+}
+
+Future<void> ClientChannel::_notify(const std::string &method,
+                                    const std::shared_ptr<Message> &request,
+                                    const CallOptions &options) {
+  auto conn = _connection();
+  if (!conn)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::ConnectionLost, service_->fullName()));
+  if (!service_->getService()->GetDescriptor()->FindMethodByName(method))
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::NoSuchMethod, "method [" + method + "], sevice [" +
+                                               service_->fullName() + "]"));
+  // 自定义协议的 response 按照请求的顺序匹配，服务端不回复会打乱顺序
+  if (!encoder_.bytesEncoder_)
+    return makeExceptionFuture<void>(Exception(
+        ErrorCode::EncodeFail, "oneway needs lrpc protocol: " + method));
+  if (!options.attachment.empty() && !encoder_.framed())
+    return makeExceptionFuture<void>(Exception(
+        ErrorCode::EncodeFail, "attachment needs lrpc protocol: " + method));
+  const auto timeout =
+      options.timeout.count() > 0 ? options.timeout : kDefaultCallTimeout;
+  std::string methodStr = method;
+  if (!_sendRequest(conn, std::move(methodStr), *request, 0, timeout,
+                    options.priority, true, options.attachment))
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::ConnectionReset,
+                  "send failed: method [" + method + "], service [" +
+                      service_->fullName() + "]"));
+  return makeReadyFuture();
+}
+
+Future<std::shared_ptr<Stream>>
+ClientChannel::openStream(const std::string &method) {
+  auto conn = conn_.lock();
+  if (!conn)
+    return makeExceptionFuture<std::shared_ptr<Stream>>(
+        Exception(ErrorCode::ConnectionLost,
+                  "method [" + method + "] service [" + service_->fullName() +
+                      "]"));
+  return _execute<std::shared_ptr<Stream>>(
+      conn, [method](ClientChannel *channel) {
+        return channel->_openStream(method);
+      });
+}
+
+Future<std::shared_ptr<Stream>>
+ClientChannel::_openStream(const std::string &method) {
+  auto conn = _connection();
+  if (!conn)
+    return makeExceptionFuture<std::shared_ptr<Stream>>(
+        Exception(ErrorCode::ConnectionLost, service_->fullName()));
+  const auto googleService = service_->getService();
+  auto desc = googleService->GetDescriptor()->FindMethodByName(method);
+  if (!desc)
+    return makeExceptionFuture<std::shared_ptr<Stream>>(
+        Exception(ErrorCode::NoSuchMethod, "method [" + method + "], sevice [" +
+                                               service_->fullName() + "]"));
+  // 自定义协议没有 frame 格式，不支持 stream
+  if (!encoder_.bytesEncoder_)
+    return makeExceptionFuture<std::shared_ptr<Stream>>(Exception(
+        ErrorCode::EncodeFail, "stream needs lrpc protocol: " + method));
+  if (!streams_)
+    streams_ = std::make_shared<StreamSet>(conn_, &encoder_);
+  auto stream =
+      std::make_shared<Stream>(streams_->nextId(), conn->getLoop(),
+                               &googleService->GetResponsePrototype(desc));
+  streams_->add(stream);
+
+  RpcMessage frame;
+  StreamFrame *f = frame.mutable_stream();
+  f->set_id(stream->id());
+  f->set_type(StreamFrame::OPEN);
+  f->set_service_name(service_->fullName());
+  f->set_method_name(method);
+  if (!streams_->send(frame)) {
+    streams_->remove(stream->id());
+    return makeExceptionFuture<std::shared_ptr<Stream>>(Exception(
+        ErrorCode::ConnectionReset, "open stream failed: " + method));
   }
+  return makeReadyFuture(std::move(stream));
+}
+
+/// @brief 收到服务端的第一个 response 之后才知道服务端支持的算法，
+/// 在此之前发送的 request 都不压缩
+void ClientChannel::_negotiateCompress(const Response &resp) {
+  compressNegotiated_ = true;
+  const auto options = negotiateCompress(
+      service_->compressOptions(), resp.accept_compress(), resp.compress_dict());
+  if (options.type != CompressType::None)
+    encoder_.setCompression(options);
+}
+
+/// @brief 请求超时，设置 Timeout 异常并立即释放 slot. 自定义协议的请求
+/// 在 orderedCalls_ 中的位置保留到它的 response 到达
+void ClientChannel::_onDeadline(int id) {
+  PendingCalls::Call call;
+  if (!pendingCalls_.take(id, &call))
+    return;
+  _onCallDone(call, false);
+  LOG_ERROR << "TIMEOUT: pending call id: " << id << ", service "
+            << service_->fullName();
+  call.promise.setException(std::make_exception_ptr(
+      Exception(ErrorCode::Timeout, "call id " + std::to_string(id))));
+}
+
+/// @brief 超时的请求按照超时时间计入延迟，慢的 endpoint 会被负载均衡避开
+void ClientChannel::_onCallDone(const PendingCalls::Call &call, bool ok) {
+  if (!stats_)
+    return;
+  const double seconds = timeDifference(Timestamp::now(), call.sendTime);
+  stats_->onComplete(
+      std::chrono::microseconds(static_cast<int64_t>(seconds * 1000000)), ok);
 }
 
-} // namespace lrpc
\ No newline at end of file
+} // namespace lrpc
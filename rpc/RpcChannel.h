@@ -2,17 +2,26 @@
 #define LRPC_RPCCHANNEL_H
 
 #include "Buffer.h"
+#include "CallOptions.h"
+#include "Chunk.h"
 #include "ClientStub.h"
 #include "Coder.h"
+#include "DeadlineQueue.h"
 #include "EventLoop.h"
+#include "LoadBalancer.h"
 #include "Logging.h"
+#include "PendingCalls.h"
+#include "RpcController.h"
 #include "RpcException.h"
 #include "RpcService.h"
+#include "Stream.h"
 #include "TcpConnection.h"
 #include "future.h"
+#include <atomic>
+#include <deque>
 #include <google/protobuf/message.h>
-#include <map>
 #include <memory>
+#include <unordered_set>
 
 namespace lrpc {
 
@@ -22,6 +31,20 @@ using namespace net;
 
 // ------------------ ServerChannel ------------------
 
+/// @brief 一个批量请求的回复，由其中所有 request 的 Controller 共享.
+/// 每个 request 完成的时候填写自己的 response，最后一个完成的 request
+/// 发送整批的 BatchResponse. 在分发之前就过期的 request 不会完成，客户端
+/// 此时也已经超时
+struct BatchReply {
+  BatchReply(const TcpConnectionPtr &c, int i, size_t n)
+      : conn(c), id(i), responses(n), remaining(n) {}
+
+  const std::weak_ptr<TcpConnection> conn;
+  const int id;
+  std::vector<Response> responses;
+  std::atomic<size_t> remaining; // 还没有完成的 request 数
+};
+
 class ServerChannel {
   friend class Service;
 
@@ -32,14 +55,57 @@ public:
   void setContext(std::shared_ptr<void> ctx);
   template <typename T> std::shared_ptr<T> getContext() const;
   std::shared_ptr<Message> onData(const char *&data, size_t len);
-  bool onMessage(std::shared_ptr<Message> &&req);
+  bool onMessage(std::shared_ptr<Message> &&req, Timestamp receiveTime);
+  void onDestory();
 
 private:
-  void invoke(const std::string &methodName,
-              std::shared_ptr<Message> &&request);
+  void invoke(const std::string &methodName, std::shared_ptr<Message> &&request,
+              const std::shared_ptr<Controller> &controller);
+  // Service 的并发限制，见 ConcurrencyLimiter
+  void _admit(Controller &controller);
+  static void _release(Controller &controller, bool completed);
+  // 解码 request 并调用 handler，在 IO loop 或者 worker 线程中执行
+  void _callMethod(const MethodDescriptor *method, std::shared_ptr<Message> req,
+                   const std::shared_ptr<Controller> &controller, int id);
+  // 用 decoder_ 把 frame 解码成 method 的 request
+  std::shared_ptr<Message> _decodeRequest(const MethodDescriptor *method,
+                                          std::shared_ptr<Message> req) const;
+  // 调用批处理 handler 执行一批请求，在 IO loop 或者 worker 线程中执行.
+  // 一批中的请求可以来自不同的连接
+  static void _runBatch(const MethodDescriptor *method,
+                        const BatchHandler &handler,
+                        std::vector<RequestBatcher::Call> &calls);
+  // 不在 IO loop 中执行的 handler 或者解码抛出异常，回复错误信息
+  void _replyException(const TcpConnectionPtr &conn, int id,
+                       Controller &controller, const MethodDescriptor *method,
+                       const std::exception &e);
   void handleMethodDone(std::weak_ptr<TcpConnection> wconn, int id,
+                        std::shared_ptr<Controller> controller,
                         std::shared_ptr<Message> response);
+  // 逐个分发批量请求中的 request
+  void _onBatchRequest(BatchRequest &batch, Timestamp receiveTime);
+  // 批量请求中的一个 request 完成，code 不为 0 的时候以 error 失败
+  void _completeBatchItem(Controller &controller, const Message *response,
+                          const std::string &error = std::string(),
+                          int code = 0);
+  // 在连接所属的 loop 中发送整批的 response
+  void _sendBatchReply(const TcpConnectionPtr &conn, BatchReply &reply);
+  void _sendResponse(const TcpConnectionPtr &conn, RpcMessage &message);
+  void _sendInPlace(const TcpConnectionPtr &conn, int id,
+                    const Controller &controller, const Message *response);
+  void _sendCached(int id, const std::string &response);
+  void _sendChunked(const TcpConnectionPtr &conn, int id,
+                    const Controller &controller, const Message &response);
+  void _sendError(const TcpConnectionPtr &conn, int id, const std::string &msg,
+                  int code);
   void _onError(const std::exception &err, int code);
+  // 根据客户端声明的压缩能力设置 response 的压缩方式
+  void _negotiateCompress(const Request &req);
+  void _fillCompressInfo(Response *resp) const;
+  // 处理 stream frame，OPEN 的时候创建 stream 并调用 stream handler
+  void _onStreamFrame(StreamFrame &frame);
+  // 处理客户端的 SUBSCRIBE / UNSUBSCRIBE
+  void _onPushFrame(const PushFrame &frame);
 
   TcpConnectionPtr conn_;
   Service *const service_;
@@ -49,6 +115,15 @@ private:
   Encoder encoder_;
 
   int currentId_{0};
+  bool currentOneway_{false}; // 正在处理的请求不需要回复
+  // 输入缓冲区中还有没有分发的 frame，连接在 loop 的 DispatchQueue 中
+  bool deferred_{false};
+  Timestamp deferredSince_;
+  bool compressNegotiated_{false};
+  std::shared_ptr<StreamSet> streams_; // 第一次使用 stream 的时候创建
+  std::unordered_set<std::string> topics_; // 连接订阅的 topic
+  ChunkAssembler assembler_;
+  std::shared_ptr<ChunkWriter> chunkWriter_; // 第一次分块发送的时候创建
 };
 
 template <typename T> std::shared_ptr<T> ServerChannel::getContext() const {
@@ -61,8 +136,9 @@ template <typename T> std::shared_ptr<T> ServerChannel::getContext() const {
  * @brief ClientChannel
  *
  */
-class ClientChannel {
+class ClientChannel : public std::enable_shared_from_this<ClientChannel> {
   friend class ClientStub;
+  friend class DeadlineQueue;
 
 public:
   ClientChannel(TcpConnectionPtr &&conn, ClientStub *service);
@@ -77,54 +153,144 @@ public:
   void onDestory();
 
   template <typename T> std::shared_ptr<T> getContext() const;
+  /// @brief 等待 response 的请求数，可以在任意线程调用
+  size_t outstanding() const { return pendingCalls_.size(); }
+  /// @brief 对端的 endpoint 和它的统计信息
+  const Endpoint &endpoint() const { return endpoint_; }
+  const std::shared_ptr<EndpointStats> &endpointStats() const {
+    return stats_;
+  }
 
   template <typename R>
   Future<Result<R>> invoke(const std::string &method,
-                           const std::shared_ptr<Message> &request);
+                           const std::shared_ptr<Message> &request,
+                           const CallOptions &options = CallOptions());
+  /// @brief 批量调用，把 requests 编码成一个 BatchRequest frame 发送，整批
+  /// 只占用一个 pending call. 返回的 future 在收到整批的 response 之后完成，
+  /// 值是服务端回复的 frame，由 callBatch 拆分
+  Future<std::shared_ptr<Message>>
+  invokeBatch(const std::string &method,
+              const std::vector<std::shared_ptr<Message>> &requests,
+              const CallOptions &options = CallOptions());
+  /// @brief 发送已经序列化的 request，同一个 request 发送给多个 server 的
+  /// 时候只需要序列化一次，见 fanout. 返回的 future 的值是服务端回复的 frame
+  Future<std::shared_ptr<Message>>
+  invokeSerialized(const std::string &method,
+                   const std::shared_ptr<const std::string> &request,
+                   const CallOptions &options = CallOptions());
+  /// @brief 发送 oneway 请求：不登记 pendingCalls_，服务端不回复.
+  /// 返回的 future 在请求交给连接发送之后完成，不表示服务端已经收到
+  Future<void> notify(const std::string &method,
+                      const std::shared_ptr<Message> &request,
+                      const CallOptions &options = CallOptions());
+  /// @brief 在这个连接上订阅 / 取消订阅服务端推送的 topic，推送的消息交给
+  /// ClientStub::setOnPush 设置的回调函数
+  Future<void> subscribe(const std::string &topic);
+  Future<void> unsubscribe(const std::string &topic);
+  /// @brief 打开一个流式调用
+  Future<std::shared_ptr<Stream>> openStream(const std::string &method);
 
 private:
-  /**
-   * @brief 描述每个 request
-   *
-   */
-  struct RequestContext {
-    Promise<std::shared_ptr<Message>> promise;
-    std::shared_ptr<Message> response;
-    Timestamp timestamp;
-  };
-
+  // 在连接所属的 loop 中执行 f(this). 跨线程提交的时候只持有 weak_ptr，
+  // 执行之前 channel 已经被销毁的时候以 ConnectionLost 失败
+  template <typename T, typename F>
+  Future<T> _execute(const TcpConnectionPtr &conn, F &&f);
+  // 还可以发送请求的连接. onDestory 之后 getChannel 交出去的 shared_ptr
+  // 仍然可能使 channel 存活，这时登记的请求没有人完成，返回 nullptr
+  TcpConnectionPtr _connection() const {
+    return destroyed_ ? TcpConnectionPtr() : conn_.lock();
+  }
   template <typename R>
   Future<Result<R>> _invoke(const std::string &method,
-                            const std::shared_ptr<Message> &request);
-  // 对 rpc request 进行编码
-  Buffer _messageToBytesEncoder(std::string &&method, const Message &request);
+                            const std::shared_ptr<Message> &request,
+                            const CallOptions &options);
+  // 对 rpc request 进行编码并发送，返回 false 表示连接已经断开
+  bool _sendRequest(const TcpConnectionPtr &conn, std::string &&method,
+                    const Message &request, int id,
+                    std::chrono::milliseconds timeout, Priority priority,
+                    bool oneway, const Attachment &attachment);
+  Future<std::shared_ptr<Message>>
+  _invokeBatch(const std::string &method,
+               const std::vector<std::shared_ptr<Message>> &requests,
+               const CallOptions &options);
+  Future<std::shared_ptr<Message>>
+  _invokeSerialized(const std::string &method,
+                    const std::shared_ptr<const std::string> &request,
+                    const CallOptions &options);
+  // invokeBatch / invokeSerialized 的请求头
+  void _fillHeader(Request *header, const std::string &method, int id,
+                   std::chrono::milliseconds timeout, Priority priority) const;
+  // 发送失败，释放 id 的请求上下文
+  Future<std::shared_ptr<Message>> _sendFailed(int id,
+                                               const std::string &method);
+  // 按照 frame 格式发送，超过 chunkSize 的 frame 分块发送
+  bool _sendFrame(const TcpConnectionPtr &conn, const RpcMessage &frame);
+  Future<void> _notify(const std::string &method,
+                       const std::shared_ptr<Message> &request,
+                       const CallOptions &options);
+  // 保存请求上下文，返回 call id. 请求表已满的时候返回 -1
+  int _addPendingCall(Promise<std::shared_ptr<Message>> &&promise,
+                      std::chrono::milliseconds timeout);
+  // 请求没有发送出去，释放 _addPendingCall 登记的上下文
+  void _dropPendingCall(int id);
+  // 请求超时，由 DeadlineQueue 调用
+  void _onDeadline(int id);
+  // 请求从 pendingCalls_ 中取出之后调用，更新 endpoint 的统计信息
+  void _onCallDone(const PendingCalls::Call &call, bool ok);
+  // 根据服务端声明的压缩能力设置 request 的压缩方式
+  void _negotiateCompress(const Response &resp);
+  Future<std::shared_ptr<Stream>> _openStream(const std::string &method);
+  Future<void> _subscribe(const std::string &topic, bool on);
+  void _onPushFrame(PushFrame &frame);
 
   // 与服务器连接的 weak_ptr，一个 ClientChannel 对应一个 TcpConnection
   std::weak_ptr<TcpConnection> conn_;
+  bool destroyed_{false}; // onDestory 之后不再接受请求，只在 loop 线程访问
   std::shared_ptr<void> ctx_;
   ClientStub *const service_;
-  std::map<int, RequestContext> pendingCalls_;
+  PendingCalls pendingCalls_;
+  // 自定义协议（例如 redis）的 response 不携带 id，按照请求的发送顺序匹配
+  std::deque<int> orderedCalls_;
+  DeadlineQueue *deadlines_{nullptr}; // 所属 loop 的 DeadlineQueue
+  bool compressNegotiated_{false};
+  std::shared_ptr<StreamSet> streams_; // 第一次 openStream 的时候创建
+  std::unordered_set<std::string> topics_; // 在这个连接上订阅的 topic
+  ChunkAssembler assembler_;
+  std::shared_ptr<ChunkWriter> chunkWriter_; // 第一次分块发送的时候创建
+  Endpoint endpoint_;
+  std::shared_ptr<EndpointStats> stats_; // 所有连接到同一 endpoint 的 channel 共享
 
   Decoder decoder_;
   Encoder encoder_;
-
-  void _checkPendingTimeout();
-  TimerId pendingTimeoutId_; // 记录 _checkPendingTimeout 对应的定时事件
-
-  int generateId();
-  static thread_local int reqId_;
 };
 
 template <typename T> std::shared_ptr<T> ClientChannel::getContext() const {
   return std::static_pointer_cast<T>(ctx_);
 }
 
+template <typename T, typename F>
+Future<T> ClientChannel::_execute(const TcpConnectionPtr &conn, F &&f) {
+  if (conn->getLoop()->isInLoopThread())
+    return f(this);
+  std::weak_ptr<ClientChannel> weak = weak_from_this();
+  const std::string name = service_->fullName();
+  return conn->getLoop()
+      ->Execute([weak, name, f]() -> Future<T> {
+        auto self = weak.lock();
+        if (!self)
+          return makeExceptionFuture<T>(
+              Exception(ErrorCode::ConnectionLost, "service " + name));
+        return f(self.get());
+      })
+      .unwrap();
+}
+
 /// @brief 1. 如果连接失效了，则返回一个异常的 future
 ///        2. 否则执行 _invoke（在当前线程或者 Loop 线程）
 template <typename R>
-Future<Result<R>>
-ClientChannel::invoke(const std::string &method,
-                      const std::shared_ptr<Message> &request) {
+Future<Result<R>> ClientChannel::invoke(const std::string &method,
+                                        const std::shared_ptr<Message> &request,
+                                        const CallOptions &options) {
   auto conn = conn_.lock();
   if (!conn) {
     // 如果 connection 已经到期了，则抛出异常
@@ -134,13 +300,10 @@ ClientChannel::invoke(const std::string &method,
         Exception(ErrorCode::ConnectionLost, error));
   }
   // 如果在 loop 线程则直接执行，否则的话将任务放到 connection 所属的线程执行
-  // 否则直接执行
-  if (conn->getLoop()->isInLoopThread())
-    return _invoke<R>(method, request);
-
-  auto invoker = std::bind(&ClientChannel::_invoke<R>, this, method, request);
-  // invoker return Future<>, Execute return Future<>
-  return conn->getLoop()->Execute(std::move(invoker)).unwrap();
+  return _execute<Result<R>>(
+      conn, [method, request, options](ClientChannel *channel) {
+        return channel->_invoke<R>(method, request, options);
+      });
 }
 
 /**
@@ -150,15 +313,18 @@ ClientChannel::invoke(const std::string &method,
  * @tparam R
  * @param method
  * @param request
+ * @param options 超时时间等选项
  * @return Future<R> 返回 future<R> 对应解码之后的结果
  */
 template <typename R>
-Future<Result<R>>
-ClientChannel::_invoke(const std::string &method,
-                       const std::shared_ptr<Message> &request) {
-  // 执行 _invoke 的时候，连接必须存在，并且是 loop thread
-  assert(!conn_.expired());
-  auto conn = conn_.lock();
+Future<Result<R>> ClientChannel::_invoke(const std::string &method,
+                                         const std::shared_ptr<Message> &request,
+                                         const CallOptions &options) {
+  // 提交到 loop 之后连接可能已经断开
+  auto conn = _connection();
+  if (!conn)
+    return makeExceptionFuture<Result<R>>(
+        Exception(ErrorCode::ConnectionLost, service_->fullName()));
   assert(conn->getLoop()->isInLoopThread());
   // 检查 service 中是否存在对应的方法
   if (!service_->getService()->GetDescriptor()->FindMethodByName(method)) {
@@ -167,48 +333,61 @@ ClientChannel::_invoke(const std::string &method,
     return makeExceptionFuture<Result<R>>(
         Exception(ErrorCode::NoSuchMethod, error));
   }
+  if (!options.attachment.empty() && !encoder_.framed())
+    return makeExceptionFuture<Result<R>>(Exception(
+        ErrorCode::EncodeFail, "attachment needs lrpc protocol: method [" +
+                                   method + "], service [" +
+                                   service_->fullName() + "]"));
   // promise-future 用来等待服务器返回 response
   Promise<std::shared_ptr<Message>> promise;
   auto fut = promise.getFuture();
+  // 先保存请求上下文，得到唯一标识 request 的 id
+  const auto timeout =
+      options.timeout.count() > 0 ? options.timeout : kDefaultCallTimeout;
+  const int id = _addPendingCall(std::move(promise), timeout);
+  if (id < 0) {
+    std::string error("too many pending calls: method [" + method +
+                      "], service [" + service_->fullName() + "]");
+    return makeExceptionFuture<Result<R>>(
+        Exception(ErrorCode::TooManyPendingCalls, error));
+  }
   // 对 request 进行编码并发送数据
   std::string methodStr = method;
-  Buffer bytes = _messageToBytesEncoder(std::move(methodStr), *request);
-  if (!conn->send(bytes)) {
-    // 发送失败，网络连接被重置
+  if (!_sendRequest(conn, std::move(methodStr), *request, id, timeout,
+                    options.priority, false, options.attachment)) {
+    // 发送失败，网络连接被重置，释放请求上下文
+    _dropPendingCall(id);
     std::string error("send failed: method [" + method + "], service [" +
                       service_->fullName() + "]");
     return makeExceptionFuture<Result<R>>(
         Exception(ErrorCode::ConnectionReset, error));
-  } else {
-    // 保存请求上下文
-    RequestContext reqContext;
-    reqContext.promise = std::move(promise);
-    reqContext.response.reset(new R());
-    reqContext.timestamp = Timestamp::now();
-    R *rsp = (R *)reqContext.response.get();
-    // 设置 future 回调函数当收到请求返回结果的时候，对 response 进行解码
-    auto decodeFut =
-        fut.then([this, rsp](std::shared_ptr<Message> &&msg) -> Result<R> {
-          // 对 respnse 解码
-          if (decoder_.messageDecoder_) {
-            try {
-              decoder_.messageDecoder_(*msg, *rsp);
-            } catch (const std::exception &exp) {
-              return Result<R>(std::current_exception());
-            } catch (...) {
-              LOG_ERROR << "Unknow exception when messageDecoder_";
-              return Result<R>(std::current_exception());
-            }
-          } else {
-            *rsp = std::move(*std::static_pointer_cast<R>(msg));
-          }
-          return std::move(*rsp);
-        });
-    // 将已经提交（发送）的请求保存，key 是 reqId_
-    pendingCalls_.insert({reqId_, std::move(reqContext)});
-    // 返回给客户端 Future<R>，客户端在该 Future 上等待结果
-    return decodeFut;
   }
+  // 设置 future 回调函数当收到请求返回结果的时候，对 response 进行解码
+  auto responseAttachment = options.responseAttachment;
+  return fut.then([this, responseAttachment](
+                      std::shared_ptr<Message> &&msg) -> Result<R> {
+    // 对 respnse 解码
+    R rsp;
+    if (decoder_.messageDecoder_) {
+      try {
+        decoder_.messageDecoder_(*msg, rsp);
+      } catch (const std::exception &exp) {
+        return Result<R>(std::current_exception());
+      } catch (...) {
+        LOG_ERROR << "Unknow exception when messageDecoder_";
+        return Result<R>(std::current_exception());
+      }
+    } else {
+      rsp = std::move(*std::static_pointer_cast<R>(msg));
+    }
+    if (responseAttachment) {
+      auto frame = dynamic_cast<RpcMessage *>(msg.get());
+      if (frame && frame->has_response())
+        *responseAttachment = Attachment(
+            std::move(*frame->mutable_response()->mutable_attachment()));
+    }
+    return std::move(rsp);
+  });
 }
 
 } // namespace lrpc
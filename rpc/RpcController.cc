@@ -0,0 +1,42 @@
+#include "RpcController.h"
+
+namespace lrpc {
+
+static thread_local Controller *t_currentController = nullptr;
+
+std::chrono::milliseconds Controller::remaining() const {
+  if (!hasDeadline())
+    return std::chrono::milliseconds(0);
+  const double left = timeDifference(deadline_, Timestamp::now());
+  return std::chrono::milliseconds(left > 0 ? static_cast<int64_t>(left * 1000)
+                                            : 0);
+}
+
+bool Controller::expired() const {
+  return hasDeadline() && !(Timestamp::now() < deadline_);
+}
+
+Controller *Controller::current() { return t_currentController; }
+
+void Controller::Reset() {
+  deadline_ = Timestamp();
+  priority_ = PRIORITY_DEFAULT;
+  failed_ = false;
+  errorText_.clear();
+  requestAttachment_ = Attachment();
+  responseAttachment_ = Attachment();
+}
+
+void Controller::SetFailed(const std::string &reason) {
+  failed_ = true;
+  errorText_ = reason;
+}
+
+Controller::CurrentScope::CurrentScope(Controller *controller)
+    : prev_(t_currentController) {
+  t_currentController = controller;
+}
+
+Controller::CurrentScope::~CurrentScope() { t_currentController = prev_; }
+
+} // namespace lrpc
@@ -0,0 +1,101 @@
+#ifndef LRPC_RPCCONTROLLER_H
+#define LRPC_RPCCONTROLLER_H
+
+#include "Attachment.h"
+#include "Timestamp.h"
+#include "lrpc.pb.h"
+#include <chrono>
+#include <google/protobuf/service.h>
+#include <memory>
+#include <string>
+
+namespace lrpc {
+
+struct BatchReply;
+class ConcurrencyLimiter;
+class ResponseCache;
+
+using lrpc::util::Timestamp;
+
+/**
+ * @brief 服务端传递给 CallMethod 的 RpcController
+ * 1. 记录 request 的截止时间，handler 可以通过 remaining() 获取剩余的时间预算
+ * 2. handler 同步执行期间 Controller::current() 指向当前请求的 controller，
+ *    handler 里面发起的嵌套 call() 没有指定超时时间的时候会继承剩余的预算
+ * 3. handler 调用 SetFailed 之后，response 会被替换成错误信息返回给客户端，
+ *    oneway 请求不回复
+ * 4. 请求和 response 的附件，见 Attachment
+ */
+class Controller : public google::protobuf::RpcController {
+public:
+  Controller() = default;
+  explicit Controller(Timestamp deadline) : deadline_(deadline) {}
+
+  /// @brief 是否设置了截止时间
+  bool hasDeadline() const { return deadline_.valid(); }
+  Timestamp deadline() const { return deadline_; }
+  /// @brief 剩余的时间预算，没有设置截止时间的时候返回 0
+  std::chrono::milliseconds remaining() const;
+  bool expired() const;
+
+  /// @brief 客户端设置的请求优先级
+  Priority priority() const { return priority_; }
+  /// @brief oneway 请求，handler 的 response 和错误都不会发送给客户端
+  bool oneway() const { return oneway_; }
+
+  /// @brief 请求携带的附件，没有附件的时候为空
+  const Attachment &requestAttachment() const { return requestAttachment_; }
+  /// @brief 设置 response 的附件，在 done->Run() 之前调用. 失败的请求不发送附件，
+  /// 设置了附件的 response 不进入服务端的 response 缓存
+  void setResponseAttachment(Attachment attachment) {
+    responseAttachment_ = std::move(attachment);
+  }
+  const Attachment &responseAttachment() const { return responseAttachment_; }
+
+  /// @brief 当前线程正在执行的 handler 对应的 controller，没有则返回 nullptr
+  static Controller *current();
+
+  // google::protobuf::RpcController
+  void Reset() override;
+  bool Failed() const override { return failed_; }
+  std::string ErrorText() const override { return errorText_; }
+  void StartCancel() override {}
+  void SetFailed(const std::string &reason) override;
+  bool IsCanceled() const override { return false; }
+  void NotifyOnCancel(google::protobuf::Closure *) override {}
+
+private:
+  friend class ServerChannel;
+
+  /// @brief 在作用域内设置 current()
+  class CurrentScope {
+  public:
+    explicit CurrentScope(Controller *controller);
+    ~CurrentScope();
+
+  private:
+    Controller *prev_;
+  };
+
+  Timestamp deadline_;
+  Priority priority_{PRIORITY_DEFAULT};
+  bool oneway_{false};
+  // 请求占用了 Service 并发限制的名额，handler 完成的时候归还
+  ConcurrencyLimiter *limiter_{nullptr};
+  Timestamp startTime_;
+  // 可缓存的 method，handler 成功之后以 cacheKey_ 缓存 response
+  ResponseCache *cache_{nullptr};
+  std::string cacheKey_;
+  bool failed_{false};
+  std::string errorText_;
+  Attachment requestAttachment_;
+  Attachment responseAttachment_;
+  // 批量请求中的一个 request：response 记录到 batch_ 的第 batchIndex_ 个
+  // 位置，不单独发送
+  std::shared_ptr<BatchReply> batch_;
+  int batchIndex_{0};
+};
+
+} // namespace lrpc
+
+#endif
@@ -16,12 +16,16 @@ inline std::string getStringAddrFromEndpoint(const Endpoint &ep) {
   return ep.ip() + ":" + std::to_string(ep.port());
 }
 
+/// @brief addr 格式为 ip:port，可以带上权重 ip:port@weight
 inline Endpoint createEndpoint(const std::string &addr) {
   std::string::size_type p = addr.find_first_of(':');
   assert(p != std::string::npos);
   Endpoint ep;
   ep.set_ip(addr.substr(0, p).data());
   ep.set_port(std::stoi(addr.substr(p + 1)));
+  std::string::size_type w = addr.find_first_of('@', p);
+  if (w != std::string::npos)
+    ep.set_weight(std::stoi(addr.substr(w + 1)));
   return ep;
 }
 
@@ -53,6 +53,15 @@ std::string lrpcErrorCategory::message(int ec) const {
   case ErrorCode::ConnectRefused:
     return "lrpc.error:ConnectRefused";
 
+  case ErrorCode::TooManyPendingCalls:
+    return "lrpc.error:TooManyPendingCalls";
+
+  case ErrorCode::StreamCancelled:
+    return "lrpc.error:StreamCancelled";
+
+  case ErrorCode::Overloaded:
+    return "lrpc.error:Overloaded";
+
   default:
     break;
   }
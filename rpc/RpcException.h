@@ -32,6 +32,12 @@ enum class ErrorCode {
   // client-side
   NoAvailableEndpoint, ///< All server dead
   ConnectRefused,      ///< Server is not listen, try again.
+  TooManyPendingCalls, ///< Too many requests waiting for response on a channel.
+
+  // both
+  StreamCancelled, ///< Stream was cancelled by the peer or the connection.
+  Overloaded, ///< Server rejected the request by its concurrency limit, the
+              ///< request was not executed and can be retried elsewhere.
 };
 
 class lrpcErrorCategory : public std::error_category {
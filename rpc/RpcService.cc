@@ -7,6 +7,7 @@
 #include "Server.h"
 #include "SocketsOps.h"
 #include "TcpConnection.h"
+#include <algorithm>
 
 namespace lrpc {
 
@@ -29,6 +30,147 @@ void Service::setOnCreateChannel(std::function<void(ServerChannel *)> cb) {
   onCreateChannel_ = std::move(cb);
 }
 
+void Service::setCompression(CompressType type, size_t threshold,
+                             const std::string &dictionary) {
+  compress_ = makeCompressOptions(type, threshold, dictionary);
+}
+
+void Service::setChunkSize(size_t chunkSize) {
+  chunkSize_ = std::min(chunkSize, kMaxChunkSize);
+}
+
+void Service::setDispatchBudget(const DispatchBudget &budget) {
+  dispatchBudget_ = budget;
+  // 每次至少分发一个 frame
+  dispatchBudget_.frames = std::max<size_t>(dispatchBudget_.frames, 1);
+  dispatchBudget_.bytes = std::max<size_t>(dispatchBudget_.bytes, 1);
+}
+
+void Service::addStreamMethod(const std::string &method,
+                              StreamHandler handler) {
+  if (!service_->GetDescriptor()->FindMethodByName(method)) {
+    LOG_ERROR << "addStreamMethod: no method [" << method << "] in "
+              << fullName();
+    return;
+  }
+  streamHandlers_[method] = std::move(handler);
+}
+
+void Service::setConcurrencyLimit(const ConcurrencyLimitOptions &options) {
+  limiter_ = makeConcurrencyLimiter(options);
+}
+
+void Service::setMaxInflight(int maxInflight) {
+  ConcurrencyLimitOptions options;
+  options.type = ConcurrencyLimitType::Static;
+  options.maxInflight = maxInflight;
+  setConcurrencyLimit(options);
+}
+
+void Service::setCacheable(const std::string &method,
+                           std::chrono::milliseconds ttl, size_t maxBytes) {
+  if (!service_->GetDescriptor()->FindMethodByName(method)) {
+    LOG_ERROR << "setCacheable: no method [" << method << "] in "
+              << fullName();
+    return;
+  }
+  caches_[method].reset(new ResponseCache(ttl, maxBytes));
+}
+
+void Service::setBatchHandler(const std::string &method, BatchHandler handler,
+                              const BatchOptions &options) {
+  auto descriptor = service_->GetDescriptor()->FindMethodByName(method);
+  if (!descriptor) {
+    LOG_ERROR << "setBatchHandler: no method [" << method << "] in "
+              << fullName();
+    return;
+  }
+  auto &batch = batchMethods_[descriptor];
+  batch.handler = std::move(handler);
+  batch.options = options;
+}
+
+RequestBatcher *Service::_batcher(const MethodDescriptor *method,
+                                  EventLoop *loop) {
+  if (batchMethods_.empty())
+    return nullptr;
+  auto it = batchMethods_.find(method);
+  if (it == batchMethods_.end())
+    return nullptr;
+  assert(loop->getId() < static_cast<int>(it->second.batchers.size()));
+  auto &batcher = it->second.batchers[loop->getId()];
+  if (!batcher) {
+    const BatchHandler *handler = &it->second.handler;
+    ThreadPool *pool = _executor(method);
+    batcher.reset(new RequestBatcher(
+        loop, it->second.options,
+        [method, handler, pool](std::vector<RequestBatcher::Call> &&calls) {
+          if (!pool) {
+            ServerChannel::_runBatch(method, *handler, calls);
+            return;
+          }
+          // 一批请求按照其中最高的优先级排队
+          int rank = priorityRank(calls.front().controller->priority());
+          for (const auto &call : calls)
+            rank = std::min(rank, priorityRank(call.controller->priority()));
+          pool->Schedule(
+              [method, handler, calls = std::move(calls)]() mutable {
+                ServerChannel::_runBatch(method, *handler, calls);
+              },
+              rank);
+        }));
+  }
+  return batcher.get();
+}
+
+ResponseCache *Service::responseCache(const std::string &method) const {
+  if (caches_.empty())
+    return nullptr;
+  auto it = caches_.find(method);
+  return it == caches_.end() ? nullptr : it->second.get();
+}
+
+void Service::setExecutionPolicy(const std::string &method,
+                                 const ExecutionPolicy &policy) {
+  if (!service_->GetDescriptor()->FindMethodByName(method)) {
+    LOG_ERROR << "setExecutionPolicy: no method [" << method << "] in "
+              << fullName();
+    return;
+  }
+  policies_[method] = policy;
+}
+
+void Service::setDefaultExecutionPolicy(const ExecutionPolicy &policy) {
+  defaultPolicy_ = policy;
+}
+
+bool Service::_resolveExecutors() {
+  executors_.clear();
+  const auto descriptor = service_->GetDescriptor();
+  for (int i = 0; i < descriptor->method_count(); ++i) {
+    const auto method = descriptor->method(i);
+    auto it = policies_.find(method->name());
+    const auto &policy = it == policies_.end() ? defaultPolicy_ : it->second;
+    if (policy.mode == ExecutionPolicy::Inline)
+      continue;
+    auto pool = RPC_SERVER.workerPool(policy.pool);
+    if (!pool) {
+      LOG_ERROR << "no worker pool [" << policy.pool << "] for method "
+                << method->full_name();
+      return false;
+    }
+    executors_[method] = pool;
+  }
+  return true;
+}
+
+ThreadPool *Service::_executor(const MethodDescriptor *method) const {
+  if (executors_.empty())
+    return nullptr;
+  auto it = executors_.find(method);
+  return it == executors_.end() ? nullptr : it->second;
+}
+
 /// @brief 获取 service 内部的 GoogleService
 GoogleService *Service::getService() const { return service_.get(); }
 
@@ -39,8 +181,10 @@ const std::string &Service::fullName() const { return name_; }
 const Endpoint &Service::getEndpoint() const { return endpoint_; }
 
 bool Service::start() {
-  if (endpoint_.ip().empty())
+  if (endpoint_.ip().empty() || !_resolveExecutors())
     return false;
+  for (auto &batch : batchMethods_)
+    batch.second.batchers.resize(RPC_SERVER.getThreadNum());
   InetAddress listenAddr(endpoint_.ip(), endpoint_.port());
   auto loop = RPC_SERVER.baseLoop();
   auto newConnectionCallback =
@@ -90,70 +234,210 @@ void Service::onNewConnection(int sockfd, const InetAddress &peerAddr,
   ioLoop->runInLoop(std::bind(&TcpConnection::connecEstablished, conn));
 }
 
+size_t Service::publish(const std::string &topic, const Message &msg) {
+  std::vector<TcpConnectionPtr> conns;
+  {
+    std::lock_guard<std::mutex> lk(subscribersMutex_);
+    auto it = subscribers_.find(topic);
+    if (it == subscribers_.end())
+      return 0;
+    conns.reserve(it->second.size());
+    for (const auto &sub : it->second)
+      if (auto conn = sub.second.lock())
+        conns.push_back(std::move(conn));
+  }
+  if (conns.empty())
+    return 0;
+  RpcMessage frame;
+  PushFrame *push = frame.mutable_push();
+  push->set_type(PushFrame::PUBLISH);
+  push->set_service_name(fullName());
+  push->set_topic(topic);
+  if (!msg.SerializeToString(push->mutable_payload()))
+    throw Exception(ErrorCode::EncodeFail, "publish " + topic);
+  Buffer buf = bytesEncode(frame);
+  auto bytes = std::make_shared<const std::string>(buf.retrieveAsString());
+  for (auto &conn : conns) {
+    if (conn->getLoop()->isInLoopThread())
+      conn->send(*bytes);
+    else
+      conn->getLoop()->runInLoop([conn, bytes] { conn->send(*bytes); });
+  }
+  return conns.size();
+}
+
+size_t Service::subscribers(const std::string &topic) const {
+  std::lock_guard<std::mutex> lk(subscribersMutex_);
+  auto it = subscribers_.find(topic);
+  return it == subscribers_.end() ? 0 : it->second.size();
+}
+
+void Service::_subscribe(const std::string &topic,
+                         const TcpConnectionPtr &conn) {
+  std::lock_guard<std::mutex> lk(subscribersMutex_);
+  subscribers_[topic][conn.get()] = conn;
+}
+
+void Service::_unsubscribe(const std::string &topic,
+                           const TcpConnection *conn) {
+  std::lock_guard<std::mutex> lk(subscribersMutex_);
+  auto it = subscribers_.find(topic);
+  if (it == subscribers_.end())
+    return;
+  it->second.erase(conn);
+  if (it->second.empty())
+    subscribers_.erase(it);
+}
+
 /// @brief 初始化 channel_
 void Service::onRegister() { channels_.resize(RPC_SERVER.getThreadNum()); }
 
-/// @brief 收到 request 消息的时候执行，解析 request，
-/// 调用 ServerChannel::onMessge 执行 request method（执行完毕会发送数据）
+/// @brief request 的处理顺序，不是 request 的 frame 按照 PRIORITY_DEFAULT 处理
+static int framePriorityRank(const Message &msg) {
+  auto frame = dynamic_cast<const RpcMessage *>(&msg);
+  if (frame && frame->has_batch_request())
+    return priorityRank(frame->batch_request().header().priority());
+  if (!frame || !frame->has_request())
+    return 0;
+  return priorityRank(frame->request().priority());
+}
+
+/// @brief 收到 request 消息的时候执行. 每次只分发一份 DispatchBudget，
+/// 剩下的 frame 由 loop 的 DispatchQueue 在其他连接之后继续分发
 void Service::_onMessage(const TcpConnectionPtr &conn, Buffer *buffer,
-                         Timestamp) {
+                         Timestamp receiveTime) {
   auto channel = conn->getContext<ServerChannel>();
-  const char *data = buffer->peek(), *const start = data;
+  // 连接已经在 ready 队列中，等轮到它的时候再分发，保持连接之间的公平
+  if (channel->deferred_)
+    return;
+  if (_dispatchSome(conn, channel.get(), buffer, receiveTime,
+                    &channel->service_->dispatchBudget_))
+    _defer(conn, channel.get(), receiveTime);
+}
+
+void Service::_defer(const TcpConnectionPtr &conn, ServerChannel *channel,
+                     Timestamp receiveTime) {
+  channel->deferred_ = true;
+  // 积压的 frame 按照第一次积压时读到数据的时间计算截止时间
+  channel->deferredSince_ = receiveTime;
+  RPC_SERVER.dispatchQueue(conn->getLoop())
+      ->push(conn, [](const TcpConnectionPtr &conn) {
+        auto channel = conn->getContext<ServerChannel>();
+        if (!channel->deferred_)
+          return false;
+        const bool more =
+            _dispatchSome(conn, channel.get(), conn->inputBuffer(),
+                          channel->deferredSince_,
+                          &channel->service_->dispatchBudget_);
+        channel->deferred_ = more;
+        return more;
+      });
+}
+
+/// @brief 先解析 buffer 中完整的 request（不超过 budget），再按照优先级调用
+/// ServerChannel::onMessge 执行 request method（执行完毕会发送数据）.
+/// 相同优先级的 request 保持接收的顺序
+bool Service::_dispatchSome(const TcpConnectionPtr &conn,
+                            ServerChannel *channel, Buffer *buffer,
+                            Timestamp receiveTime,
+                            const DispatchBudget *budget) {
+  std::vector<std::pair<int, std::shared_ptr<Message>>> msgs;
+  bool reordered = false;
+  bool fatal = false;
+  bool more = false;
+  const size_t available = buffer->readableBytes();
+  const char *data = buffer->peek();
   while (buffer->readableBytes() >= static_cast<size_t>(kPbHeaderLen)) {
+    if (budget && (msgs.size() >= budget->frames ||
+                   available - buffer->readableBytes() >= budget->bytes)) {
+      more = true;
+      break;
+    }
     try {
       auto msg = channel->onData(data, buffer->readableBytes());
-      if (msg) {
-        // message 解析成功，移动 read 指针
-        buffer->retrieve(data - start);
-        try {
-          channel->onMessage(std::move(msg));
-        } catch (const std::system_error &e) {
-          // 异常处理
-          auto code = e.code();
-          assert(code.category() == lrpcCategory());
-          channel->_onError(e, code.value());
-          switch (code.value()) {
-          case static_cast<int>(ErrorCode::NoSuchService):
-          case static_cast<int>(ErrorCode::NoSuchMethod):
-          case static_cast<int>(ErrorCode::EmptyRequest):
-          case static_cast<int>(ErrorCode::ThrowInMethod):
-            LOG_WARN << "RecovableException " << code.message();
-            break;
-          case static_cast<int>(ErrorCode::DecodeFail):
-          case static_cast<int>(ErrorCode::MethodUndetermined):
-            LOG_ERROR << "FatalException " << code.message();
-            conn->shutdown();
-            break;
-          default:
-            LOG_ERROR << "Unknown Exception " << code.message();
-            conn->shutdown();
-            break;
-          }
-          break;
-        } catch (...) {
-          LOG_ERROR << "onMessage: Unknown error";
-          conn->shutdown();
-          break;
-        }
-      } else {
-        // 不足一条消息，结束消息处理
+      if (!msg) // 不足一条消息，结束消息解析
         break;
-      }
+      // message 解析成功，移动 read 指针
+      buffer->retrieveUntil(data);
+      const int rank = framePriorityRank(*msg);
+      reordered = reordered || (!msgs.empty() && rank < msgs.back().first);
+      msgs.emplace_back(rank, std::move(msg));
     } catch (const std::system_error &e) {
       LOG_ERROR << "some exception onData " << e.what();
-      conn->shutdown();
+      fatal = true;
       break;
     } catch (const std::exception &e) {
       LOG_ERROR << "unknown exception onData " << e.what();
-      conn->shutdown();
+      fatal = true;
+      break;
+    }
+  }
+  if (reordered)
+    std::stable_sort(msgs.begin(), msgs.end(),
+                     [](const std::pair<int, std::shared_ptr<Message>> &a,
+                        const std::pair<int, std::shared_ptr<Message>> &b) {
+                       return a.first < b.first;
+                     });
+  for (auto &msg : msgs) {
+    if (!_dispatch(conn, channel, std::move(msg.second), receiveTime))
+      return false;
+  }
+  if (fatal) {
+    conn->shutdown();
+    return false;
+  }
+  return more;
+}
+
+/// @brief 执行一个 request，返回 false 表示出现了致命错误，连接已经关闭
+bool Service::_dispatch(const TcpConnectionPtr &conn, ServerChannel *channel,
+                        std::shared_ptr<Message> &&msg, Timestamp receiveTime) {
+  try {
+    channel->onMessage(std::move(msg), receiveTime);
+  } catch (const std::system_error &e) {
+    // 异常处理
+    auto code = e.code();
+    assert(code.category() == lrpcCategory());
+    channel->_onError(e, code.value());
+    switch (code.value()) {
+    case static_cast<int>(ErrorCode::NoSuchService):
+    case static_cast<int>(ErrorCode::NoSuchMethod):
+    case static_cast<int>(ErrorCode::EmptyRequest):
+    case static_cast<int>(ErrorCode::ThrowInMethod):
+      LOG_WARN << "RecovableException " << code.message();
+      break;
+    case static_cast<int>(ErrorCode::Overloaded):
+      // 过载的时候每个被拒绝的请求都会走到这里，不打 WARN 日志
+      LOG_DEBUG << "reject request " << code.message();
       break;
+    case static_cast<int>(ErrorCode::DecodeFail):
+    case static_cast<int>(ErrorCode::MethodUndetermined):
+      LOG_ERROR << "FatalException " << code.message();
+      conn->shutdown();
+      return false;
+    default:
+      LOG_ERROR << "Unknown Exception " << code.message();
+      conn->shutdown();
+      return false;
     }
+  } catch (...) {
+    LOG_ERROR << "onMessage: Unknown error";
+    conn->shutdown();
+    return false;
   }
-  // return
+  return true;
 }
 
 /// @brief 连接断开回调函数
 void Service::_onDisconnect(const TcpConnectionPtr &conn) {
+  auto channel = conn->getContext<ServerChannel>();
+  if (channel->deferred_) {
+    // 对端发送之后立即关闭连接，积压的 frame（例如 oneway 请求）仍然分发
+    channel->deferred_ = false;
+    _dispatchSome(conn, channel.get(), conn->inputBuffer(),
+                  channel->deferredSince_, nullptr);
+  }
+  channel->onDestory();
   auto &channelMap = channels_[conn->getLoop()->getId()];
   bool succ = channelMap.erase(conn->getUniqueId());
   assert(succ);
@@ -13,11 +13,19 @@
 #define LRPC_SERVICE_H
 
 #include "Callback.h"
+#include "Chunk.h"
+#include "Compression.h"
+#include "ConcurrencyLimiter.h"
+#include "DispatchQueue.h"
 #include "RpcEndpoint.h"
+#include "RequestBatcher.h"
+#include "ResponseCache.h"
+#include "ThreadPool.h"
 #include "lrpc.pb.h"
 #include <functional>
 #include <google/protobuf/message.h>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -42,10 +50,35 @@ class Acceptor;
 
 class Request;
 class ServerChannel;
+class Stream;
 
 using GoogleService = google::protobuf::Service;
 using google::protobuf::Message;
+using google::protobuf::MethodDescriptor;
+using lrpc::util::ThreadPool;
 using namespace net;
+/// @brief 服务端流式方法的处理函数，在连接所属的 loop 中调用
+using StreamHandler = std::function<void(const std::shared_ptr<Stream> &)>;
+
+/// @brief method 的 handler 在哪里执行
+struct ExecutionPolicy {
+  enum Mode {
+    Inline, ///< 在连接所属的 IO loop 中执行（默认），适合不会阻塞的 handler
+    Worker, ///< 在 worker 线程池中执行，response 发回连接所属的 loop 发送
+  };
+  Mode mode{Inline};
+  /// @brief Worker 模式使用的线程池名字（RpcServer::addWorkerPool），
+  /// 空表示 RpcServer 的默认 worker 线程池（RpcServer::setWorkerThreadNum）
+  std::string pool;
+
+  static ExecutionPolicy inlineLoop() { return ExecutionPolicy(); }
+  static ExecutionPolicy worker(const std::string &pool = std::string()) {
+    ExecutionPolicy policy;
+    policy.mode = Worker;
+    policy.pool = pool;
+    return policy;
+  }
+};
 
 class Service {
   friend class ServerChannel;
@@ -72,21 +105,116 @@ public:
   /// @brief Callback when a Rpc ServerChannel created, if you use user-defined
   /// protocol, the callback should call SetEncoder/SetDecoder for this channel.
   void setOnCreateChannel(std::function<void(ServerChannel *)>);
+  /// @brief 对超过 threshold 的 response 进行压缩，客户端不支持的时候不压缩.
+  /// dictionary 非空的时候作为预训练字典，客户端需要设置相同的字典
+  void setCompression(CompressType type, size_t threshold = 1024,
+                      const std::string &dictionary = std::string());
+  const CompressOptions &compressOptions() const { return compress_; }
+  /// @brief 序列化之后超过 chunkSize 的 response 分块发送，和连接上的其他
+  /// response 交错，见 Chunk.h. 0 表示不分块（默认），不超过 kMaxChunkSize.
+  /// 携带附件的 response 不分块
+  void setChunkSize(size_t chunkSize);
+  size_t chunkSize() const { return chunkSize_; }
+  /// @brief 接收分块 request 的限制，见 ChunkLimits. 只能在 RpcServer 启动之前调用
+  void setChunkLimits(const ChunkLimits &limits) { chunkLimits_ = limits; }
+  const ChunkLimits &chunkLimits() const { return chunkLimits_; }
+  /// @brief 把 method 注册为流式方法，method 的 request / response 类型
+  /// 分别是客户端 / 服务端发送的消息类型. 只能在 RpcServer 启动之前调用
+  void addStreamMethod(const std::string &method, StreamHandler handler);
+  /// @brief 限制正在执行的请求数，超过限制的请求在解码 request 之前以
+  /// Overloaded 错误拒绝. 只能在 RpcServer 启动之前调用
+  void setConcurrencyLimit(const ConcurrencyLimitOptions &options);
+  /// @brief 固定的并发限制，等价于 Static 类型的 setConcurrencyLimit
+  void setMaxInflight(int maxInflight);
+  /// @brief 设置 method 的执行策略，流式方法总是在 IO loop 中执行.
+  /// 只能在 RpcServer 启动之前调用，使用的线程池在 start() 的时候查找
+  void setExecutionPolicy(const std::string &method,
+                          const ExecutionPolicy &policy);
+  /// @brief 没有单独设置执行策略的 method 使用的策略
+  void setDefaultExecutionPolicy(const ExecutionPolicy &policy);
+  /// @brief 把幂等的 method 标记为可缓存：相同的 request（序列化之后的字节
+  /// 相同）在 ttl 之内直接返回缓存的 response，不调用 handler. 失败的
+  /// response 不缓存. 只能在 RpcServer 启动之前调用
+  void setCacheable(const std::string &method, std::chrono::milliseconds ttl,
+                    size_t maxBytes = 16 * 1024 * 1024);
+  /// @brief method 的 response 缓存，不可缓存的 method 返回 nullptr
+  ResponseCache *responseCache(const std::string &method) const;
+  /// @brief 没有设置并发限制的时候返回 nullptr
+  ConcurrencyLimiter *concurrencyLimiter() const { return limiter_.get(); }
+  /// @brief 为 method 注册批处理 handler，代替 GoogleService 的 CallMethod：
+  /// 同一个 loop 上并发到达的请求攒成一批之后调用一次 handler，见
+  /// RequestBatcher.h. 只能在 RpcServer 启动之前调用
+  void setBatchHandler(const std::string &method, BatchHandler handler,
+                       const BatchOptions &options = BatchOptions());
+  /// @brief 每个连接每次最多解码分发的 frame 数和字节数，剩下的 frame 在
+  /// loop 处理完其他连接之后再分发，见 DispatchQueue. 只能在 RpcServer
+  /// 启动之前调用
+  void setDispatchBudget(const DispatchBudget &budget);
+  /// @brief 把 msg 推送给所有订阅了 topic 的客户端连接，可以在任意线程调用.
+  /// msg 只编码一次，在各个连接所属的 loop 中发送. 返回推送的连接数
+  size_t publish(const std::string &topic, const Message &msg);
+  /// @brief 订阅了 topic 的连接数
+  size_t subscribers(const std::string &topic) const;
 
 private:
   using ChannelMap = std::unordered_map<unsigned int, ServerChannel *>;
 
   static void _onMessage(const TcpConnectionPtr &, Buffer *, Timestamp);
+  // 解码并分发 buffer 中的 frame，budget 不为空的时候最多分发一份预算.
+  // 返回 true 表示因为预算停止，buffer 中可能还有完整的 frame
+  static bool _dispatchSome(const TcpConnectionPtr &conn,
+                            ServerChannel *channel, Buffer *buffer,
+                            Timestamp receiveTime,
+                            const DispatchBudget *budget);
+  // 连接进入所属 loop 的 DispatchQueue
+  static void _defer(const TcpConnectionPtr &conn, ServerChannel *channel,
+                     Timestamp receiveTime);
+  static bool _dispatch(const TcpConnectionPtr &conn, ServerChannel *channel,
+                        std::shared_ptr<Message> &&msg, Timestamp receiveTime);
+  // 根据执行策略找到每个 method 的线程池
+  bool _resolveExecutors();
+  /// @brief method 使用的 worker 线程池，在 IO loop 中执行的返回 nullptr
+  ThreadPool *_executor(const MethodDescriptor *method) const;
+  /// @brief method 在 loop 上的 RequestBatcher，不是批处理 method 的时候
+  /// 返回 nullptr. 只能在 loop 线程中调用
+  RequestBatcher *_batcher(const MethodDescriptor *method, EventLoop *loop);
   void _onDisconnect(const TcpConnectionPtr &conn);
+  // 由 ServerChannel 在连接所属的 loop 中调用
+  void _subscribe(const std::string &topic, const TcpConnectionPtr &conn);
+  void _unsubscribe(const std::string &topic, const TcpConnection *conn);
 
   std::function<void(ServerChannel *)> onCreateChannel_;
   std::function<std::string(const Message *)> methodSelector_;
+  CompressOptions compress_;
+  size_t chunkSize_{0};
+  ChunkLimits chunkLimits_;
+  DispatchBudget dispatchBudget_;
+  std::unordered_map<std::string, StreamHandler> streamHandlers_;
+  std::unique_ptr<ConcurrencyLimiter> limiter_; // 所有 loop 共享
+  // method name -> response 缓存，启动之后只读
+  std::unordered_map<std::string, std::unique_ptr<ResponseCache>> caches_;
+  std::unordered_map<std::string, ExecutionPolicy> policies_;
+  ExecutionPolicy defaultPolicy_;
+  // start() 之后只读，多个 loop 可以同时查找
+  std::unordered_map<const MethodDescriptor *, ThreadPool *> executors_;
+  struct BatchMethod {
+    BatchHandler handler;
+    BatchOptions options;
+    // 下标是 loop id，在 loop 线程中第一次使用时创建
+    std::vector<std::unique_ptr<RequestBatcher>> batchers;
+  };
+  std::unordered_map<const MethodDescriptor *, BatchMethod> batchMethods_;
   std::unique_ptr<GoogleService> service_;
   Endpoint endpoint_;
   std::string name_;
   // 每个 service 有很多个 TcpConnection，每个 EventLoop 有它自己的 ChannelMap
   // 保存每个 loop 中每个连接的 TcpConnection -> ServerChannel 的映射
   std::vector<ChannelMap> channels_;
+  // topic -> 订阅的连接，publish 可以在任意线程调用，由 subscribersMutex_ 保护
+  using Subscribers =
+      std::unordered_map<const TcpConnection *, std::weak_ptr<TcpConnection>>;
+  std::unordered_map<std::string, Subscribers> subscribers_;
+  mutable std::mutex subscribersMutex_;
 };
 
 } // namespace lrpc
@@ -14,7 +14,7 @@ RpcServer *RpcServer::s_rpcClient = nullptr;
 
 RpcServer::RpcServer()
     : threadPool_(new EventLoopThreadPool(&loop_)), threadNum_(1),
-      nextConnId_(1) {
+      deadlines_(1), dispatchQueues_(1), nextConnId_(1) {
   assert(!s_rpcClient);
   s_rpcClient = this;
 }
@@ -27,10 +27,50 @@ void RpcServer::setThreadNum(size_t n) {
   assert(n >= 0);
   threadNum_ = n + 1;
   threadPool_->setThreadNum(n);
+  deadlines_.resize(threadNum_);
+  dispatchQueues_.resize(threadNum_);
 }
 
 size_t RpcServer::getThreadNum() const { return threadNum_; }
 
+void RpcServer::setWorkerThreadNum(size_t n) {
+  workerPools_[std::string()].reset(new ThreadPool("worker", n));
+}
+
+bool RpcServer::addWorkerPool(const std::string &name, size_t n) {
+  if (name.empty())
+    return false;
+  std::unique_ptr<ThreadPool> pool(new ThreadPool(name, n));
+  return workerPools_.insert({name, std::move(pool)}).second;
+}
+
+ThreadPool *RpcServer::workerPool(const std::string &name) const {
+  auto it = workerPools_.find(name);
+  return it == workerPools_.end() ? nullptr : it->second.get();
+}
+
+DeadlineQueue *RpcServer::deadlineQueue(EventLoop *loop) {
+  loop->assertInLoopThread();
+  assert(loop->getId() < static_cast<int>(deadlines_.size()));
+  auto &queue = deadlines_[loop->getId()];
+  if (!queue)
+    queue.reset(new DeadlineQueue(loop));
+  return queue.get();
+}
+
+void RpcServer::setLoopTimeBudget(std::chrono::microseconds budget) {
+  loopTimeBudget_ = budget;
+}
+
+DispatchQueue *RpcServer::dispatchQueue(EventLoop *loop) {
+  loop->assertInLoopThread();
+  assert(loop->getId() < static_cast<int>(dispatchQueues_.size()));
+  auto &queue = dispatchQueues_[loop->getId()];
+  if (!queue)
+    queue.reset(new DispatchQueue(loop, loopTimeBudget_));
+  return queue.get();
+}
+
 EventLoop *RpcServer::baseLoop() { return &loop_; }
 
 EventLoop *RpcServer::next() { return threadPool_->getNextLoop(); }
@@ -120,15 +160,29 @@ void RpcServer::connect(const InetAddress &addr, ConnectionCallback success,
                         std::chrono::milliseconds timeout, EventLoop *ioLoop) {
   // 获取 base loop，connect 操作在 base loop 中执行
   auto loop = baseLoop();
-  // TODO 暂时不考虑连接超时的问题
   auto newConnectionCallback =
       std::bind(&RpcServer::newConnection, this, std::placeholders::_1,
                 std::move(success), ioLoop, std::placeholders::_2);
-  loop->Execute([loop, addr, newConnectionCallback] {
+  loop->Execute([loop, addr, newConnectionCallback, fail, timeout, ioLoop] {
     // 创建连接器，设置回调函数，然后开始连接
     std::shared_ptr<Connector> connector(new Connector(loop, addr));
     connector->setNewConnectionCallback(
         std::bind(newConnectionCallback, std::placeholders::_1, connector));
+    if (fail) {
+      // 连接被拒绝或者超时之后不再重试，在 ioLoop 中通知调用方，
+      // 由调用方决定是否重新连接
+      std::weak_ptr<Connector> weak(connector);
+      auto onFail = [weak, fail, ioLoop, addr] {
+        auto c = weak.lock();
+        if (!c || c->connected() || c->stopped())
+          return;
+        c->stop();
+        ioLoop->runInLoop(std::bind(fail, ioLoop, addr));
+      };
+      connector->setConnectErrorCallback(onFail);
+      if (timeout.count() > 0)
+        loop->runAfter(timeout.count() / 1000.0, onFail);
+    }
     connector->start();
   });
 }
@@ -173,6 +227,8 @@ void RpcServer::startClient() {
     LOG_DEBUG << "use nameservice " << nameServiceStub_->fullName();
   if (onInit_) // 初始化函数
     onInit_();
+  for (auto &pool : workerPools_)
+    pool.second->start();
   threadPool_->start(); // 启动线程池
   baseLoop()->loop();   // 启动 baseLoop
   if (onExit_)          // 结尾函数
@@ -206,11 +262,15 @@ void RpcServer::startServer() {
         }
       }
       LOG_DEBUG << "call Keepalive";
-      // 发送心跳信息
+      // 发送心跳信息，心跳属于控制流量，服务端优先处理
+      CallOptions options;
+      options.priority = PRIORITY_CONTROL;
       for (const auto &e : keepaliveInfo_)
-        call<Status>("lrpc.NameService", "Keepalive", e);
+        call<Status>("lrpc.NameService", "Keepalive", e, options);
     });
   }
+  for (auto &pool : workerPools_)
+    pool.second->start();
   threadPool_->start(); // 启动线程池
   baseLoop()->loop();   // 启动 baseLoop
 }
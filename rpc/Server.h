@@ -1,13 +1,25 @@
 #ifndef LRPC_RPCCLIENT_H
 #define LRPC_RPCCLIENT_H
 
+#include "CallOptions.h"
 #include "ClientStub.h"
+#include "DeadlineQueue.h"
+#include "DispatchQueue.h"
+#include "Logging.h"
 #include "RpcChannel.h"
+#include "RpcController.h"
 #include "RpcException.h"
+#include "Stream.h"
+#include "ThreadPool.h"
 #include "future.h"
 #include "lrpc.pb.h"
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
@@ -25,6 +37,7 @@ class Endpoint;
 class Service;
 
 using google::protobuf::Message;
+using lrpc::util::ThreadPool;
 using namespace net;
 
 /// 1. 提供 connect 的实现
@@ -59,6 +72,21 @@ public:
 
   void setThreadNum(size_t n);
   size_t getThreadNum() const;
+  /// @brief 设置默认 worker 线程池的线程数，Service 可以把阻塞的 method
+  /// 放到 worker 线程池中执行，见 Service::setExecutionPolicy
+  void setWorkerThreadNum(size_t n);
+  /// @brief 添加一个命名的 worker 线程池，只能在启动之前调用
+  bool addWorkerPool(const std::string &name, size_t n);
+  /// @brief 获取 worker 线程池，name 为空表示默认线程池，不存在则返回 nullptr
+  ThreadPool *workerPool(const std::string &name = std::string()) const;
+
+  /// @brief 获取 loop 的 DeadlineQueue，只能在 loop 线程中调用
+  DeadlineQueue *deadlineQueue(EventLoop *loop);
+  /// @brief loop 的一轮迭代中分发积压 frame 的时间预算，见 DispatchQueue.
+  /// 只能在启动之前调用
+  void setLoopTimeBudget(std::chrono::microseconds budget);
+  /// @brief 获取 loop 的 DispatchQueue，只能在 loop 线程中调用
+  DispatchQueue *dispatchQueue(EventLoop *loop);
 
   // 启动 rpc client，在这之前需要执行 addClientStub
   void startClient();
@@ -88,21 +116,79 @@ private:
   std::unique_ptr<EventLoopThreadPool> threadPool_;
   EventLoop loop_; // base loop 只负责 connect，其他工作由别的 eventloop 执行
   size_t threadNum_{0};
+  // 每个 loop 一个 DeadlineQueue，下标是 loop id，在 loop 线程中第一次使用时创建
+  std::vector<std::unique_ptr<DeadlineQueue>> deadlines_;
+  // 同 deadlines_
+  std::vector<std::unique_ptr<DispatchQueue>> dispatchQueues_;
+  std::chrono::microseconds loopTimeBudget_{2000};
 
   int nextConnId_; // 只会在 base loop 中 write，不会存在线程安全问题
   std::unordered_map<std::string, TcpConnectionPtr> connections_;
+  // 最后声明，析构的时候先等待 worker 线程中的 handler 执行完
+  std::unordered_map<std::string, std::unique_ptr<ThreadPool>> workerPools_;
 
   static RpcServer *s_rpcClient;
 };
 
 #define RPC_SERVER ::lrpc::RpcServer::instance()
 
+/// @brief fanout 中一个 endpoint 的结果
+template <typename R> struct FanoutReply {
+  Endpoint endpoint;
+  Result<R> result;
+};
+
+/// @brief fanout 收集结果的方式
+struct FanoutOptions {
+  /// @brief 收到 quorum 个成功的结果之后立即完成，之后返回的结果被丢弃.
+  /// 失败不计入 quorum：剩下的 endpoint 全部成功也达不到 quorum，或者
+  /// 超过 CallOptions.timeout 的时候以已经收到的部分结果完成.
+  /// 0 表示等待所有的 endpoint：超过 CallOptions.timeout 还没有结果的
+  /// endpoint（包括连接一直没有建立的）以 Timeout 出现在结果中
+  size_t quorum{0};
+};
+
 namespace {
 
 template <typename R>
 Future<Result<R>> _innerCall(ClientStub *stub, const std::string &method,
                              const std::shared_ptr<Message> &req,
-                             const Endpoint &ep = Endpoint::default_instance());
+                             const Endpoint &ep, const CallOptions &options);
+inline Future<void> _notify(ClientStub *stub, const std::string &method,
+                            const std::shared_ptr<Message> &req,
+                            const Endpoint &ep, const CallOptions &options);
+template <typename R>
+Future<Result<R>> _startCall(ClientStub *stub, const std::string &method,
+                             const std::shared_ptr<Message> &req,
+                             const Endpoint &ep, const CallOptions &options);
+template <typename R>
+Future<Result<R>> _coalescedCall(ClientStub *stub, const std::string &method,
+                                 const std::shared_ptr<Message> &req,
+                                 const CallOptions &options);
+template <typename R>
+Future<Result<R>> _cachedCall(ClientStub *stub, const std::string &method,
+                              const std::shared_ptr<Message> &req,
+                              const CachePolicy &policy,
+                              const CallOptions &options);
+template <typename R>
+Future<Result<R>> _hedgedCall(ClientStub *stub, const std::string &method,
+                              const std::shared_ptr<Message> &req,
+                              const CallOptions &options);
+template <typename R>
+Future<Result<R>> _retryCall(ClientStub *stub, const std::string &method,
+                             const std::shared_ptr<Message> &req,
+                             const Endpoint &ep, const CallOptions &options);
+template <typename R>
+std::vector<Future<Result<R>>>
+_batchCall(ClientStub *stub, const std::string &method,
+           const std::vector<std::shared_ptr<Message>> &reqs,
+           const Endpoint &ep, const CallOptions &options);
+template <typename R>
+Future<std::vector<FanoutReply<R>>>
+_fanout(ClientStub *stub, const std::string &method,
+        const std::shared_ptr<const std::string> &request,
+        const std::vector<Endpoint> &endpoints, const CallOptions &options,
+        const FanoutOptions &fanoutOptions);
 
 }
 
@@ -114,25 +200,28 @@ Future<Result<R>> _innerCall(ClientStub *stub, const std::string &method,
  * @param method 请求的函数
  * @param req rpc request
  * @param ep server address
+ * @param options 超时时间等选项
  * @return Future<Result<R>> TODO 为啥需要使用 Result 包装，将 Result 去掉试试看
  */
 template <typename R>
 Future<Result<R>> call(const std::string &service, const std::string &method,
                        const std::shared_ptr<Message> &req,
-                       const Endpoint &ep = Endpoint::default_instance()) {
+                       const Endpoint &ep = Endpoint::default_instance(),
+                       const CallOptions &options = CallOptions()) {
   // 找到 clientStub
   auto stub = RPC_SERVER.getClientStub(service);
   if (!stub)
     return makeExceptionFuture<Result<R>>(
         Exception(ErrorCode::NoSuchService, service));
-  return _innerCall<R>(stub, method, req, ep);
+  return _innerCall<R>(stub, method, req, ep, options);
 }
 /// @brief rpc call 接口重载，区别在于这里的 req 是原始 request 的引用
 /// 因此需要制作一份拷贝
 template <typename R>
 Future<Result<R>> call(const std::string &service, const std::string &method,
                        const Message &req,
-                       const Endpoint &ep = Endpoint::default_instance()) {
+                       const Endpoint &ep = Endpoint::default_instance(),
+                       const CallOptions &options = CallOptions()) {
   auto stub = RPC_SERVER.getClientStub(service);
   if (!stub)
     return makeExceptionFuture<Result<R>>(
@@ -140,11 +229,215 @@ Future<Result<R>> call(const std::string &service, const std::string &method,
   // 拷贝一份 request
   std::shared_ptr<Message> reqCopy(req.New());
   reqCopy->CopyFrom(req);
-  return _innerCall<R>(stub, method, reqCopy, ep);
+  return _innerCall<R>(stub, method, reqCopy, ep, options);
+}
+/// @brief 不指定 endpoint，只指定 CallOptions 的重载
+template <typename R>
+Future<Result<R>> call(const std::string &service, const std::string &method,
+                       const std::shared_ptr<Message> &req,
+                       const CallOptions &options) {
+  return call<R>(service, method, req, Endpoint::default_instance(), options);
+}
+template <typename R>
+Future<Result<R>> call(const std::string &service, const std::string &method,
+                       const Message &req, const CallOptions &options) {
+  return call<R>(service, method, req, Endpoint::default_instance(), options);
+}
+
+/**
+ * @brief 批量调用：同一个 method 的多个 request 编码成一个 frame 发送给同一个
+ * server，服务端逐个分发执行，全部完成之后以一个 frame 回复. 整批只占用一个
+ * pending call，分摊 frame 头、请求表和系统调用的开销，适合发给同一个 server
+ * 的大量小请求. 不使用重试、hedge、合并和缓存，需要默认的 lrpc 协议
+ *
+ * @param ep server address，默认由负载均衡为整批选择一个
+ * @return 和 reqs 一一对应的 future，单个 request 的失败只影响它自己的 future
+ */
+template <typename R>
+std::vector<Future<Result<R>>>
+callBatch(const std::string &service, const std::string &method,
+          const std::vector<std::shared_ptr<Message>> &reqs,
+          const Endpoint &ep = Endpoint::default_instance(),
+          const CallOptions &options = CallOptions()) {
+  auto stub = RPC_SERVER.getClientStub(service);
+  if (!stub) {
+    std::vector<Future<Result<R>>> futures;
+    futures.reserve(reqs.size());
+    for (size_t i = 0; i < reqs.size(); ++i)
+      futures.push_back(makeExceptionFuture<Result<R>>(
+          Exception(ErrorCode::NoSuchService, service)));
+    return futures;
+  }
+  return _batchCall<R>(stub, method, reqs, ep, options);
+}
+template <typename R>
+std::vector<Future<Result<R>>>
+callBatch(const std::string &service, const std::string &method,
+          const std::vector<std::shared_ptr<Message>> &reqs,
+          const CallOptions &options) {
+  return callBatch<R>(service, method, reqs, Endpoint::default_instance(),
+                      options);
+}
+
+/**
+ * @brief scatter-gather：把同一个 request 发送给多个 endpoint 并收集结果.
+ * request 只序列化一次，所有连接共享序列化之后的字节. 每个 endpoint 的
+ * 调用使用相同的 CallOptions，不使用重试、hedge、合并和缓存，需要默认的
+ * lrpc 协议
+ *
+ * @param endpoints 发送的 endpoint，空表示 service 当前所有的 endpoint
+ * @return 按照完成的顺序排列的结果（quorum 为 0 的时候按照 endpoints 的顺序），
+ * 失败和超时的 endpoint 以异常的 Result 出现在结果中
+ */
+template <typename R>
+Future<std::vector<FanoutReply<R>>>
+fanout(const std::string &service, const std::string &method,
+       const std::shared_ptr<Message> &req,
+       const std::vector<Endpoint> &endpoints = std::vector<Endpoint>(),
+       const CallOptions &options = CallOptions(),
+       const FanoutOptions &fanoutOptions = FanoutOptions()) {
+  auto stub = RPC_SERVER.getClientStub(service);
+  if (!stub)
+    return makeExceptionFuture<std::vector<FanoutReply<R>>>(
+        Exception(ErrorCode::NoSuchService, service));
+  auto bytes = std::make_shared<std::string>();
+  if (!req->SerializeToString(bytes.get()))
+    return makeExceptionFuture<std::vector<FanoutReply<R>>>(
+        Exception(ErrorCode::EncodeFail, "fanout " + service + "." + method));
+  std::shared_ptr<const std::string> request(std::move(bytes));
+  if (!endpoints.empty())
+    return _fanout<R>(stub, method, request, endpoints, options,
+                      fanoutOptions);
+  return stub->endpoints().then(
+      [stub, method, request, options,
+       fanoutOptions](Result<std::shared_ptr<std::vector<Endpoint>>> &&eps) {
+        try {
+          const auto &all = eps.getValue();
+          return _fanout<R>(stub, method, request,
+                            all ? *all : std::vector<Endpoint>(), options,
+                            fanoutOptions);
+        } catch (...) {
+          return makeExceptionFuture<std::vector<FanoutReply<R>>>(
+              std::current_exception());
+        }
+      });
+}
+
+/**
+ * @brief oneway 调用：不等待 response，服务端也不回复，适合上报指标、日志等
+ * 不需要结果的请求
+ *
+ * @return Future<void> 请求交给连接发送之后完成，不表示服务端已经收到
+ */
+inline Future<void>
+notify(const std::string &service, const std::string &method,
+       const std::shared_ptr<Message> &req,
+       const Endpoint &ep = Endpoint::default_instance(),
+       const CallOptions &options = CallOptions()) {
+  auto stub = RPC_SERVER.getClientStub(service);
+  if (!stub)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::NoSuchService, service));
+  return _notify(stub, method, req, ep, options);
+}
+inline Future<void>
+notify(const std::string &service, const std::string &method,
+       const Message &req, const Endpoint &ep = Endpoint::default_instance(),
+       const CallOptions &options = CallOptions()) {
+  std::shared_ptr<Message> reqCopy(req.New());
+  reqCopy->CopyFrom(req);
+  return notify(service, method, reqCopy, ep, options);
+}
+
+/**
+ * @brief 订阅服务端推送的 topic，推送的消息交给 ClientStub::setOnPush 设置的
+ * 回调函数. 订阅只在一个连接上生效，连接断开的时候回调函数收到 ConnectionLost
+ *
+ * @param ep 指定订阅的 server，默认由负载均衡选择
+ */
+inline Future<void>
+subscribe(const std::string &service, const std::string &topic,
+          const Endpoint &ep = Endpoint::default_instance()) {
+  auto stub = RPC_SERVER.getClientStub(service);
+  if (!stub)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::NoSuchService, service));
+  return stub->subscribe(topic, ep);
+}
+inline Future<void> unsubscribe(const std::string &service,
+                                const std::string &topic) {
+  auto stub = RPC_SERVER.getClientStub(service);
+  if (!stub)
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::NoSuchService, service));
+  return stub->unsubscribe(topic);
+}
+
+/**
+ * @brief 打开一个流式调用，客户端发送 method 的 request 类型，接收 response 类型
+ *
+ * @param service rpc 服务的名称
+ * @param method 服务端通过 Service::addStreamMethod 注册的方法
+ * @param ep server address
+ * @return Future<std::shared_ptr<Stream>> 在连接所属的 loop 中完成
+ */
+inline Future<std::shared_ptr<Stream>>
+openStream(const std::string &service, const std::string &method,
+           const Endpoint &ep = Endpoint::default_instance()) {
+  auto stub = RPC_SERVER.getClientStub(service);
+  if (!stub)
+    return makeExceptionFuture<std::shared_ptr<Stream>>(
+        Exception(ErrorCode::NoSuchService, service));
+  return stub->getChannel(ep).then([method](Result<ClientChannelPtr> &&chan) {
+    try {
+      return chan.getValue()->openStream(method);
+    } catch (...) {
+      return makeExceptionFuture<std::shared_ptr<Stream>>(
+          std::current_exception());
+    }
+  });
 }
 
 namespace {
 
+/// @brief 在 handler 中发起的嵌套调用，没有指定超时时间的时候继承上游请求
+/// 剩余的预算，没有指定优先级的时候继承上游请求的优先级.
+/// 上游请求已经过期的时候返回 false
+inline bool _inheritUpstream(CallOptions *options) {
+  auto upstream = Controller::current();
+  if (!upstream)
+    return true;
+  if (options->timeout.count() <= 0 && upstream->hasDeadline()) {
+    options->timeout = upstream->remaining();
+    if (options->timeout.count() <= 0)
+      return false;
+  }
+  if (options->priority == PRIORITY_DEFAULT)
+    options->priority = upstream->priority();
+  return true;
+}
+
+/// @brief 发送 oneway 请求，不使用重试、hedge、合并和缓存
+inline Future<void> _notify(ClientStub *stub, const std::string &method,
+                            const std::shared_ptr<Message> &req,
+                            const Endpoint &ep, const CallOptions &callOptions) {
+  CallOptions options = callOptions;
+  if (!_inheritUpstream(&options))
+    return makeExceptionFuture<void>(
+        Exception(ErrorCode::Timeout, "upstream deadline exceeded: " +
+                                          stub->fullName() + "." + method));
+  if (!isValidEndpoint(ep) && options.routingKey.empty())
+    options.routingKey = stub->routingKey(method, *req);
+  return stub->getChannel(ep, options.routingKey).then(
+      [method, req, options](Result<ClientChannelPtr> &&chan) {
+        try {
+          return chan.getValue()->notify(method, req, options);
+        } catch (...) {
+          return makeExceptionFuture<void>(std::current_exception());
+        }
+      });
+}
+
 /**
  * @brief 建立 rpc connection，发送 request，设置 response 回调函数
  * 返回 Future<Result<R>>，R 是 method 的返回值
@@ -154,26 +447,594 @@ namespace {
  * @param method
  * @param req
  * @param ep
+ * @param options
  * @return Future<Result<R>>
  */
 template <typename R>
 Future<Result<R>> _innerCall(ClientStub *stub, const std::string &method,
                              const std::shared_ptr<Message> &req,
-                             const Endpoint &ep) {
+                             const Endpoint &ep, const CallOptions &callOptions) {
+  CallOptions options = callOptions;
+  if (!_inheritUpstream(&options))
+    return makeExceptionFuture<Result<R>>(
+        Exception(ErrorCode::Timeout, "upstream deadline exceeded: " +
+                                          stub->fullName() + "." + method));
+  if (!isValidEndpoint(ep) && options.routingKey.empty())
+    options.routingKey = stub->routingKey(method, *req);
+  if (stub->isOneway(method))
+    return _notify(stub, method, req, ep, options)
+        .then([](Result<void> &&r) -> Result<R> {
+          if (r.hasException())
+            return Result<R>(std::move(r).getException());
+          return R();
+        });
+  // 附件不是合并和缓存的 key 的一部分
+  const bool attached =
+      !options.attachment.empty() || options.responseAttachment;
+  if (!isValidEndpoint(ep) && !attached) {
+    if (const CachePolicy *policy = stub->cachePolicy(method))
+      return _cachedCall<R>(stub, method, req, *policy, options);
+    if (stub->coalescing())
+      return _coalescedCall<R>(stub, method, req, options);
+  }
+  return _startCall<R>(stub, method, req, ep, options);
+}
+
+/// @brief 按照 options 选择重试、hedge 或者直接发送
+template <typename R>
+Future<Result<R>> _startCall(ClientStub *stub, const std::string &method,
+                             const std::shared_ptr<Message> &req,
+                             const Endpoint &ep, const CallOptions &options) {
+  if (options.retry.maxAttempts > 1)
+    return _retryCall<R>(stub, method, req, ep, options);
+  if (options.hedge.enabled && !isValidEndpoint(ep) &&
+      !options.responseAttachment)
+    return _hedgedCall<R>(stub, method, req, options);
   // 等待连接 ep
-  auto channelFuture = stub->getChannel(ep);
+  auto channelFuture = stub->getChannel(ep, options.routingKey);
   // ep 连接成功之后获取连接创建的 Channel，执行 invoke 发送 request 请求
   // 返回一个 Future<R>
-  return channelFuture.then([method, req](Result<ClientChannel *> &&chan) {
+  return channelFuture.then([method, req,
+                             options](Result<ClientChannelPtr> &&chan) {
     try {
-      ClientChannel *channel = chan.getValue();
-      return channel->invoke<R>(method, req);
+      ClientChannelPtr channel = chan.getValue();
+      return channel->invoke<R>(method, req, options);
     } catch (...) {
       return makeExceptionFuture<Result<R>>(std::current_exception());
     }
   });
 }
 
+/**
+ * @brief 合并相同的请求. 第一个请求登记一个 SharedFuture 并发送，
+ * 之后相同的请求只等待它的结果. 请求完成的时候先注销再设置结果，
+ * 之后的请求会重新发送
+ */
+template <typename R>
+Future<Result<R>> _coalescedCall(ClientStub *stub, const std::string &method,
+                                 const std::shared_ptr<Message> &req,
+                                 const CallOptions &options) {
+  // 调用者可能用不同的 R 解码同一个 method 的 response，R 也是 key 的一部分
+  std::string key = method;
+  key.push_back('\0');
+  key.append(typeid(R).name());
+  key.push_back('\0');
+  if (!req->AppendToString(&key))
+    return _startCall<R>(stub, method, req, Endpoint::default_instance(),
+                         options);
+  Promise<Result<R>> promise;
+  auto shared = std::make_shared<SharedFuture<Result<R>>>(promise.getFuture());
+  auto inflight = stub->joinCoalesced(key, shared);
+  if (inflight)
+    return std::static_pointer_cast<SharedFuture<Result<R>>>(inflight)
+        ->getFuture();
+  auto fut = shared->getFuture();
+  _startCall<R>(stub, method, req, Endpoint::default_instance(), options)
+      .then([stub, key, promise](Result<R> &&r) mutable {
+        stub->leaveCoalesced(key);
+        promise.setValue(std::move(r));
+      });
+  return fut;
+}
+
+/// @brief 缓存的 response 占用内存的估计值
+template <typename R> size_t _cachedBytes(const R &rsp) {
+  if constexpr (std::is_base_of<Message, R>::value)
+    return rsp.SpaceUsedLong();
+  else
+    return sizeof(R);
+}
+
+/// @brief 缓存未命中或者刷新的时候发送请求，在 loop 中保存成功的结果
+template <typename R>
+Future<Result<R>> _fillCache(ClientStub *stub, const std::string &method,
+                             const std::shared_ptr<Message> &req,
+                             const CachePolicy &policy,
+                             const CallOptions &options, EventLoop *loop,
+                             const std::string &key) {
+  auto fut = stub->coalescing()
+                 ? _coalescedCall<R>(stub, method, req, options)
+                 : _startCall<R>(stub, method, req,
+                                 Endpoint::default_instance(), options);
+  return fut.then(loop, [stub, policy, loop, key](Result<R> &&r) {
+    ClientCache &cache = stub->cache(loop);
+    if (r.hasValue()) {
+      auto value = std::make_shared<const R>(r.getValue());
+      const size_t bytes = _cachedBytes(*value);
+      cache.put(key, std::move(value), bytes, policy, Timestamp::now());
+    } else {
+      cache.refreshFailed(key);
+    }
+    return std::move(r);
+  });
+}
+
+/**
+ * @brief 在调用者的 loop 中查找缓存. 新鲜的结果直接返回；陈旧的结果直接返回，
+ * 同时在后台发送一个刷新请求；未命中的时候发送请求，其结果保存到缓存中
+ */
+template <typename R>
+Future<Result<R>> _cachedCall(ClientStub *stub, const std::string &method,
+                              const std::shared_ptr<Message> &req,
+                              const CachePolicy &policy,
+                              const CallOptions &options) {
+  std::string key = method;
+  key.push_back('\0');
+  key.append(typeid(R).name());
+  key.push_back('\0');
+  if (!req->AppendToString(&key))
+    return _startCall<R>(stub, method, req, Endpoint::default_instance(),
+                         options);
+  EventLoop *loop = ClientStub::callerLoop();
+  auto lookup = [stub, method, req, policy, options, loop,
+                 key]() -> Future<Result<R>> {
+    std::shared_ptr<const void> value;
+    bool refresh = false;
+    auto state = stub->cache(loop).get(key, Timestamp::now(), &value, &refresh);
+    if (state == ClientCache::State::Miss)
+      return _fillCache<R>(stub, method, req, policy, options, loop, key);
+    if (refresh)
+      _fillCache<R>(stub, method, req, policy, options, loop, key);
+    return makeReadyFuture(Result<R>(*static_cast<const R *>(value.get())));
+  };
+  if (loop->isInLoopThread())
+    return lookup();
+  return loop->Execute(std::move(lookup)).unwrap();
+}
+
+/// @brief hedged call 的两个请求共享的状态
+template <typename R> struct HedgeContext {
+  Promise<Result<R>> promise;
+  std::atomic<int> inflight{1};
+  std::atomic<bool> done{false};
+
+  /// @brief 先成功的请求设置 promise. 失败的请求只有在没有其他请求等待的
+  /// 时候才作为结果，避免 hedge 请求的连接失败掩盖第一个请求的 response
+  void onResult(Result<R> &&r) {
+    const int left = --inflight;
+    if (r.hasException() && left > 0)
+      return;
+    if (!done.exchange(true))
+      promise.setValue(std::move(r));
+  }
+};
+
+/**
+ * @brief 发送第一个请求，在 options.hedge 的等待时间之后还没有结果的时候，
+ * 在预算允许的情况下向另一个 endpoint 发送相同的请求
+ *
+ * @tparam R
+ * @param stub
+ * @param method
+ * @param req 两个请求共享，只读
+ * @param options
+ * @return Future<Result<R>>
+ */
+template <typename R>
+Future<Result<R>> _hedgedCall(ClientStub *stub, const std::string &method,
+                              const std::shared_ptr<Message> &req,
+                              const CallOptions &options) {
+  auto ctx = std::make_shared<HedgeContext<R>>();
+  auto fut = ctx->promise.getFuture();
+  stub->hedgeBudget().onRequest();
+  auto channelFuture =
+      stub->getChannel(Endpoint::default_instance(), options.routingKey);
+  channelFuture.then([stub, method, req, options,
+                      ctx](Result<ClientChannelPtr> &&chan) {
+    if (chan.hasException()) {
+      ctx->onResult(Result<R>(chan.getException()));
+      return;
+    }
+    ClientChannelPtr channel = chan.getValue();
+    channel->invoke<R>(method, req, options).then([ctx](Result<R> &&r) {
+      ctx->onResult(std::move(r));
+    });
+    if (ctx->done)
+      return;
+    // 等待时间: 指定的 delay，或者 endpoint 最近延迟的分位数
+    auto delay = options.hedge.delay;
+    if (delay.count() <= 0) {
+      const auto &stats = channel->endpointStats();
+      if (stats)
+        delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+            stats->latencyPercentile(options.hedge.percentile));
+      delay = std::max(delay, options.hedge.minDelay);
+    }
+    // hedge 请求使用剩余的超时时间
+    CallOptions hedgeOptions = options;
+    if (options.timeout.count() > 0) {
+      if (delay >= options.timeout)
+        return;
+      hedgeOptions.timeout = options.timeout - delay;
+    }
+    const Endpoint primary = channel->endpoint();
+    auto loop = EventLoop::getEventLoopOfCurrentThread();
+    if (!loop)
+      loop = RPC_SERVER.next();
+    loop->runAfter(delay.count() / 1000.0, [stub, method, req, hedgeOptions,
+                                            ctx, primary]() {
+      if (ctx->done)
+        return;
+      stub->getChannelExcept(primary, hedgeOptions.routingKey).then(
+          [method, req, hedgeOptions, ctx, stub](Result<ClientChannelPtr> &&chan) {
+            // 没有其他 endpoint 或者预算不足的时候放弃 hedge
+            if (ctx->done || chan.hasException() ||
+                !stub->hedgeBudget().tryAcquire())
+              return;
+            ++ctx->inflight;
+            chan.getValue()
+                ->invoke<R>(method, req, hedgeOptions)
+                .then([ctx](Result<R> &&r) { ctx->onResult(std::move(r)); });
+          });
+    });
+  });
+  return fut;
+}
+
+/// @brief 重试的状态，同一时间只有一次尝试，不需要加锁
+template <typename R> struct RetryContext {
+  ClientStub *stub;
+  std::string method;
+  std::shared_ptr<Message> req;
+  Endpoint ep;         // 调用方指定的 endpoint
+  CallOptions options; // 每次尝试使用的选项，retry.maxAttempts 为 1
+  RetryPolicy policy;
+  Timestamp deadline; // 所有尝试共享的截止时间，invalid 表示没有设置
+  int attempts{0};
+  std::chrono::milliseconds backoff{0};
+  Endpoint lastEndpoint; // 上一次尝试使用的 endpoint
+  Promise<Result<R>> promise;
+};
+
+template <typename R>
+void _retryAttempt(const std::shared_ptr<RetryContext<R>> &ctx);
+
+/// @brief 一次尝试结束之后决定是否重试
+template <typename R>
+void _retryOnResult(const std::shared_ptr<RetryContext<R>> &ctx,
+                    Result<R> &&r) {
+  if (!r.hasException() || ctx->attempts >= ctx->policy.maxAttempts ||
+      !ctx->policy.retryable(r.getException())) {
+    ctx->promise.setValue(std::move(r));
+    return;
+  }
+  // 指数退避，在 [backoff / 2, backoff] 中随机选择等待时间
+  ctx->backoff =
+      ctx->attempts == 1
+          ? ctx->policy.initialBackoff
+          : std::min(ctx->policy.maxBackoff,
+                     std::chrono::milliseconds(static_cast<int64_t>(
+                         ctx->backoff.count() * ctx->policy.multiplier)));
+  thread_local std::minstd_rand rng(std::random_device{}());
+  const int64_t half = ctx->backoff.count() / 2;
+  const std::chrono::milliseconds wait(half + rng() % (half + 1));
+  if (ctx->deadline.valid()) {
+    const auto remaining = std::chrono::milliseconds(static_cast<int64_t>(
+        timeDifference(ctx->deadline, Timestamp::now()) * 1000));
+    if (remaining <= wait) {
+      ctx->promise.setValue(std::move(r));
+      return;
+    }
+    ctx->options.timeout = remaining - wait;
+  }
+  if (!ctx->stub->retryBudget().tryAcquire()) {
+    LOG_WARN << "retry budget exhausted: " << ctx->stub->fullName() << "."
+             << ctx->method;
+    ctx->promise.setValue(std::move(r));
+    return;
+  }
+  auto loop = EventLoop::getEventLoopOfCurrentThread();
+  if (!loop)
+    loop = RPC_SERVER.next();
+  loop->runAfter(wait.count() / 1000.0, [ctx]() { _retryAttempt<R>(ctx); });
+}
+
+/// @brief 调用方没有指定 endpoint 的时候，每次尝试都由负载均衡器选择
+/// endpoint，并且优先选择上一次尝试之外的 endpoint
+template <typename R>
+void _retryAttempt(const std::shared_ptr<RetryContext<R>> &ctx) {
+  ++ctx->attempts;
+  Future<Endpoint> endpoint = isValidEndpoint(ctx->ep)
+                                  ? makeReadyFuture(Endpoint(ctx->ep))
+                                  : ctx->stub->selectEndpoint(
+                                        ctx->lastEndpoint,
+                                        ctx->options.routingKey);
+  endpoint
+      .then([ctx](Result<Endpoint> &&ep) {
+        if (ep.hasException())
+          return makeExceptionFuture<ClientChannelPtr>(
+              std::exception_ptr(ep.getException()));
+        ctx->lastEndpoint = ep.getValue();
+        return ctx->stub->getChannel(ctx->lastEndpoint);
+      })
+      .then([ctx](Result<ClientChannelPtr> &&chan) {
+        if (chan.hasException())
+          return makeExceptionFuture<Result<R>>(
+              std::exception_ptr(chan.getException()));
+        return chan.getValue()->invoke<R>(ctx->method, ctx->req, ctx->options);
+      })
+      .then([ctx](Result<R> &&r) { _retryOnResult<R>(ctx, std::move(r)); });
+}
+
+/**
+ * @brief 失败之后按照 options.retry 重试. 第一次尝试在设置了 hedge 的时候
+ * 仍然是 hedged call，之后的尝试不再 hedge
+ *
+ * @tparam R
+ * @param stub
+ * @param method
+ * @param req 所有尝试共享，只读
+ * @param ep
+ * @param options
+ * @return Future<Result<R>>
+ */
+template <typename R>
+Future<Result<R>> _retryCall(ClientStub *stub, const std::string &method,
+                             const std::shared_ptr<Message> &req,
+                             const Endpoint &ep, const CallOptions &options) {
+  auto ctx = std::make_shared<RetryContext<R>>();
+  ctx->stub = stub;
+  ctx->method = method;
+  ctx->req = req;
+  ctx->ep = ep;
+  ctx->options = options;
+  ctx->options.retry.maxAttempts = 1;
+  ctx->policy = options.retry;
+  if (options.timeout.count() > 0)
+    ctx->deadline = addTime(Timestamp::now(), options.timeout.count() / 1000.0);
+  auto fut = ctx->promise.getFuture();
+  stub->retryBudget().onRequest();
+  if (options.hedge.enabled && !isValidEndpoint(ep)) {
+    ++ctx->attempts;
+    const CallOptions first = ctx->options;
+    ctx->options.hedge.enabled = false;
+    _hedgedCall<R>(stub, method, req, first).then([ctx](Result<R> &&r) {
+      _retryOnResult<R>(ctx, std::move(r));
+    });
+  } else {
+    _retryAttempt<R>(ctx);
+  }
+  return fut;
+}
+
+
+/// @brief response 的错误转换成异常
+inline std::exception_ptr _responseError(const Response &resp) {
+  return std::make_exception_ptr(
+      Exception(static_cast<ErrorCode>(resp.error().errnum()),
+                resp.error().msg()));
+}
+
+/// @brief 把整批的 response 拆分给每个 request 的 promise
+template <typename R>
+void _completeBatch(std::vector<Promise<Result<R>>> &promises,
+                    Result<std::shared_ptr<Message>> &&result) {
+  if (result.hasException()) {
+    auto e = std::move(result).getException();
+    for (auto &promise : promises)
+      promise.setException(e);
+    return;
+  }
+  auto frame = std::dynamic_pointer_cast<RpcMessage>(result.getValue());
+  if (!frame || !frame->has_batch_response() ||
+      frame->batch_response().responses_size() !=
+          static_cast<int>(promises.size())) {
+    // 整批都没有执行，服务端以普通的 Response 回复错误
+    auto e = frame && frame->has_response() && frame->response().has_error()
+                 ? _responseError(frame->response())
+                 : std::make_exception_ptr(
+                       Exception(ErrorCode::DecodeFail, "bad batch response"));
+    for (auto &promise : promises)
+      promise.setException(e);
+    return;
+  }
+  for (size_t i = 0; i < promises.size(); ++i) {
+    const Response &resp =
+        frame->batch_response().responses(static_cast<int>(i));
+    if (resp.has_error()) {
+      promises[i].setException(_responseError(resp));
+      continue;
+    }
+    R rsp;
+    if (!rsp.ParseFromString(resp.serialized_response())) {
+      promises[i].setException(std::make_exception_ptr(
+          Exception(ErrorCode::DecodeFail, "batch response " +
+                                               std::to_string(i))));
+      continue;
+    }
+    promises[i].setValue(Result<R>(std::move(rsp)));
+  }
+}
+
+/// @brief 为整批选择一个 endpoint 发送，每个 request 一个 promise
+template <typename R>
+std::vector<Future<Result<R>>>
+_batchCall(ClientStub *stub, const std::string &method,
+           const std::vector<std::shared_ptr<Message>> &reqs,
+           const Endpoint &ep, const CallOptions &callOptions) {
+  auto promises = std::make_shared<std::vector<Promise<Result<R>>>>(reqs.size());
+  std::vector<Future<Result<R>>> futures;
+  futures.reserve(reqs.size());
+  for (auto &promise : *promises)
+    futures.push_back(promise.getFuture());
+  if (reqs.empty())
+    return futures;
+  CallOptions options = callOptions;
+  if (!_inheritUpstream(&options)) {
+    _completeBatch<R>(*promises,
+                      Result<std::shared_ptr<Message>>(std::make_exception_ptr(
+                          Exception(ErrorCode::Timeout,
+                                    "upstream deadline exceeded: " +
+                                        stub->fullName() + "." + method))));
+    return futures;
+  }
+  stub->getChannel(ep)
+      .then([method, reqs, options](Result<ClientChannelPtr> &&chan) {
+        try {
+          return chan.getValue()->invokeBatch(method, reqs, options);
+        } catch (...) {
+          return makeExceptionFuture<std::shared_ptr<Message>>(
+              std::current_exception());
+        }
+      })
+      .then([promises](Result<std::shared_ptr<Message>> &&result) {
+        _completeBatch<R>(*promises, std::move(result));
+      });
+  return futures;
+}
+
+/// @brief fanout 收集结果的状态，只有成功的结果计入 quorum
+template <typename R> struct FanoutContext {
+  /// @param ordered 等待所有的 endpoint，结果按照 endpoints 的顺序排列
+  FanoutContext(std::shared_ptr<const std::vector<Endpoint>> eps, size_t quorum,
+                bool ordered)
+      : endpoints(std::move(eps)), quorum(quorum), ordered(ordered),
+        pending(endpoints->size()) {}
+
+  /// @brief quorum 个成功，或者剩下的 endpoint 全部成功也达不到 quorum 的
+  /// 时候以收到的结果完成；ordered 的时候等待所有的结果
+  void onResult(size_t i, Result<R> &&r) {
+    std::lock_guard<std::mutex> lk(mutex);
+    if (done)
+      return;
+    --pending;
+    if (!r.hasException())
+      ++successes;
+    replies.push_back(FanoutReply<R>{(*endpoints)[i], std::move(r)});
+    indexes.push_back(i);
+    if (ordered ? pending == 0
+                : successes >= quorum || successes + pending < quorum)
+      _finish();
+  }
+  /// @brief 超过收集的截止时间，以已经收到的部分结果完成
+  void onDeadline() {
+    std::lock_guard<std::mutex> lk(mutex);
+    if (!done)
+      _finish();
+  }
+
+  Promise<std::vector<FanoutReply<R>>> promise;
+
+private:
+  void _finish() {
+    done = true;
+    if (!ordered) {
+      promise.setValue(std::move(replies));
+      return;
+    }
+    // 按照 endpoints 的顺序排列，还没有结果的 endpoint 以 Timeout 失败
+    std::vector<FanoutReply<R> *> byIndex(endpoints->size(), nullptr);
+    for (size_t k = 0; k < replies.size(); ++k)
+      byIndex[indexes[k]] = &replies[k];
+    std::vector<FanoutReply<R>> sorted;
+    sorted.reserve(endpoints->size());
+    for (size_t i = 0; i < endpoints->size(); ++i) {
+      const Endpoint &ep = (*endpoints)[i];
+      if (byIndex[i]) {
+        sorted.push_back(std::move(*byIndex[i]));
+        continue;
+      }
+      auto e = std::make_exception_ptr(
+          Exception(ErrorCode::Timeout, "fanout deadline exceeded: " +
+                                            getAddrFromEndpoint(ep).toHostPort()));
+      sorted.push_back(FanoutReply<R>{ep, Result<R>(e)});
+    }
+    promise.setValue(std::move(sorted));
+  }
+
+  std::mutex mutex;
+  std::shared_ptr<const std::vector<Endpoint>> endpoints;
+  std::vector<FanoutReply<R>> replies; // 按照完成的顺序
+  std::vector<size_t> indexes;         // replies 对应的 endpoint 下标
+  const size_t quorum;
+  const bool ordered;
+  size_t pending; // 还没有结果的 endpoint 数
+  size_t successes{0};
+  bool done{false};
+};
+
+/// @brief 向 endpoints 发送已经序列化的 request，按照 options 收集结果
+template <typename R>
+Future<std::vector<FanoutReply<R>>>
+_fanout(ClientStub *stub, const std::string &method,
+        const std::shared_ptr<const std::string> &request,
+        const std::vector<Endpoint> &endpoints, const CallOptions &callOptions,
+        const FanoutOptions &fanoutOptions) {
+  CallOptions options = callOptions;
+  if (!_inheritUpstream(&options))
+    return makeExceptionFuture<std::vector<FanoutReply<R>>>(
+        Exception(ErrorCode::Timeout, "upstream deadline exceeded: " +
+                                          stub->fullName() + "." + method));
+  std::vector<Future<Result<R>>> futures;
+  futures.reserve(endpoints.size());
+  for (const auto &ep : endpoints) {
+    futures.push_back(
+        stub->getChannel(ep)
+            .then([method, request, options](Result<ClientChannelPtr> &&chan) {
+              try {
+                return chan.getValue()->invokeSerialized(method, request,
+                                                         options);
+              } catch (...) {
+                return makeExceptionFuture<std::shared_ptr<Message>>(
+                    std::current_exception());
+              }
+            })
+            .then([](Result<std::shared_ptr<Message>> &&frame) -> Result<R> {
+              try {
+                R rsp;
+                messageDecode(*frame.getValue(), rsp);
+                return std::move(rsp);
+              } catch (...) {
+                return Result<R>(std::current_exception());
+              }
+            }));
+  }
+  if (futures.empty())
+    return makeReadyFuture(std::vector<FanoutReply<R>>());
+  auto eps = std::make_shared<const std::vector<Endpoint>>(endpoints);
+  // quorum 为 0 或者不小于 endpoint 数的时候等待所有的 endpoint
+  const bool all = fanoutOptions.quorum == 0 ||
+                   fanoutOptions.quorum >= futures.size();
+  auto ctx = std::make_shared<FanoutContext<R>>(
+      eps, all ? futures.size() : fanoutOptions.quorum, all);
+  auto fut = ctx->promise.getFuture();
+  for (size_t i = 0; i < futures.size(); ++i)
+    futures[i].then(
+        [ctx, i](Result<R> &&r) { ctx->onResult(i, std::move(r)); });
+  // 连接建立之前的等待不受 CallOptions.timeout 限制，由收集的截止时间兜底，
+  // 连接一直建立不起来的 endpoint 不会拖住整个 fanout
+  const auto timeout =
+      options.timeout.count() > 0 ? options.timeout : kDefaultCallTimeout;
+  auto loop = EventLoop::getEventLoopOfCurrentThread();
+  if (!loop)
+    loop = RPC_SERVER.next();
+  std::weak_ptr<FanoutContext<R>> wctx(ctx);
+  loop->runAfter(timeout.count() / 1000.0, [wctx]() {
+    if (auto ctx = wctx.lock())
+      ctx->onDeadline();
+  });
+  return fut;
+}
 } // namespace
 
 } // namespace lrpc
@@ -0,0 +1,377 @@
+#include "Stream.h"
+#include "Logging.h"
+
+namespace lrpc {
+
+const uint32_t kStreamWindow = 64;
+const size_t kStreamHighWaterMark = 4 * 1024 * 1024;
+
+/// -------------- Stream --------------
+
+Stream::Stream(int id, EventLoop *loop, const Message *prototype)
+    : id_(id), loop_(loop), prototype_(prototype), sendCredit_(kStreamWindow) {}
+
+/// @brief 在调用线程中序列化，发送在 loop 线程中执行
+bool Stream::write(const Message &msg) {
+  std::string payload;
+  if (!msg.SerializeToString(&payload)) {
+    LOG_ERROR << "Stream::write SerializeToString failed, stream " << id_;
+    return false;
+  }
+  if (loop_->isInLoopThread()) {
+    if (finished_ || localClosing_)
+      return false;
+    _writeInLoop(payload);
+  } else {
+    loop_->runInLoop(std::bind(&Stream::_writeInLoop, shared_from_this(),
+                               std::move(payload)));
+  }
+  return true;
+}
+
+void Stream::halfClose() {
+  if (loop_->isInLoopThread())
+    _halfCloseInLoop();
+  else
+    loop_->runInLoop(std::bind(&Stream::_halfCloseInLoop, shared_from_this()));
+}
+
+void Stream::cancel(const std::string &reason) {
+  if (loop_->isInLoopThread())
+    _cancelInLoop(reason);
+  else
+    loop_->runInLoop(
+        std::bind(&Stream::_cancelInLoop, shared_from_this(), reason));
+}
+
+Future<std::shared_ptr<Message>> Stream::read() {
+  if (loop_->isInLoopThread())
+    return _readInLoop();
+  return loop_->Execute(std::bind(&Stream::_readInLoop, shared_from_this()))
+      .unwrap();
+}
+
+/// @brief 设置回调函数之前收到的消息会立即交给回调函数
+void Stream::setOnMessage(MessageCallback cb) {
+  loop_->assertInLoopThread();
+  onMessage_ = std::move(cb);
+  if (!onMessage_)
+    return;
+  const uint32_t n = static_cast<uint32_t>(inbox_.size());
+  while (!inbox_.empty() && onMessage_) {
+    auto msg = std::move(inbox_.front());
+    inbox_.pop_front();
+    onMessage_(std::move(msg));
+  }
+  _consumed(n);
+  if (remoteClosed_ && onMessage_)
+    onMessage_(nullptr);
+}
+
+void Stream::setOnClose(CloseCallback cb) {
+  loop_->assertInLoopThread();
+  onClose_ = std::move(cb);
+}
+
+bool Stream::writable() const {
+  return !finished_ && !localClosing_ && outbox_.empty() && sendCredit_ > 0;
+}
+
+void Stream::_writeInLoop(std::string &payload) {
+  if (finished_ || localClosing_) {
+    LOG_WARN << "Stream::write after close, stream " << id_;
+    return;
+  }
+  outbox_.push_back(std::move(payload));
+  _flush();
+}
+
+void Stream::_halfCloseInLoop() {
+  if (finished_ || localClosing_)
+    return;
+  localClosing_ = true;
+  _flush();
+}
+
+void Stream::_cancelInLoop(const std::string &reason) {
+  if (finished_)
+    return;
+  RpcMessage frame;
+  StreamFrame *f = frame.mutable_stream();
+  f->set_type(StreamFrame::CANCEL);
+  f->mutable_error()->set_errnum(static_cast<int>(ErrorCode::StreamCancelled));
+  f->mutable_error()->set_msg(reason);
+  _send(frame);
+  _finish(std::make_exception_ptr(
+      Exception(ErrorCode::StreamCancelled, "cancelled locally: " + reason)));
+}
+
+Future<std::shared_ptr<Message>> Stream::_readInLoop() {
+  if (!inbox_.empty()) {
+    auto msg = std::move(inbox_.front());
+    inbox_.pop_front();
+    _consumed(1);
+    return makeReadyFuture(std::move(msg));
+  }
+  if (error_)
+    return makeExceptionFuture<std::shared_ptr<Message>>(
+        std::exception_ptr(error_));
+  if (remoteClosed_ || finished_)
+    return makeReadyFuture(std::shared_ptr<Message>());
+  readers_.emplace_back();
+  return readers_.back().getFuture();
+}
+
+/// @brief 处理对端发送的 frame
+void Stream::_onFrame(StreamFrame &frame) {
+  switch (frame.type()) {
+  case StreamFrame::DATA:
+    _onData(*frame.mutable_payload());
+    break;
+  case StreamFrame::CREDIT:
+    sendCredit_ += frame.credit();
+    _flush();
+    break;
+  case StreamFrame::HALF_CLOSE:
+    if (remoteClosed_)
+      break;
+    remoteClosed_ = true;
+    // 等待中的 read 说明 inbox_ 已经是空的
+    while (!readers_.empty()) {
+      readers_.front().setValue(std::shared_ptr<Message>());
+      readers_.pop_front();
+    }
+    if (onMessage_)
+      onMessage_(nullptr);
+    _maybeFinish();
+    break;
+  case StreamFrame::CANCEL: {
+    const auto code = frame.error().errnum()
+                          ? static_cast<ErrorCode>(frame.error().errnum())
+                          : ErrorCode::StreamCancelled;
+    _finish(std::make_exception_ptr(Exception(code, frame.error().msg())));
+    break;
+  }
+  default:
+    LOG_ERROR << "unexpected stream frame type " << frame.type() << ", stream "
+              << id_;
+    break;
+  }
+}
+
+void Stream::_onData(std::string &payload) {
+  if (remoteClosed_ || finished_) {
+    LOG_WARN << "Stream DATA after close, stream " << id_;
+    return;
+  }
+  std::shared_ptr<Message> msg(prototype_->New());
+  if (!msg->ParseFromString(payload)) {
+    _cancelInLoop("decode stream message failed");
+    return;
+  }
+  if (onMessage_) {
+    onMessage_(std::move(msg));
+    _consumed(1);
+  } else if (!readers_.empty()) {
+    auto promise = std::move(readers_.front());
+    readers_.pop_front();
+    promise.setValue(std::move(msg));
+    _consumed(1);
+  } else {
+    // 应用还没有读取，占用的 credit 在 read 的时候归还
+    inbox_.push_back(std::move(msg));
+  }
+}
+
+void Stream::_flush() {
+  if (finished_)
+    return;
+  auto set = set_.lock();
+  if (!set)
+    return;
+  while (!outbox_.empty() && sendCredit_ > 0) {
+    if (set->congested(shared_from_this())) {
+      blocked_ = true;
+      return;
+    }
+    RpcMessage frame;
+    StreamFrame *f = frame.mutable_stream();
+    f->set_type(StreamFrame::DATA);
+    f->set_payload(std::move(outbox_.front()));
+    outbox_.pop_front();
+    --sendCredit_;
+    if (!_send(frame)) {
+      _finish(std::make_exception_ptr(
+          Exception(ErrorCode::ConnectionReset, "stream send failed")));
+      return;
+    }
+  }
+  if (!outbox_.empty()) {
+    // 等待对端归还 credit
+    blocked_ = true;
+    return;
+  }
+  if (localClosing_ && !localClosed_) {
+    RpcMessage frame;
+    frame.mutable_stream()->set_type(StreamFrame::HALF_CLOSE);
+    localClosed_ = true;
+    _send(frame);
+    _maybeFinish();
+    return;
+  }
+  // 只在从阻塞恢复的时候通知，避免在回调中 write 导致递归
+  if (blocked_ && sendCredit_ > 0) {
+    blocked_ = false;
+    if (onWritable_)
+      onWritable_();
+  }
+}
+
+void Stream::_consumed(uint32_t n) {
+  consumed_ += n;
+  if (consumed_ < kStreamWindow / 2 || remoteClosed_ || finished_)
+    return;
+  RpcMessage frame;
+  StreamFrame *f = frame.mutable_stream();
+  f->set_type(StreamFrame::CREDIT);
+  f->set_credit(consumed_);
+  consumed_ = 0;
+  _send(frame);
+}
+
+bool Stream::_send(RpcMessage &frame) {
+  auto set = set_.lock();
+  if (!set)
+    return false;
+  frame.mutable_stream()->set_id(id_);
+  return set->send(frame);
+}
+
+void Stream::_maybeFinish() {
+  if (localClosed_ && remoteClosed_)
+    _finish(nullptr);
+}
+
+/// @brief stream 结束：唤醒等待的 read，从 StreamSet 中删除，调用 onClose
+void Stream::_finish(std::exception_ptr err) {
+  if (finished_)
+    return;
+  finished_ = true;
+  error_ = err;
+  outbox_.clear();
+  while (!readers_.empty()) {
+    if (err)
+      readers_.front().setException(std::exception_ptr(err));
+    else
+      readers_.front().setValue(std::shared_ptr<Message>());
+    readers_.pop_front();
+  }
+  // 回调函数可能持有 stream 的 shared_ptr，结束之后释放
+  auto self = shared_from_this();
+  auto onClose = std::move(onClose_);
+  onClose_ = nullptr;
+  onMessage_ = nullptr;
+  onWritable_ = nullptr;
+  if (auto set = set_.lock())
+    set->remove(id_);
+  if (onClose)
+    onClose(err);
+}
+
+/// -------------- StreamSet --------------
+
+StreamSet::StreamSet(std::weak_ptr<TcpConnection> conn, Encoder *encoder)
+    : conn_(std::move(conn)), encoder_(encoder) {}
+
+int StreamSet::nextId() {
+  // 跳过仍然在使用的 id
+  do {
+    nextId_ = nextId_ == INT32_MAX ? 1 : nextId_ + 1;
+  } while (streams_.count(nextId_));
+  return nextId_;
+}
+
+void StreamSet::add(const std::shared_ptr<Stream> &stream) {
+  stream->set_ = shared_from_this();
+  bool succ = streams_.insert({stream->id(), stream}).second;
+  assert(succ);
+  (void)succ;
+}
+
+void StreamSet::remove(int id) { streams_.erase(id); }
+
+std::shared_ptr<Stream> StreamSet::find(int id) const {
+  auto it = streams_.find(id);
+  return it == streams_.end() ? nullptr : it->second;
+}
+
+void StreamSet::onFrame(StreamFrame &frame) {
+  auto stream = find(frame.id());
+  if (stream) {
+    stream->_onFrame(frame);
+    return;
+  }
+  // stream 已经结束，CREDIT 和 CANCEL 可以直接忽略
+  if (frame.type() == StreamFrame::DATA ||
+      frame.type() == StreamFrame::HALF_CLOSE)
+    cancel(frame.id(), ErrorCode::StreamCancelled,
+           "no such stream " + std::to_string(frame.id()));
+}
+
+bool StreamSet::send(RpcMessage &frame) {
+  auto conn = conn_.lock();
+  if (closed_ || !conn)
+    return false;
+  Buffer bytes = encoder_->bytesEncoder_(frame);
+  return conn->send(bytes);
+}
+
+bool StreamSet::congested(const std::shared_ptr<Stream> &stream) {
+  auto conn = conn_.lock();
+  if (!conn || conn->outputBytes() < kStreamHighWaterMark)
+    return false;
+  if (!stream->congested_) {
+    stream->congested_ = true;
+    blocked_.push_back(stream);
+  }
+  if (blocked_.size() == 1) {
+    // outputBuffer 写完之后唤醒挂起的 stream
+    std::weak_ptr<StreamSet> wself(shared_from_this());
+    conn->runAfterDrained([wself] {
+      if (auto self = wself.lock())
+        self->_onWriteComplete();
+    });
+  }
+  return true;
+}
+
+void StreamSet::cancel(int id, ErrorCode code, const std::string &reason) {
+  RpcMessage frame;
+  StreamFrame *f = frame.mutable_stream();
+  f->set_id(id);
+  f->set_type(StreamFrame::CANCEL);
+  f->mutable_error()->set_errnum(static_cast<int>(code));
+  f->mutable_error()->set_msg(reason);
+  send(frame);
+}
+
+void StreamSet::closeAll(const std::system_error &err) {
+  closed_ = true;
+  auto streams = std::move(streams_);
+  streams_.clear();
+  for (auto &kv : streams)
+    kv.second->_finish(std::make_exception_ptr(err));
+}
+
+void StreamSet::_onWriteComplete() {
+  auto blocked = std::move(blocked_);
+  blocked_.clear();
+  for (auto &w : blocked) {
+    if (auto stream = w.lock()) {
+      stream->congested_ = false;
+      stream->_flush();
+    }
+  }
+}
+
+} // namespace lrpc
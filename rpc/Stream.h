@@ -0,0 +1,175 @@
+/**
+ * @file Stream.h
+ * @brief 流式调用：server streaming / client streaming / bidirectional
+ *
+ * stream 复用 rpc 连接，通过 RpcMessage.stream 中的 StreamFrame 传输:
+ * 1. 客户端发送 OPEN 打开 stream，之后两端都可以发送 DATA
+ * 2. 一端发送 HALF_CLOSE 表示不会再发送 DATA，两端都 HALF_CLOSE 之后 stream 结束
+ * 3. 任意一端发送 CANCEL 立即结束 stream
+ *
+ * 流量控制按照消息条数计算 credit：每个方向初始有 kStreamWindow 个 credit，
+ * 发送一条 DATA 消耗一个，接收端的消息被应用取走之后通过 CREDIT 归还.
+ * 另外连接的 outputBuffer 超过 kStreamHighWaterMark 的时候暂停发送 DATA，
+ * 等待 TcpConnection 写完成之后继续发送
+ */
+
+#ifndef LRPC_STREAM_H
+#define LRPC_STREAM_H
+
+#include "Coder.h"
+#include "EventLoop.h"
+#include "RpcException.h"
+#include "TcpConnection.h"
+#include "future.h"
+#include "lrpc.pb.h"
+#include <deque>
+#include <functional>
+#include <google/protobuf/message.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lrpc {
+
+using google::protobuf::Message;
+using namespace net;
+
+/// @brief 每个方向初始的发送窗口（消息条数）
+extern const uint32_t kStreamWindow;
+/// @brief 连接 outputBuffer 超过这个大小的时候暂停发送 DATA
+extern const size_t kStreamHighWaterMark;
+
+class StreamSet;
+
+/**
+ * @brief 一个流式调用，客户端和服务端共用
+ * 1. write / halfClose / cancel / read 是线程安全的，在非 loop 线程调用的时候
+ *    会被转移到 stream 所属的 loop 执行
+ * 2. setOnXXX 只能在 loop 线程中调用（服务端的 stream handler，或者客户端
+ *    openStream 返回的 future 的回调函数）
+ * 3. 接收消息有两种方式：setOnMessage 设置回调函数，或者 read() 逐条读取.
+ *    两种方式收到 nullptr 都表示对端已经 HALF_CLOSE
+ */
+class Stream : public std::enable_shared_from_this<Stream> {
+  friend class StreamSet;
+
+public:
+  using MessageCallback = std::function<void(std::shared_ptr<Message> &&)>;
+  /// @brief stream 结束的时候调用，正常结束的时候参数是 nullptr
+  using CloseCallback = std::function<void(std::exception_ptr)>;
+  using WritableCallback = std::function<void()>;
+
+  /// @param prototype 对端发送的消息类型
+  Stream(int id, EventLoop *loop, const Message *prototype);
+  ~Stream() = default;
+
+  int id() const { return id_; }
+  EventLoop *getLoop() const { return loop_; }
+
+  /// @brief 发送一条消息，没有 credit 或者连接拥塞的时候先放到发送队列.
+  /// 已经 halfClose 或者 stream 已经结束的时候返回 false
+  bool write(const Message &msg);
+  /// @brief 发送队列中的消息发送完毕之后发送 HALF_CLOSE
+  void halfClose();
+  /// @brief 立即结束 stream，通知对端
+  void cancel(const std::string &reason = std::string());
+  /// @brief 读取下一条消息，对端 HALF_CLOSE 之后返回 nullptr
+  Future<std::shared_ptr<Message>> read();
+
+  void setOnMessage(MessageCallback cb);
+  void setOnClose(CloseCallback cb);
+  /// @brief 发送队列从阻塞变为可以发送的时候调用
+  void setOnWritable(WritableCallback cb) { onWritable_ = std::move(cb); }
+
+  /// @brief 现在 write 的消息是否能够立即发送
+  bool writable() const;
+  bool finished() const { return finished_; }
+
+private:
+  void _writeInLoop(std::string &payload);
+  void _halfCloseInLoop();
+  void _cancelInLoop(const std::string &reason);
+  Future<std::shared_ptr<Message>> _readInLoop();
+
+  void _onFrame(StreamFrame &frame);
+  void _onData(std::string &payload);
+  // 发送队列中的消息，直到 credit 用完或者连接拥塞
+  void _flush();
+  // 应用取走了 n 条消息，累计到一定数量之后归还 credit
+  void _consumed(uint32_t n);
+  // 填写 stream id 并通过 StreamSet 发送
+  bool _send(RpcMessage &frame);
+  void _maybeFinish();
+  void _finish(std::exception_ptr err);
+
+  const int id_;
+  EventLoop *const loop_;
+  const Message *const prototype_;
+  std::weak_ptr<StreamSet> set_;
+
+  // 发送方向
+  uint32_t sendCredit_;
+  std::deque<std::string> outbox_;
+  bool blocked_{false};      // 上一次 _flush 是否没有发送完
+  bool congested_{false};    // 是否在等待连接写完成
+  bool localClosing_{false}; // 调用了 halfClose
+  bool localClosed_{false};  // 已经发送了 HALF_CLOSE
+
+  // 接收方向
+  std::deque<std::shared_ptr<Message>> inbox_;
+  std::deque<Promise<std::shared_ptr<Message>>> readers_;
+  uint32_t consumed_{0}; // 还没有归还的 credit
+  bool remoteClosed_{false};
+
+  bool finished_{false};
+  std::exception_ptr error_;
+
+  MessageCallback onMessage_;
+  CloseCallback onClose_;
+  WritableCallback onWritable_;
+};
+
+/**
+ * @brief 一个连接上的所有 stream，ServerChannel / ClientChannel 各自持有一个.
+ * 负责 frame 的分发、编码发送，以及连接拥塞时挂起的 stream 的唤醒
+ */
+class StreamSet : public std::enable_shared_from_this<StreamSet> {
+public:
+  /// @param encoder 所属 channel 的 encoder，生命周期和 channel 相同
+  StreamSet(std::weak_ptr<TcpConnection> conn, Encoder *encoder);
+  ~StreamSet() = default;
+
+  /// @brief 客户端分配 stream id
+  int nextId();
+  void add(const std::shared_ptr<Stream> &stream);
+  void remove(int id);
+  std::shared_ptr<Stream> find(int id) const;
+  bool empty() const { return streams_.empty(); }
+
+  /// @brief 把 frame 交给对应的 stream，未知的 stream 回复 CANCEL
+  void onFrame(StreamFrame &frame);
+  /// @brief 编码并发送 frame
+  bool send(RpcMessage &frame);
+  /// @brief 连接拥塞的时候返回 true，并在写完成之后重新调用 stream 的 _flush
+  bool congested(const std::shared_ptr<Stream> &stream);
+  /// @brief 回复一个 CANCEL，用于对端引用了不存在的 stream
+  void cancel(int id, ErrorCode code, const std::string &reason);
+  /// @brief 连接断开，结束所有的 stream
+  void closeAll(const std::system_error &err);
+
+private:
+  void _onWriteComplete();
+
+  std::weak_ptr<TcpConnection> conn_;
+  Encoder *encoder_;
+  std::unordered_map<int, std::shared_ptr<Stream>> streams_;
+  // 等待连接写完成的 stream
+  std::vector<std::weak_ptr<Stream>> blocked_;
+  int nextId_{0};
+  bool closed_{false};
+};
+
+} // namespace lrpc
+
+#endif
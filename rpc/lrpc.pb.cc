@@ -1,352 +1,545 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: lrpc.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "lrpc.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace lrpc {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Request_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Request_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Error_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Error_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Response_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Response_reflection_ = NULL;
-struct ResponseOneofInstance {
-  ::google::protobuf::internal::ArenaStringPtr serialized_response_;
-  const ::lrpc::Error* error_;
-}* Response_default_oneof_instance_ = NULL;
-const ::google::protobuf::Descriptor* RpcMessage_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  RpcMessage_reflection_ = NULL;
-struct RpcMessageOneofInstance {
-  const ::lrpc::Request* request_;
-  const ::lrpc::Response* response_;
-}* RpcMessage_default_oneof_instance_ = NULL;
-const ::google::protobuf::Descriptor* Endpoint_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Endpoint_reflection_ = NULL;
-const ::google::protobuf::Descriptor* EndpointList_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  EndpointList_reflection_ = NULL;
-const ::google::protobuf::Descriptor* KeepaliveInfo_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  KeepaliveInfo_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ServiceName_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ServiceName_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Status_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Status_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor_ = NULL;
-const ::google::protobuf::ServiceDescriptor* NameService_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_lrpc_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_lrpc_2eproto() {
-  protobuf_AddDesc_lrpc_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "lrpc.proto");
-  GOOGLE_CHECK(file != NULL);
-  Request_descriptor_ = file->message_type(0);
-  static const int Request_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, service_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, method_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, serialized_request_),
+namespace lrpc {
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.serialized_request_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.attachment_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.accept_compress_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/int64_t{0}
+  , /*decltype(_impl_.deadline_us_)*/int64_t{0}
+  , /*decltype(_impl_.compress_dict_)*/0u
+  , /*decltype(_impl_.priority_)*/0
+  , /*decltype(_impl_.oneway_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR Error::Error(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.errnum_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ErrorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ErrorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ErrorDefaultTypeInternal() {}
+  union {
+    Error _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ErrorDefaultTypeInternal _Error_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.attachment_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.accept_compress_)*/0u
+  , /*decltype(_impl_.compress_dict_)*/0u
+  , /*decltype(_impl_.Body_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+PROTOBUF_CONSTEXPR StreamFrame::StreamFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/nullptr
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.credit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StreamFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StreamFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StreamFrameDefaultTypeInternal() {}
+  union {
+    StreamFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamFrameDefaultTypeInternal _StreamFrame_default_instance_;
+PROTOBUF_CONSTEXPR PushFrame::PushFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.topic_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PushFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PushFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PushFrameDefaultTypeInternal() {}
+  union {
+    PushFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushFrameDefaultTypeInternal _PushFrame_default_instance_;
+PROTOBUF_CONSTEXPR ChunkFrame::ChunkFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.total_len_)*/uint64_t{0u}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChunkFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChunkFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChunkFrameDefaultTypeInternal() {}
+  union {
+    ChunkFrame _instance;
   };
-  Request_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Request_descriptor_,
-      Request::default_instance_,
-      Request_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(Request),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, _is_default_instance_));
-  Error_descriptor_ = file->message_type(1);
-  static const int Error_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Error, errnum_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Error, msg_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChunkFrameDefaultTypeInternal _ChunkFrame_default_instance_;
+PROTOBUF_CONSTEXPR BatchRequest::BatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchRequestDefaultTypeInternal() {}
+  union {
+    BatchRequest _instance;
   };
-  Error_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Error_descriptor_,
-      Error::default_instance_,
-      Error_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(Error),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Error, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Error, _is_default_instance_));
-  Response_descriptor_ = file->message_type(2);
-  static const int Response_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, id_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, serialized_response_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, error_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, Body_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRequestDefaultTypeInternal _BatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR BatchResponse::BatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.responses_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchResponseDefaultTypeInternal() {}
+  union {
+    BatchResponse _instance;
   };
-  Response_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Response_descriptor_,
-      Response::default_instance_,
-      Response_offsets_,
-      -1,
-      -1,
-      -1,
-      Response_default_oneof_instance_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, _oneof_case_[0]),
-      sizeof(Response),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, _is_default_instance_));
-  RpcMessage_descriptor_ = file->message_type(3);
-  static const int RpcMessage_offsets_[3] = {
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(RpcMessage_default_oneof_instance_, request_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(RpcMessage_default_oneof_instance_, response_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcMessage, Body_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchResponseDefaultTypeInternal _BatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR RpcMessage::RpcMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.Body_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct RpcMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcMessageDefaultTypeInternal() {}
+  union {
+    RpcMessage _instance;
   };
-  RpcMessage_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      RpcMessage_descriptor_,
-      RpcMessage::default_instance_,
-      RpcMessage_offsets_,
-      -1,
-      -1,
-      -1,
-      RpcMessage_default_oneof_instance_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcMessage, _oneof_case_[0]),
-      sizeof(RpcMessage),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcMessage, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcMessage, _is_default_instance_));
-  Endpoint_descriptor_ = file->message_type(4);
-  static const int Endpoint_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Endpoint, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Endpoint, port_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcMessageDefaultTypeInternal _RpcMessage_default_instance_;
+PROTOBUF_CONSTEXPR Endpoint::Endpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EndpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EndpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EndpointDefaultTypeInternal() {}
+  union {
+    Endpoint _instance;
   };
-  Endpoint_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Endpoint_descriptor_,
-      Endpoint::default_instance_,
-      Endpoint_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(Endpoint),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Endpoint, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Endpoint, _is_default_instance_));
-  EndpointList_descriptor_ = file->message_type(5);
-  static const int EndpointList_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EndpointList, endpoints_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EndpointDefaultTypeInternal _Endpoint_default_instance_;
+PROTOBUF_CONSTEXPR EndpointList::EndpointList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.endpoints_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EndpointListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EndpointListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EndpointListDefaultTypeInternal() {}
+  union {
+    EndpointList _instance;
   };
-  EndpointList_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      EndpointList_descriptor_,
-      EndpointList::default_instance_,
-      EndpointList_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(EndpointList),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EndpointList, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EndpointList, _is_default_instance_));
-  KeepaliveInfo_descriptor_ = file->message_type(6);
-  static const int KeepaliveInfo_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeepaliveInfo, servicename_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeepaliveInfo, endpoint_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EndpointListDefaultTypeInternal _EndpointList_default_instance_;
+PROTOBUF_CONSTEXPR KeepaliveInfo::KeepaliveInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.servicename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.endpoint_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeepaliveInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeepaliveInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeepaliveInfoDefaultTypeInternal() {}
+  union {
+    KeepaliveInfo _instance;
   };
-  KeepaliveInfo_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      KeepaliveInfo_descriptor_,
-      KeepaliveInfo::default_instance_,
-      KeepaliveInfo_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(KeepaliveInfo),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeepaliveInfo, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeepaliveInfo, _is_default_instance_));
-  ServiceName_descriptor_ = file->message_type(7);
-  static const int ServiceName_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServiceName, name_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeepaliveInfoDefaultTypeInternal _KeepaliveInfo_default_instance_;
+PROTOBUF_CONSTEXPR ServiceName::ServiceName(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServiceNameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServiceNameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServiceNameDefaultTypeInternal() {}
+  union {
+    ServiceName _instance;
   };
-  ServiceName_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      ServiceName_descriptor_,
-      ServiceName::default_instance_,
-      ServiceName_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(ServiceName),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServiceName, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServiceName, _is_default_instance_));
-  Status_descriptor_ = file->message_type(8);
-  static const int Status_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Status, result_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServiceNameDefaultTypeInternal _ServiceName_default_instance_;
+PROTOBUF_CONSTEXPR Status::Status(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatusDefaultTypeInternal() {}
+  union {
+    Status _instance;
   };
-  Status_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Status_descriptor_,
-      Status::default_instance_,
-      Status_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(Status),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Status, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Status, _is_default_instance_));
-  MessageType_descriptor_ = file->enum_type(0);
-  NameService_descriptor_ = file->service(0);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_lrpc_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Request_descriptor_, &Request::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Error_descriptor_, &Error::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Response_descriptor_, &Response::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      RpcMessage_descriptor_, &RpcMessage::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Endpoint_descriptor_, &Endpoint::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      EndpointList_descriptor_, &EndpointList::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      KeepaliveInfo_descriptor_, &KeepaliveInfo::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      ServiceName_descriptor_, &ServiceName::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Status_descriptor_, &Status::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_lrpc_2eproto() {
-  delete Request::default_instance_;
-  delete Request_reflection_;
-  delete Error::default_instance_;
-  delete Error_reflection_;
-  delete Response::default_instance_;
-  delete Response_default_oneof_instance_;
-  delete Response_reflection_;
-  delete RpcMessage::default_instance_;
-  delete RpcMessage_default_oneof_instance_;
-  delete RpcMessage_reflection_;
-  delete Endpoint::default_instance_;
-  delete Endpoint_reflection_;
-  delete EndpointList::default_instance_;
-  delete EndpointList_reflection_;
-  delete KeepaliveInfo::default_instance_;
-  delete KeepaliveInfo_reflection_;
-  delete ServiceName::default_instance_;
-  delete ServiceName_reflection_;
-  delete Status::default_instance_;
-  delete Status_reflection_;
-}
-
-void protobuf_AddDesc_lrpc_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_lrpc_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\nlrpc.proto\022\004lrpc\"\\\n\007Request\022\n\n\002id\030\001 \001("
-    "\005\022\024\n\014service_name\030\002 \001(\t\022\023\n\013method_name\030\003"
-    " \001(\t\022\032\n\022serialized_request\030\004 \001(\014\"$\n\005Erro"
-    "r\022\016\n\006errnum\030\001 \001(\005\022\013\n\003msg\030\002 \001(\t\"[\n\010Respon"
-    "se\022\n\n\002id\030\001 \001(\005\022\035\n\023serialized_response\030\002 "
-    "\001(\014H\000\022\034\n\005error\030\003 \001(\0132\013.lrpc.ErrorH\000B\006\n\004B"
-    "ody\"Z\n\nRpcMessage\022 \n\007request\030\001 \001(\0132\r.lrp"
-    "c.RequestH\000\022\"\n\010response\030\002 \001(\0132\016.lrpc.Res"
-    "ponseH\000B\006\n\004Body\"$\n\010Endpoint\022\n\n\002ip\030\001 \001(\t\022"
-    "\014\n\004port\030\002 \001(\005\"1\n\014EndpointList\022!\n\tendpoin"
-    "ts\030\001 \003(\0132\016.lrpc.Endpoint\"F\n\rKeepaliveInf"
-    "o\022\023\n\013serviceName\030\001 \001(\t\022 \n\010endpoint\030\002 \001(\013"
-    "2\016.lrpc.Endpoint\"\033\n\013ServiceName\022\014\n\004name\030"
-    "\001 \001(\t\"\030\n\006Status\022\016\n\006result\030\001 \001(\005*\316\001\n\013Mess"
-    "ageType\022\024\n\020HEARTBEAT_PACKET\020\000\022\030\n\024RPC_SER"
-    "VICE_REGISTER\020\001\022!\n\035RPC_SERVICE_REGISTER_"
-    "RESPONSE\020\002\022\030\n\024RPC_SERVICE_DISCOVER\020\003\022!\n\035"
-    "RPC_SERVICE_DISCOVER_RESPONSE\020\004\022\026\n\022RPC_M"
-    "ETHOD_REQUEST\020\005\022\027\n\023RPC_METHOD_RESPONSE\020\006"
-    "2x\n\013NameService\0227\n\014GetEndpoints\022\021.lrpc.S"
-    "erviceName\032\022.lrpc.EndpointList\"\000\0220\n\tKeep"
-    "alive\022\023.lrpc.KeepaliveInfo\032\014.lrpc.Status"
-    "\"\000B\003\200\001\001b\006proto3", 895);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "lrpc.proto", &protobuf_RegisterTypes);
-  Request::default_instance_ = new Request();
-  Error::default_instance_ = new Error();
-  Response::default_instance_ = new Response();
-  Response_default_oneof_instance_ = new ResponseOneofInstance();
-  RpcMessage::default_instance_ = new RpcMessage();
-  RpcMessage_default_oneof_instance_ = new RpcMessageOneofInstance();
-  Endpoint::default_instance_ = new Endpoint();
-  EndpointList::default_instance_ = new EndpointList();
-  KeepaliveInfo::default_instance_ = new KeepaliveInfo();
-  ServiceName::default_instance_ = new ServiceName();
-  Status::default_instance_ = new Status();
-  Request::default_instance_->InitAsDefaultInstance();
-  Error::default_instance_->InitAsDefaultInstance();
-  Response::default_instance_->InitAsDefaultInstance();
-  RpcMessage::default_instance_->InitAsDefaultInstance();
-  Endpoint::default_instance_->InitAsDefaultInstance();
-  EndpointList::default_instance_->InitAsDefaultInstance();
-  KeepaliveInfo::default_instance_->InitAsDefaultInstance();
-  ServiceName::default_instance_->InitAsDefaultInstance();
-  Status::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_lrpc_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_lrpc_2eproto {
-  StaticDescriptorInitializer_lrpc_2eproto() {
-    protobuf_AddDesc_lrpc_2eproto();
-  }
-} static_descriptor_initializer_lrpc_2eproto_;
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MessageType_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatusDefaultTypeInternal _Status_default_instance_;
+}  // namespace lrpc
+static ::_pb::Metadata file_level_metadata_lrpc_2eproto[14];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_lrpc_2eproto[4];
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_lrpc_2eproto[1];
+
+const uint32_t TableStruct_lrpc_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.serialized_request_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.deadline_us_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.accept_compress_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.compress_dict_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.oneway_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Request, _impl_.attachment_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Error, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Error, _impl_.errnum_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Error, _impl_.msg_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _impl_.id_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _impl_.accept_compress_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _impl_.compress_dict_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _impl_.attachment_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Response, _impl_.Body_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.credit_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::StreamFrame, _impl_.error_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::PushFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::PushFrame, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::PushFrame, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::PushFrame, _impl_.topic_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::PushFrame, _impl_.payload_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::ChunkFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::ChunkFrame, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::ChunkFrame, _impl_.total_len_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::ChunkFrame, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::BatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::BatchRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::BatchRequest, _impl_.requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::BatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::BatchResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::BatchResponse, _impl_.responses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::RpcMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::lrpc::RpcMessage, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::lrpc::RpcMessage, _impl_.Body_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Endpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Endpoint, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Endpoint, _impl_.port_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::Endpoint, _impl_.weight_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::EndpointList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::EndpointList, _impl_.endpoints_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::KeepaliveInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::KeepaliveInfo, _impl_.servicename_),
+  PROTOBUF_FIELD_OFFSET(::lrpc::KeepaliveInfo, _impl_.endpoint_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::ServiceName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::ServiceName, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Status, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lrpc::Status, _impl_.result_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::lrpc::Request)},
+  { 17, -1, -1, sizeof(::lrpc::Error)},
+  { 25, -1, -1, sizeof(::lrpc::Response)},
+  { 38, -1, -1, sizeof(::lrpc::StreamFrame)},
+  { 51, -1, -1, sizeof(::lrpc::PushFrame)},
+  { 61, -1, -1, sizeof(::lrpc::ChunkFrame)},
+  { 70, -1, -1, sizeof(::lrpc::BatchRequest)},
+  { 78, -1, -1, sizeof(::lrpc::BatchResponse)},
+  { 86, -1, -1, sizeof(::lrpc::RpcMessage)},
+  { 100, -1, -1, sizeof(::lrpc::Endpoint)},
+  { 109, -1, -1, sizeof(::lrpc::EndpointList)},
+  { 116, -1, -1, sizeof(::lrpc::KeepaliveInfo)},
+  { 124, -1, -1, sizeof(::lrpc::ServiceName)},
+  { 131, -1, -1, sizeof(::lrpc::Status)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::lrpc::_Request_default_instance_._instance,
+  &::lrpc::_Error_default_instance_._instance,
+  &::lrpc::_Response_default_instance_._instance,
+  &::lrpc::_StreamFrame_default_instance_._instance,
+  &::lrpc::_PushFrame_default_instance_._instance,
+  &::lrpc::_ChunkFrame_default_instance_._instance,
+  &::lrpc::_BatchRequest_default_instance_._instance,
+  &::lrpc::_BatchResponse_default_instance_._instance,
+  &::lrpc::_RpcMessage_default_instance_._instance,
+  &::lrpc::_Endpoint_default_instance_._instance,
+  &::lrpc::_EndpointList_default_instance_._instance,
+  &::lrpc::_KeepaliveInfo_default_instance_._instance,
+  &::lrpc::_ServiceName_default_instance_._instance,
+  &::lrpc::_Status_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_lrpc_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nlrpc.proto\022\004lrpc\"\373\001\n\007Request\022\n\n\002id\030\001 \001"
+  "(\005\022\024\n\014service_name\030\002 \001(\t\022\023\n\013method_name\030"
+  "\003 \001(\t\022\032\n\022serialized_request\030\004 \001(\014\022\022\n\ntim"
+  "eout_ms\030\005 \001(\003\022\023\n\013deadline_us\030\006 \001(\003\022\027\n\017ac"
+  "cept_compress\030\007 \001(\r\022\025\n\rcompress_dict\030\010 \001"
+  "(\r\022 \n\010priority\030\t \001(\0162\016.lrpc.Priority\022\016\n\006"
+  "oneway\030\n \001(\010\022\022\n\nattachment\030\013 \001(\014\"$\n\005Erro"
+  "r\022\016\n\006errnum\030\001 \001(\005\022\013\n\003msg\030\002 \001(\t\"\237\001\n\010Respo"
+  "nse\022\n\n\002id\030\001 \001(\005\022\035\n\023serialized_response\030\002"
+  " \001(\014H\000\022\034\n\005error\030\003 \001(\0132\013.lrpc.ErrorH\000\022\027\n\017"
+  "accept_compress\030\004 \001(\r\022\025\n\rcompress_dict\030\005"
+  " \001(\r\022\022\n\nattachment\030\006 \001(\014B\006\n\004Body\"\353\001\n\013Str"
+  "eamFrame\022\n\n\002id\030\001 \001(\005\022$\n\004type\030\002 \001(\0162\026.lrp"
+  "c.StreamFrame.Type\022\024\n\014service_name\030\003 \001(\t"
+  "\022\023\n\013method_name\030\004 \001(\t\022\017\n\007payload\030\005 \001(\014\022\016"
+  "\n\006credit\030\006 \001(\r\022\032\n\005error\030\007 \001(\0132\013.lrpc.Err"
+  "or\"B\n\004Type\022\010\n\004OPEN\020\000\022\010\n\004DATA\020\001\022\016\n\nHALF_C"
+  "LOSE\020\002\022\n\n\006CANCEL\020\003\022\n\n\006CREDIT\020\004\"\232\001\n\tPushF"
+  "rame\022\"\n\004type\030\001 \001(\0162\024.lrpc.PushFrame.Type"
+  "\022\024\n\014service_name\030\002 \001(\t\022\r\n\005topic\030\003 \001(\t\022\017\n"
+  "\007payload\030\004 \001(\014\"3\n\004Type\022\r\n\tSUBSCRIBE\020\000\022\017\n"
+  "\013UNSUBSCRIBE\020\001\022\013\n\007PUBLISH\020\002\"9\n\nChunkFram"
+  "e\022\n\n\002id\030\001 \001(\r\022\021\n\ttotal_len\030\002 \001(\004\022\014\n\004data"
+  "\030\003 \001(\014\"\?\n\014BatchRequest\022\035\n\006header\030\001 \001(\0132\r"
+  ".lrpc.Request\022\020\n\010requests\030\002 \003(\014\"R\n\rBatch"
+  "Response\022\036\n\006header\030\001 \001(\0132\016.lrpc.Response"
+  "\022!\n\tresponses\030\002 \003(\0132\016.lrpc.Response\"\237\002\n\n"
+  "RpcMessage\022 \n\007request\030\001 \001(\0132\r.lrpc.Reque"
+  "stH\000\022\"\n\010response\030\002 \001(\0132\016.lrpc.ResponseH\000"
+  "\022#\n\006stream\030\003 \001(\0132\021.lrpc.StreamFrameH\000\022\037\n"
+  "\004push\030\004 \001(\0132\017.lrpc.PushFrameH\000\022!\n\005chunk\030"
+  "\005 \001(\0132\020.lrpc.ChunkFrameH\000\022+\n\rbatch_reque"
+  "st\030\006 \001(\0132\022.lrpc.BatchRequestH\000\022-\n\016batch_"
+  "response\030\007 \001(\0132\023.lrpc.BatchResponseH\000B\006\n"
+  "\004Body\"4\n\010Endpoint\022\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 "
+  "\001(\005\022\016\n\006weight\030\003 \001(\005\"1\n\014EndpointList\022!\n\te"
+  "ndpoints\030\001 \003(\0132\016.lrpc.Endpoint\"F\n\rKeepal"
+  "iveInfo\022\023\n\013serviceName\030\001 \001(\t\022 \n\010endpoint"
+  "\030\002 \001(\0132\016.lrpc.Endpoint\"\033\n\013ServiceName\022\014\n"
+  "\004name\030\001 \001(\t\"\030\n\006Status\022\016\n\006result\030\001 \001(\005*\316\001"
+  "\n\013MessageType\022\024\n\020HEARTBEAT_PACKET\020\000\022\030\n\024R"
+  "PC_SERVICE_REGISTER\020\001\022!\n\035RPC_SERVICE_REG"
+  "ISTER_RESPONSE\020\002\022\030\n\024RPC_SERVICE_DISCOVER"
+  "\020\003\022!\n\035RPC_SERVICE_DISCOVER_RESPONSE\020\004\022\026\n"
+  "\022RPC_METHOD_REQUEST\020\005\022\027\n\023RPC_METHOD_RESP"
+  "ONSE\020\006*a\n\010Priority\022\024\n\020PRIORITY_DEFAULT\020\000"
+  "\022\024\n\020PRIORITY_CONTROL\020\001\022\025\n\021PRIORITY_CRITI"
+  "CAL\020\002\022\022\n\016PRIORITY_BATCH\020\0032x\n\013NameService"
+  "\0227\n\014GetEndpoints\022\021.lrpc.ServiceName\032\022.lr"
+  "pc.EndpointList\"\000\0220\n\tKeepalive\022\023.lrpc.Ke"
+  "epaliveInfo\032\014.lrpc.Status\"\000B\003\200\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_lrpc_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_lrpc_2eproto = {
+    false, false, 2040, descriptor_table_protodef_lrpc_2eproto,
+    "lrpc.proto",
+    &descriptor_table_lrpc_2eproto_once, nullptr, 0, 14,
+    schemas, file_default_instances, TableStruct_lrpc_2eproto::offsets,
+    file_level_metadata_lrpc_2eproto, file_level_enum_descriptors_lrpc_2eproto,
+    file_level_service_descriptors_lrpc_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_lrpc_2eproto_getter() {
+  return &descriptor_table_lrpc_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_lrpc_2eproto(&descriptor_table_lrpc_2eproto);
+namespace lrpc {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StreamFrame_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_lrpc_2eproto);
+  return file_level_enum_descriptors_lrpc_2eproto[0];
+}
+bool StreamFrame_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr StreamFrame_Type StreamFrame::OPEN;
+constexpr StreamFrame_Type StreamFrame::DATA;
+constexpr StreamFrame_Type StreamFrame::HALF_CLOSE;
+constexpr StreamFrame_Type StreamFrame::CANCEL;
+constexpr StreamFrame_Type StreamFrame::CREDIT;
+constexpr StreamFrame_Type StreamFrame::Type_MIN;
+constexpr StreamFrame_Type StreamFrame::Type_MAX;
+constexpr int StreamFrame::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PushFrame_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_lrpc_2eproto);
+  return file_level_enum_descriptors_lrpc_2eproto[1];
+}
+bool PushFrame_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PushFrame_Type PushFrame::SUBSCRIBE;
+constexpr PushFrame_Type PushFrame::UNSUBSCRIBE;
+constexpr PushFrame_Type PushFrame::PUBLISH;
+constexpr PushFrame_Type PushFrame::Type_MIN;
+constexpr PushFrame_Type PushFrame::Type_MAX;
+constexpr int PushFrame::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_lrpc_2eproto);
+  return file_level_enum_descriptors_lrpc_2eproto[2];
 }
 bool MessageType_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -360,342 +553,501 @@ bool MessageType_IsValid(int value) {
   }
 }
 
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Priority_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_lrpc_2eproto);
+  return file_level_enum_descriptors_lrpc_2eproto[3];
+}
+bool Priority_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
 
-// ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Request::kIdFieldNumber;
-const int Request::kServiceNameFieldNumber;
-const int Request::kMethodNameFieldNumber;
-const int Request::kSerializedRequestFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+// ===================================================================
 
-Request::Request()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.Request)
-}
+class Request::_Internal {
+ public:
+};
 
-void Request::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.Request)
 }
-
 Request::Request(const Request& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.serialized_request_){}
+    , decltype(_impl_.attachment_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.accept_compress_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.deadline_us_){}
+    , decltype(_impl_.compress_dict_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.oneway_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_service_name().empty()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_method_name().empty()) {
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.serialized_request_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.serialized_request_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_serialized_request().empty()) {
+    _this->_impl_.serialized_request_.Set(from._internal_serialized_request(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.attachment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attachment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_attachment().empty()) {
+    _this->_impl_.attachment_.Set(from._internal_attachment(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.oneway_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.oneway_));
   // @@protoc_insertion_point(copy_constructor:lrpc.Request)
 }
 
-void Request::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  id_ = 0;
-  service_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  method_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  serialized_request_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.serialized_request_){}
+    , decltype(_impl_.attachment_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.accept_compress_){0u}
+    , decltype(_impl_.timeout_ms_){int64_t{0}}
+    , decltype(_impl_.deadline_us_){int64_t{0}}
+    , decltype(_impl_.compress_dict_){0u}
+    , decltype(_impl_.priority_){0}
+    , decltype(_impl_.oneway_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.serialized_request_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.serialized_request_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.attachment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attachment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Request::~Request() {
   // @@protoc_insertion_point(destructor:lrpc.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Request::SharedDtor() {
-  service_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  method_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  serialized_request_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
+  _impl_.serialized_request_.Destroy();
+  _impl_.attachment_.Destroy();
 }
 
 void Request::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Request::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Request_descriptor_;
-}
-
-const Request& Request::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-Request* Request::default_instance_ = NULL;
-
-Request* Request::New(::google::protobuf::Arena* arena) const {
-  Request* n = new Request;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Request::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.Request)
-  id_ = 0;
-  service_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  serialized_request_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool Request::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.Request)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 id = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &id_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  _impl_.serialized_request_.ClearToEmpty();
+  _impl_.attachment_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.oneway_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.oneway_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_service_name;
-        break;
-      }
-
-      // optional string service_name = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_service_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_service_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->service_name().data(), this->service_name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "lrpc.Request.service_name"));
-        } else {
+        continue;
+      // string service_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.Request.service_name"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_method_name;
-        break;
-      }
-
-      // optional string method_name = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_method_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_method_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->method_name().data(), this->method_name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "lrpc.Request.method_name"));
-        } else {
+        continue;
+      // string method_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_method_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.Request.method_name"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_serialized_request;
-        break;
-      }
-
-      // optional bytes serialized_request = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_serialized_request:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_serialized_request()));
-        } else {
+        continue;
+      // bytes serialized_request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_serialized_request();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // int64 timeout_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 deadline_us = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.deadline_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 accept_compress = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.accept_compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compress_dict = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.compress_dict_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.Priority priority = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_priority(static_cast<::lrpc::Priority>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool oneway = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.oneway_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes attachment = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_attachment();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.Request)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.Request)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Request::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.Request)
-  // optional int32 id = 1;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
-  // optional string service_name = 2;
-  if (this->service_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->service_name().data(), this->service_name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string service_name = 2;
+  if (!this->_internal_service_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "lrpc.Request.service_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->service_name(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_service_name(), target);
   }
 
-  // optional string method_name = 3;
-  if (this->method_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->method_name().data(), this->method_name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string method_name = 3;
+  if (!this->_internal_method_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_method_name().data(), static_cast<int>(this->_internal_method_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "lrpc.Request.method_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->method_name(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_method_name(), target);
   }
 
-  // optional bytes serialized_request = 4;
-  if (this->serialized_request().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->serialized_request(), output);
+  // bytes serialized_request = 4;
+  if (!this->_internal_serialized_request().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_serialized_request(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:lrpc.Request)
-}
+  // int64 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_timeout_ms(), target);
+  }
 
-::google::protobuf::uint8* Request::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lrpc.Request)
-  // optional int32 id = 1;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
+  // int64 deadline_us = 6;
+  if (this->_internal_deadline_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_deadline_us(), target);
   }
 
-  // optional string service_name = 2;
-  if (this->service_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->service_name().data(), this->service_name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "lrpc.Request.service_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->service_name(), target);
+  // uint32 accept_compress = 7;
+  if (this->_internal_accept_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_accept_compress(), target);
   }
 
-  // optional string method_name = 3;
-  if (this->method_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->method_name().data(), this->method_name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "lrpc.Request.method_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->method_name(), target);
+  // uint32 compress_dict = 8;
+  if (this->_internal_compress_dict() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_compress_dict(), target);
+  }
+
+  // .lrpc.Priority priority = 9;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_priority(), target);
   }
 
-  // optional bytes serialized_request = 4;
-  if (this->serialized_request().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->serialized_request(), target);
+  // bool oneway = 10;
+  if (this->_internal_oneway() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_oneway(), target);
   }
 
+  // bytes attachment = 11;
+  if (!this->_internal_attachment().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        11, this->_internal_attachment(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.Request)
   return target;
 }
 
-int Request::ByteSize() const {
+size_t Request::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.Request)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int32 id = 1;
-  if (this->id() != 0) {
+  // string service_name = 2;
+  if (!this->_internal_service_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->id());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
   }
 
-  // optional string service_name = 2;
-  if (this->service_name().size() > 0) {
+  // string method_name = 3;
+  if (!this->_internal_method_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->service_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_method_name());
   }
 
-  // optional string method_name = 3;
-  if (this->method_name().size() > 0) {
+  // bytes serialized_request = 4;
+  if (!this->_internal_serialized_request().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->method_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_serialized_request());
   }
 
-  // optional bytes serialized_request = 4;
-  if (this->serialized_request().size() > 0) {
+  // bytes attachment = 11;
+  if (!this->_internal_attachment().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->serialized_request());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_attachment());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Request::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.Request)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
-  const Request* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Request>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.Request)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.Request)
-    MergeFrom(*source);
+
+  // uint32 accept_compress = 7;
+  if (this->_internal_accept_compress() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_accept_compress());
   }
-}
 
-void Request::MergeFrom(const Request& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Request)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  // int64 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timeout_ms());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
+
+  // int64 deadline_us = 6;
+  if (this->_internal_deadline_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_deadline_us());
   }
-  if (from.service_name().size() > 0) {
 
-    service_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.service_name_);
+  // uint32 compress_dict = 8;
+  if (this->_internal_compress_dict() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compress_dict());
   }
-  if (from.method_name().size() > 0) {
 
-    method_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.method_name_);
+  // .lrpc.Priority priority = 9;
+  if (this->_internal_priority() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_priority());
   }
-  if (from.serialized_request().size() > 0) {
 
-    serialized_request_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.serialized_request_);
+  // bool oneway = 10;
+  if (this->_internal_oneway() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Request::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.Request)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
+
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
+  }
+  if (!from._internal_method_name().empty()) {
+    _this->_internal_set_method_name(from._internal_method_name());
+  }
+  if (!from._internal_serialized_request().empty()) {
+    _this->_internal_set_serialized_request(from._internal_serialized_request());
+  }
+  if (!from._internal_attachment().empty()) {
+    _this->_internal_set_attachment(from._internal_attachment());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_accept_compress() != 0) {
+    _this->_internal_set_accept_compress(from._internal_accept_compress());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_deadline_us() != 0) {
+    _this->_internal_set_deadline_us(from._internal_deadline_us());
+  }
+  if (from._internal_compress_dict() != 0) {
+    _this->_internal_set_compress_dict(from._internal_compress_dict());
+  }
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  if (from._internal_oneway() != 0) {
+    _this->_internal_set_oneway(from._internal_oneway());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Request::CopyFrom(const Request& from) {
@@ -706,423 +1058,243 @@ void Request::CopyFrom(const Request& from) {
 }
 
 bool Request::IsInitialized() const {
-
   return true;
 }
 
-void Request::Swap(Request* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Request::InternalSwap(Request* other) {
-  std::swap(id_, other->id_);
-  service_name_.Swap(&other->service_name_);
-  method_name_.Swap(&other->method_name_);
-  serialized_request_.Swap(&other->serialized_request_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Request::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Request_descriptor_;
-  metadata.reflection = Request_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Request
-
-// optional int32 id = 1;
-void Request::clear_id() {
-  id_ = 0;
-}
- ::google::protobuf::int32 Request::id() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.id)
-  return id_;
-}
- void Request::set_id(::google::protobuf::int32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Request.id)
-}
-
-// optional string service_name = 2;
-void Request::clear_service_name() {
-  service_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& Request::service_name() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.service_name)
-  return service_name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Request::set_service_name(const ::std::string& value) {
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Request.service_name)
-}
- void Request::set_service_name(const char* value) {
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Request.service_name)
-}
- void Request::set_service_name(const char* value, size_t size) {
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Request.service_name)
-}
- ::std::string* Request::mutable_service_name() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.Request.service_name)
-  return service_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Request::release_service_name() {
-  // @@protoc_insertion_point(field_release:lrpc.Request.service_name)
-  
-  return service_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Request::set_allocated_service_name(::std::string* service_name) {
-  if (service_name != NULL) {
-    
-  } else {
-    
-  }
-  service_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), service_name);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.service_name)
-}
-
-// optional string method_name = 3;
-void Request::clear_method_name() {
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& Request::method_name() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.method_name)
-  return method_name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Request::set_method_name(const ::std::string& value) {
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Request.method_name)
-}
- void Request::set_method_name(const char* value) {
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Request.method_name)
-}
- void Request::set_method_name(const char* value, size_t size) {
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Request.method_name)
-}
- ::std::string* Request::mutable_method_name() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.Request.method_name)
-  return method_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.serialized_request_, lhs_arena,
+      &other->_impl_.serialized_request_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attachment_, lhs_arena,
+      &other->_impl_.attachment_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.oneway_)
+      + sizeof(Request::_impl_.oneway_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[0]);
 }
- ::std::string* Request::release_method_name() {
-  // @@protoc_insertion_point(field_release:lrpc.Request.method_name)
-  
-  return method_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Request::set_allocated_method_name(::std::string* method_name) {
-  if (method_name != NULL) {
-    
-  } else {
-    
-  }
-  method_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.method_name)
-}
-
-// optional bytes serialized_request = 4;
-void Request::clear_serialized_request() {
-  serialized_request_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& Request::serialized_request() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.serialized_request)
-  return serialized_request_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Request::set_serialized_request(const ::std::string& value) {
-  
-  serialized_request_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Request.serialized_request)
-}
- void Request::set_serialized_request(const char* value) {
-  
-  serialized_request_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Request.serialized_request)
-}
- void Request::set_serialized_request(const void* value, size_t size) {
-  
-  serialized_request_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Request.serialized_request)
-}
- ::std::string* Request::mutable_serialized_request() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.Request.serialized_request)
-  return serialized_request_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Request::release_serialized_request() {
-  // @@protoc_insertion_point(field_release:lrpc.Request.serialized_request)
-  
-  return serialized_request_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Request::set_allocated_serialized_request(::std::string* serialized_request) {
-  if (serialized_request != NULL) {
-    
-  } else {
-    
-  }
-  serialized_request_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), serialized_request);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.serialized_request)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Error::kErrnumFieldNumber;
-const int Error::kMsgFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Error::_Internal {
+ public:
+};
 
-Error::Error()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.Error)
+Error::Error(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.Error)
 }
-
-void Error::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 Error::Error(const Error& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Error* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.errnum_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg().empty()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.errnum_ = from._impl_.errnum_;
   // @@protoc_insertion_point(copy_constructor:lrpc.Error)
 }
 
-void Error::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  errnum_ = 0;
-  msg_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Error::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , decltype(_impl_.errnum_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Error::~Error() {
   // @@protoc_insertion_point(destructor:lrpc.Error)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Error::SharedDtor() {
-  msg_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void Error::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
 }
 
 void Error::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Error::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Error_descriptor_;
-}
-
-const Error& Error::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-Error* Error::default_instance_ = NULL;
-
-Error* Error::New(::google::protobuf::Arena* arena) const {
-  Error* n = new Error;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Error::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.Error)
-  errnum_ = 0;
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool Error::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.Error)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 errnum = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &errnum_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.msg_.ClearToEmpty();
+  _impl_.errnum_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Error::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 errnum = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.errnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_msg;
-        break;
-      }
-
-      // optional string msg = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_msg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "lrpc.Error.msg"));
-        } else {
+        continue;
+      // string msg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.Error.msg"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.Error)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.Error)
-  return false;
-#undef DO_
-}
-
-void Error::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.Error)
-  // optional int32 errnum = 1;
-  if (this->errnum() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->errnum(), output);
-  }
-
-  // optional string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "lrpc.Error.msg");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->msg(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:lrpc.Error)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Error::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* Error::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:lrpc.Error)
-  // optional int32 errnum = 1;
-  if (this->errnum() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->errnum(), target);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 errnum = 1;
+  if (this->_internal_errnum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_errnum(), target);
   }
 
-  // optional string msg = 2;
-  if (this->msg().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  // string msg = 2;
+  if (!this->_internal_msg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "lrpc.Error.msg");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->msg(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.Error)
   return target;
 }
 
-int Error::ByteSize() const {
+size_t Error::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.Error)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional int32 errnum = 1;
-  if (this->errnum() != 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string msg = 2;
+  if (!this->_internal_msg().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->errnum());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg());
   }
 
-  // optional string msg = 2;
-  if (this->msg().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->msg());
+  // int32 errnum = 1;
+  if (this->_internal_errnum() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_errnum());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Error::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.Error)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const Error* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Error>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.Error)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.Error)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Error::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Error::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Error::GetClassData() const { return &_class_data_; }
 
-void Error::MergeFrom(const Error& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Error)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.errnum() != 0) {
-    set_errnum(from.errnum());
-  }
-  if (from.msg().size() > 0) {
 
-    msg_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.msg_);
-  }
-}
+void Error::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Error*>(&to_msg);
+  auto& from = static_cast<const Error&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Error)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Error::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.Error)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_msg().empty()) {
+    _this->_internal_set_msg(from._internal_msg());
+  }
+  if (from._internal_errnum() != 0) {
+    _this->_internal_set_errnum(from._internal_errnum());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Error::CopyFrom(const Error& from) {
@@ -1133,392 +1305,401 @@ void Error::CopyFrom(const Error& from) {
 }
 
 bool Error::IsInitialized() const {
-
   return true;
 }
 
-void Error::Swap(Error* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Error::InternalSwap(Error* other) {
-  std::swap(errnum_, other->errnum_);
-  msg_.Swap(&other->msg_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  swap(_impl_.errnum_, other->_impl_.errnum_);
 }
 
-::google::protobuf::Metadata Error::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Error_descriptor_;
-  metadata.reflection = Error_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Error::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[1]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Error
+// ===================================================================
 
-// optional int32 errnum = 1;
-void Error::clear_errnum() {
-  errnum_ = 0;
-}
- ::google::protobuf::int32 Error::errnum() const {
-  // @@protoc_insertion_point(field_get:lrpc.Error.errnum)
-  return errnum_;
-}
- void Error::set_errnum(::google::protobuf::int32 value) {
-  
-  errnum_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Error.errnum)
-}
+class Response::_Internal {
+ public:
+  static const ::lrpc::Error& error(const Response* msg);
+};
 
-// optional string msg = 2;
-void Error::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& Error::msg() const {
-  // @@protoc_insertion_point(field_get:lrpc.Error.msg)
-  return msg_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Error::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Error.msg)
+const ::lrpc::Error&
+Response::_Internal::error(const Response* msg) {
+  return *msg->_impl_.Body_.error_;
 }
- void Error::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Error.msg)
-}
- void Error::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Error.msg)
-}
- ::std::string* Error::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.Error.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Error::release_msg() {
-  // @@protoc_insertion_point(field_release:lrpc.Error.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Error::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
-  } else {
-    
+void Response::set_allocated_error(::lrpc::Error* error) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (error) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(error);
+    if (message_arena != submessage_arena) {
+      error = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, error, submessage_arena);
+    }
+    set_has_error();
+    _impl_.Body_.error_ = error;
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Error.msg)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Response::kIdFieldNumber;
-const int Response::kSerializedResponseFieldNumber;
-const int Response::kErrorFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Response::Response()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.Response)
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.error)
 }
-
-void Response::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  Response_default_oneof_instance_->serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  Response_default_oneof_instance_->error_ = const_cast< ::lrpc::Error*>(&::lrpc::Error::default_instance());
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.Response)
 }
-
 Response::Response(const Response& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attachment_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.accept_compress_){}
+    , decltype(_impl_.compress_dict_){}
+    , decltype(_impl_.Body_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attachment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attachment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_attachment().empty()) {
+    _this->_impl_.attachment_.Set(from._internal_attachment(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compress_dict_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.compress_dict_));
+  clear_has_Body();
+  switch (from.Body_case()) {
+    case kSerializedResponse: {
+      _this->_internal_set_serialized_response(from._internal_serialized_response());
+      break;
+    }
+    case kError: {
+      _this->_internal_mutable_error()->::lrpc::Error::MergeFrom(
+          from._internal_error());
+      break;
+    }
+    case BODY_NOT_SET: {
+      break;
+    }
+  }
   // @@protoc_insertion_point(copy_constructor:lrpc.Response)
 }
 
-void Response::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  id_ = 0;
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attachment_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.accept_compress_){0u}
+    , decltype(_impl_.compress_dict_){0u}
+    , decltype(_impl_.Body_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.attachment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attachment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_Body();
 }
 
 Response::~Response() {
   // @@protoc_insertion_point(destructor:lrpc.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Response::SharedDtor() {
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attachment_.Destroy();
   if (has_Body()) {
     clear_Body();
   }
-  if (this != default_instance_) {
-  }
 }
 
 void Response::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Response::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Response_descriptor_;
-}
-
-const Response& Response::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-Response* Response::default_instance_ = NULL;
-
-Response* Response::New(::google::protobuf::Arena* arena) const {
-  Response* n = new Response;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Response::clear_Body() {
 // @@protoc_insertion_point(one_of_clear_start:lrpc.Response)
-  switch(Body_case()) {
+  switch (Body_case()) {
     case kSerializedResponse: {
-      Body_.serialized_response_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+      _impl_.Body_.serialized_response_.Destroy();
       break;
     }
     case kError: {
-      delete Body_.error_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.error_;
+      }
       break;
     }
     case BODY_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = BODY_NOT_SET;
+  _impl_._oneof_case_[0] = BODY_NOT_SET;
 }
 
 
 void Response::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.Response)
-  id_ = 0;
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.attachment_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compress_dict_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.compress_dict_));
   clear_Body();
-}
-
-bool Response::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.Response)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 id = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &id_)));
-
-        } else {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_serialized_response;
-        break;
-      }
-
-      // optional bytes serialized_response = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_serialized_response:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_serialized_response()));
-        } else {
+        continue;
+      // bytes serialized_response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_serialized_response();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_error;
-        break;
-      }
-
-      // optional .lrpc.Error error = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_error:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_error()));
-        } else {
+        continue;
+      // .lrpc.Error error = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // uint32 accept_compress = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.accept_compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compress_dict = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.compress_dict_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes attachment = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_attachment();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.Response)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.Response)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Response::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.Response)
-  // optional int32 id = 1;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->id(), output);
-  }
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional bytes serialized_response = 2;
-  if (has_serialized_response()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->serialized_response(), output);
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
-  // optional .lrpc.Error error = 3;
-  if (has_error()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *Body_.error_, output);
+  // bytes serialized_response = 2;
+  if (_internal_has_serialized_response()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_serialized_response(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:lrpc.Response)
-}
+  // .lrpc.Error error = 3;
+  if (_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
 
-::google::protobuf::uint8* Response::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lrpc.Response)
-  // optional int32 id = 1;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
+  // uint32 accept_compress = 4;
+  if (this->_internal_accept_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_accept_compress(), target);
   }
 
-  // optional bytes serialized_response = 2;
-  if (has_serialized_response()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->serialized_response(), target);
+  // uint32 compress_dict = 5;
+  if (this->_internal_compress_dict() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_compress_dict(), target);
   }
 
-  // optional .lrpc.Error error = 3;
-  if (has_error()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *Body_.error_, false, target);
+  // bytes attachment = 6;
+  if (!this->_internal_attachment().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_attachment(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.Response)
   return target;
 }
 
-int Response::ByteSize() const {
+size_t Response::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.Response)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int32 id = 1;
-  if (this->id() != 0) {
+  // bytes attachment = 6;
+  if (!this->_internal_attachment().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->id());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_attachment());
+  }
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // uint32 accept_compress = 4;
+  if (this->_internal_accept_compress() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_accept_compress());
+  }
+
+  // uint32 compress_dict = 5;
+  if (this->_internal_compress_dict() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compress_dict());
   }
 
   switch (Body_case()) {
-    // optional bytes serialized_response = 2;
+    // bytes serialized_response = 2;
     case kSerializedResponse: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->serialized_response());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_serialized_response());
       break;
     }
-    // optional .lrpc.Error error = 3;
+    // .lrpc.Error error = 3;
     case kError: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *Body_.error_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.error_);
       break;
     }
     case BODY_NOT_SET: {
       break;
     }
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Response::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.Response)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
+
+
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_attachment().empty()) {
+    _this->_internal_set_attachment(from._internal_attachment());
   }
-  const Response* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Response>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.Response)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.Response)
-    MergeFrom(*source);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
-}
-
-void Response::MergeFrom(const Response& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Response)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  if (from._internal_accept_compress() != 0) {
+    _this->_internal_set_accept_compress(from._internal_accept_compress());
+  }
+  if (from._internal_compress_dict() != 0) {
+    _this->_internal_set_compress_dict(from._internal_compress_dict());
   }
   switch (from.Body_case()) {
     case kSerializedResponse: {
-      set_serialized_response(from.serialized_response());
+      _this->_internal_set_serialized_response(from._internal_serialized_response());
       break;
     }
     case kError: {
-      mutable_error()->::lrpc::Error::MergeFrom(from.error());
+      _this->_internal_mutable_error()->::lrpc::Error::MergeFrom(
+          from._internal_error());
       break;
     }
     case BODY_NOT_SET: {
       break;
     }
   }
-  if (from.id() != 0) {
-    set_id(from.id());
-  }
-}
-
-void Response::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.Response)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Response::CopyFrom(const Response& from) {
@@ -1529,448 +1710,2069 @@ void Response::CopyFrom(const Response& from) {
 }
 
 bool Response::IsInitialized() const {
-
   return true;
 }
 
-void Response::Swap(Response* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Response::InternalSwap(Response* other) {
-  std::swap(id_, other->id_);
-  std::swap(Body_, other->Body_);
-  std::swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attachment_, lhs_arena,
+      &other->_impl_.attachment_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.compress_dict_)
+      + sizeof(Response::_impl_.compress_dict_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+  swap(_impl_.Body_, other->_impl_.Body_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[2]);
 }
 
-::google::protobuf::Metadata Response::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_descriptor_;
-  metadata.reflection = Response_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Response
+// ===================================================================
 
-// optional int32 id = 1;
-void Response::clear_id() {
-  id_ = 0;
-}
- ::google::protobuf::int32 Response::id() const {
-  // @@protoc_insertion_point(field_get:lrpc.Response.id)
-  return id_;
+class StreamFrame::_Internal {
+ public:
+  static const ::lrpc::Error& error(const StreamFrame* msg);
+};
+
+const ::lrpc::Error&
+StreamFrame::_Internal::error(const StreamFrame* msg) {
+  return *msg->_impl_.error_;
+}
+StreamFrame::StreamFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.StreamFrame)
+}
+StreamFrame::StreamFrame(const StreamFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StreamFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.credit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_service_name().empty()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_method_name().empty()) {
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_payload().empty()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::lrpc::Error(*from._impl_.error_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.credit_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.credit_));
+  // @@protoc_insertion_point(copy_constructor:lrpc.StreamFrame)
+}
+
+inline void StreamFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.credit_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StreamFrame::~StreamFrame() {
+  // @@protoc_insertion_point(destructor:lrpc.StreamFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- void Response::set_id(::google::protobuf::int32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Response.id)
+
+inline void StreamFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
+  _impl_.payload_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.error_;
+}
+
+void StreamFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StreamFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:lrpc.StreamFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  _impl_.payload_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.credit_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.credit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StreamFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.StreamFrame.Type type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::lrpc::StreamFrame_Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string service_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.StreamFrame.service_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string method_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_method_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.StreamFrame.method_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes payload = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 credit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.credit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.Error error = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-// optional bytes serialized_response = 2;
-bool Response::has_serialized_response() const {
-  return Body_case() == kSerializedResponse;
+uint8_t* StreamFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.StreamFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // .lrpc.StreamFrame.Type type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // string service_name = 3;
+  if (!this->_internal_service_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lrpc.StreamFrame.service_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_service_name(), target);
+  }
+
+  // string method_name = 4;
+  if (!this->_internal_method_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_method_name().data(), static_cast<int>(this->_internal_method_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lrpc.StreamFrame.method_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_method_name(), target);
+  }
+
+  // bytes payload = 5;
+  if (!this->_internal_payload().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_payload(), target);
+  }
+
+  // uint32 credit = 6;
+  if (this->_internal_credit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_credit(), target);
+  }
+
+  // .lrpc.Error error = 7;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lrpc.StreamFrame)
+  return target;
 }
-void Response::set_has_serialized_response() {
-  _oneof_case_[0] = kSerializedResponse;
+
+size_t StreamFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lrpc.StreamFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string service_name = 3;
+  if (!this->_internal_service_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+  }
+
+  // string method_name = 4;
+  if (!this->_internal_method_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_method_name());
+  }
+
+  // bytes payload = 5;
+  if (!this->_internal_payload().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+  }
+
+  // .lrpc.Error error = 7;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
+  }
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // .lrpc.StreamFrame.Type type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // uint32 credit = 6;
+  if (this->_internal_credit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_credit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-void Response::clear_serialized_response() {
-  if (has_serialized_response()) {
-    Body_.serialized_response_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    clear_has_Body();
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StreamFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StreamFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StreamFrame::GetClassData() const { return &_class_data_; }
+
+
+void StreamFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StreamFrame*>(&to_msg);
+  auto& from = static_cast<const StreamFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.StreamFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
   }
+  if (!from._internal_method_name().empty()) {
+    _this->_internal_set_method_name(from._internal_method_name());
+  }
+  if (!from._internal_payload().empty()) {
+    _this->_internal_set_payload(from._internal_payload());
+  }
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::lrpc::Error::MergeFrom(
+        from._internal_error());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_credit() != 0) {
+    _this->_internal_set_credit(from._internal_credit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StreamFrame::CopyFrom(const StreamFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lrpc.StreamFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StreamFrame::IsInitialized() const {
+  return true;
 }
- const ::std::string& Response::serialized_response() const {
-  // @@protoc_insertion_point(field_get:lrpc.Response.serialized_response)
-  if (has_serialized_response()) {
-    return Body_.serialized_response_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+void StreamFrame::InternalSwap(StreamFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StreamFrame, _impl_.credit_)
+      + sizeof(StreamFrame::_impl_.credit_)
+      - PROTOBUF_FIELD_OFFSET(StreamFrame, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StreamFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[3]);
+}
+
+// ===================================================================
+
+class PushFrame::_Internal {
+ public:
+};
+
+PushFrame::PushFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.PushFrame)
+}
+PushFrame::PushFrame(const PushFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PushFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.topic_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_service_name().empty()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_topic().empty()) {
+    _this->_impl_.topic_.Set(from._internal_topic(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_payload().empty()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:lrpc.PushFrame)
+}
+
+inline void PushFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.topic_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PushFrame::~PushFrame() {
+  // @@protoc_insertion_point(destructor:lrpc.PushFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  SharedDtor();
 }
- void Response::set_serialized_response(const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:lrpc.Response.serialized_response)
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+inline void PushFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.topic_.Destroy();
+  _impl_.payload_.Destroy();
+}
+
+void PushFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PushFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:lrpc.PushFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.topic_.ClearToEmpty();
+  _impl_.payload_.ClearToEmpty();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PushFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .lrpc.PushFrame.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::lrpc::PushFrame_Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string service_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.PushFrame.service_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string topic = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_topic();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.PushFrame.topic"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes payload = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PushFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.PushFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .lrpc.PushFrame.Type type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // string service_name = 2;
+  if (!this->_internal_service_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lrpc.PushFrame.service_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_service_name(), target);
+  }
+
+  // string topic = 3;
+  if (!this->_internal_topic().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_topic().data(), static_cast<int>(this->_internal_topic().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lrpc.PushFrame.topic");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_topic(), target);
+  }
+
+  // bytes payload = 4;
+  if (!this->_internal_payload().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_payload(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  Body_.serialized_response_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Response.serialized_response)
+  // @@protoc_insertion_point(serialize_to_array_end:lrpc.PushFrame)
+  return target;
 }
- void Response::set_serialized_response(const char* value) {
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+size_t PushFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lrpc.PushFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string service_name = 2;
+  if (!this->_internal_service_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+  }
+
+  // string topic = 3;
+  if (!this->_internal_topic().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_topic());
+  }
+
+  // bytes payload = 4;
+  if (!this->_internal_payload().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+  }
+
+  // .lrpc.PushFrame.Type type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PushFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PushFrame::GetClassData() const { return &_class_data_; }
+
+
+void PushFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PushFrame*>(&to_msg);
+  auto& from = static_cast<const PushFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.PushFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
+  }
+  if (!from._internal_topic().empty()) {
+    _this->_internal_set_topic(from._internal_topic());
+  }
+  if (!from._internal_payload().empty()) {
+    _this->_internal_set_payload(from._internal_payload());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PushFrame::CopyFrom(const PushFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lrpc.PushFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PushFrame::IsInitialized() const {
+  return true;
+}
+
+void PushFrame::InternalSwap(PushFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.topic_, lhs_arena,
+      &other->_impl_.topic_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PushFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[4]);
+}
+
+// ===================================================================
+
+class ChunkFrame::_Internal {
+ public:
+};
+
+ChunkFrame::ChunkFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.ChunkFrame)
+}
+ChunkFrame::ChunkFrame(const ChunkFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChunkFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.total_len_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.total_len_, &from._impl_.total_len_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.total_len_)) + sizeof(_impl_.id_));
+  // @@protoc_insertion_point(copy_constructor:lrpc.ChunkFrame)
+}
+
+inline void ChunkFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.total_len_){uint64_t{0u}}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChunkFrame::~ChunkFrame() {
+  // @@protoc_insertion_point(destructor:lrpc.ChunkFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChunkFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void ChunkFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChunkFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:lrpc.ChunkFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.total_len_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.id_) -
+      reinterpret_cast<char*>(&_impl_.total_len_)) + sizeof(_impl_.id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChunkFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_len = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChunkFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.ChunkFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // uint64 total_len = 2;
+  if (this->_internal_total_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_total_len(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lrpc.ChunkFrame)
+  return target;
+}
+
+size_t ChunkFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lrpc.ChunkFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // uint64 total_len = 2;
+  if (this->_internal_total_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_len());
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChunkFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChunkFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChunkFrame::GetClassData() const { return &_class_data_; }
+
+
+void ChunkFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChunkFrame*>(&to_msg);
+  auto& from = static_cast<const ChunkFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.ChunkFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_total_len() != 0) {
+    _this->_internal_set_total_len(from._internal_total_len());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChunkFrame::CopyFrom(const ChunkFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lrpc.ChunkFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChunkFrame::IsInitialized() const {
+  return true;
+}
+
+void ChunkFrame::InternalSwap(ChunkFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChunkFrame, _impl_.id_)
+      + sizeof(ChunkFrame::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(ChunkFrame, _impl_.total_len_)>(
+          reinterpret_cast<char*>(&_impl_.total_len_),
+          reinterpret_cast<char*>(&other->_impl_.total_len_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChunkFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[5]);
+}
+
+// ===================================================================
+
+class BatchRequest::_Internal {
+ public:
+  static const ::lrpc::Request& header(const BatchRequest* msg);
+};
+
+const ::lrpc::Request&
+BatchRequest::_Internal::header(const BatchRequest* msg) {
+  return *msg->_impl_.header_;
+}
+BatchRequest::BatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.BatchRequest)
+}
+BatchRequest::BatchRequest(const BatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){from._impl_.requests_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::lrpc::Request(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:lrpc.BatchRequest)
+}
+
+inline void BatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchRequest::~BatchRequest() {
+  // @@protoc_insertion_point(destructor:lrpc.BatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.requests_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void BatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:lrpc.BatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.requests_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .lrpc.Request header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes requests = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_requests();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.BatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .lrpc.Request header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated bytes requests = 2;
+  for (int i = 0, n = this->_internal_requests_size(); i < n; i++) {
+    const auto& s = this->_internal_requests(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lrpc.BatchRequest)
+  return target;
+}
+
+size_t BatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lrpc.BatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes requests = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.requests_.size());
+  for (int i = 0, n = _impl_.requests_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.requests_.Get(i));
+  }
+
+  // .lrpc.Request header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void BatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchRequest*>(&to_msg);
+  auto& from = static_cast<const BatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.BatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::lrpc::Request::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchRequest::CopyFrom(const BatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lrpc.BatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRequest::IsInitialized() const {
+  return true;
+}
+
+void BatchRequest::InternalSwap(BatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[6]);
+}
+
+// ===================================================================
+
+class BatchResponse::_Internal {
+ public:
+  static const ::lrpc::Response& header(const BatchResponse* msg);
+};
+
+const ::lrpc::Response&
+BatchResponse::_Internal::header(const BatchResponse* msg) {
+  return *msg->_impl_.header_;
+}
+BatchResponse::BatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.BatchResponse)
+}
+BatchResponse::BatchResponse(const BatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){from._impl_.responses_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::lrpc::Response(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:lrpc.BatchResponse)
+}
+
+inline void BatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchResponse::~BatchResponse() {
+  // @@protoc_insertion_point(destructor:lrpc.BatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.responses_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void BatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:lrpc.BatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.responses_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .lrpc.Response header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .lrpc.Response responses = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.BatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .lrpc.Response header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .lrpc.Response responses = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_responses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_responses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  Body_.serialized_response_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Response.serialized_response)
+  // @@protoc_insertion_point(serialize_to_array_end:lrpc.BatchResponse)
+  return target;
 }
- void Response::set_serialized_response(const void* value, size_t size) {
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+size_t BatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lrpc.BatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .lrpc.Response responses = 2;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->_impl_.responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  Body_.serialized_response_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Response.serialized_response)
-}
- ::std::string* Response::mutable_serialized_response() {
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+  // .lrpc.Response header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.Response.serialized_response)
-  return Body_.serialized_response_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
- ::std::string* Response::release_serialized_response() {
-  // @@protoc_insertion_point(field_release:lrpc.Response.serialized_response)
-  if (has_serialized_response()) {
-    clear_has_Body();
-    return Body_.serialized_response_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  } else {
-    return NULL;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void BatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchResponse*>(&to_msg);
+  auto& from = static_cast<const BatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.BatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.responses_.MergeFrom(from._impl_.responses_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::lrpc::Response::MergeFrom(
+        from._internal_header());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
- void Response::set_allocated_serialized_response(::std::string* serialized_response) {
-  if (!has_serialized_response()) {
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_Body();
-  if (serialized_response != NULL) {
-    set_has_serialized_response();
-    Body_.serialized_response_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        serialized_response);
-  }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.serialized_response)
+
+void BatchResponse::CopyFrom(const BatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lrpc.BatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-// optional .lrpc.Error error = 3;
-bool Response::has_error() const {
-  return Body_case() == kError;
+bool BatchResponse::IsInitialized() const {
+  return true;
 }
-void Response::set_has_error() {
-  _oneof_case_[0] = kError;
+
+void BatchResponse::InternalSwap(BatchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.responses_.InternalSwap(&other->_impl_.responses_);
+  swap(_impl_.header_, other->_impl_.header_);
 }
-void Response::clear_error() {
-  if (has_error()) {
-    delete Body_.error_;
-    clear_has_Body();
-  }
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[7]);
 }
- const ::lrpc::Error& Response::error() const {
-  // @@protoc_insertion_point(field_get:lrpc.Response.error)
-  return has_error()
-      ? *Body_.error_
-      : ::lrpc::Error::default_instance();
+
+// ===================================================================
+
+class RpcMessage::_Internal {
+ public:
+  static const ::lrpc::Request& request(const RpcMessage* msg);
+  static const ::lrpc::Response& response(const RpcMessage* msg);
+  static const ::lrpc::StreamFrame& stream(const RpcMessage* msg);
+  static const ::lrpc::PushFrame& push(const RpcMessage* msg);
+  static const ::lrpc::ChunkFrame& chunk(const RpcMessage* msg);
+  static const ::lrpc::BatchRequest& batch_request(const RpcMessage* msg);
+  static const ::lrpc::BatchResponse& batch_response(const RpcMessage* msg);
+};
+
+const ::lrpc::Request&
+RpcMessage::_Internal::request(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.request_;
+}
+const ::lrpc::Response&
+RpcMessage::_Internal::response(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.response_;
+}
+const ::lrpc::StreamFrame&
+RpcMessage::_Internal::stream(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.stream_;
+}
+const ::lrpc::PushFrame&
+RpcMessage::_Internal::push(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.push_;
+}
+const ::lrpc::ChunkFrame&
+RpcMessage::_Internal::chunk(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.chunk_;
+}
+const ::lrpc::BatchRequest&
+RpcMessage::_Internal::batch_request(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.batch_request_;
+}
+const ::lrpc::BatchResponse&
+RpcMessage::_Internal::batch_response(const RpcMessage* msg) {
+  return *msg->_impl_.Body_.batch_response_;
 }
-::lrpc::Error* Response::mutable_error() {
-  if (!has_error()) {
-    clear_Body();
-    set_has_error();
-    Body_.error_ = new ::lrpc::Error;
+void RpcMessage::set_allocated_request(::lrpc::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    set_has_request();
+    _impl_.Body_.request_ = request;
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.Response.error)
-  return Body_.error_;
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.request)
 }
-::lrpc::Error* Response::release_error() {
-  // @@protoc_insertion_point(field_release:lrpc.Response.error)
-  if (has_error()) {
-    clear_has_Body();
-    ::lrpc::Error* temp = Body_.error_;
-    Body_.error_ = NULL;
-    return temp;
-  } else {
-    return NULL;
+void RpcMessage::set_allocated_response(::lrpc::Response* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    set_has_response();
+    _impl_.Body_.response_ = response;
   }
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.response)
 }
-void Response::set_allocated_error(::lrpc::Error* error) {
+void RpcMessage::set_allocated_stream(::lrpc::StreamFrame* stream) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_Body();
-  if (error) {
-    set_has_error();
-    Body_.error_ = error;
+  if (stream) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stream);
+    if (message_arena != submessage_arena) {
+      stream = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stream, submessage_arena);
+    }
+    set_has_stream();
+    _impl_.Body_.stream_ = stream;
   }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.error)
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.stream)
 }
-
-bool Response::has_Body() const {
-  return Body_case() != BODY_NOT_SET;
+void RpcMessage::set_allocated_push(::lrpc::PushFrame* push) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (push) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(push);
+    if (message_arena != submessage_arena) {
+      push = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, push, submessage_arena);
+    }
+    set_has_push();
+    _impl_.Body_.push_ = push;
+  }
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.push)
 }
-void Response::clear_has_Body() {
-  _oneof_case_[0] = BODY_NOT_SET;
+void RpcMessage::set_allocated_chunk(::lrpc::ChunkFrame* chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chunk);
+    if (message_arena != submessage_arena) {
+      chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chunk, submessage_arena);
+    }
+    set_has_chunk();
+    _impl_.Body_.chunk_ = chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.chunk)
 }
-Response::BodyCase Response::Body_case() const {
-  return Response::BodyCase(_oneof_case_[0]);
+void RpcMessage::set_allocated_batch_request(::lrpc::BatchRequest* batch_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (batch_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch_request);
+    if (message_arena != submessage_arena) {
+      batch_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch_request, submessage_arena);
+    }
+    set_has_batch_request();
+    _impl_.Body_.batch_request_ = batch_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.batch_request)
 }
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RpcMessage::kRequestFieldNumber;
-const int RpcMessage::kResponseFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RpcMessage::RpcMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.RpcMessage)
+void RpcMessage::set_allocated_batch_response(::lrpc::BatchResponse* batch_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_Body();
+  if (batch_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch_response);
+    if (message_arena != submessage_arena) {
+      batch_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch_response, submessage_arena);
+    }
+    set_has_batch_response();
+    _impl_.Body_.batch_response_ = batch_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.batch_response)
 }
-
-void RpcMessage::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  RpcMessage_default_oneof_instance_->request_ = const_cast< ::lrpc::Request*>(&::lrpc::Request::default_instance());
-  RpcMessage_default_oneof_instance_->response_ = const_cast< ::lrpc::Response*>(&::lrpc::Response::default_instance());
+RpcMessage::RpcMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.RpcMessage)
 }
-
 RpcMessage::RpcMessage(const RpcMessage& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.Body_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_Body();
+  switch (from.Body_case()) {
+    case kRequest: {
+      _this->_internal_mutable_request()->::lrpc::Request::MergeFrom(
+          from._internal_request());
+      break;
+    }
+    case kResponse: {
+      _this->_internal_mutable_response()->::lrpc::Response::MergeFrom(
+          from._internal_response());
+      break;
+    }
+    case kStream: {
+      _this->_internal_mutable_stream()->::lrpc::StreamFrame::MergeFrom(
+          from._internal_stream());
+      break;
+    }
+    case kPush: {
+      _this->_internal_mutable_push()->::lrpc::PushFrame::MergeFrom(
+          from._internal_push());
+      break;
+    }
+    case kChunk: {
+      _this->_internal_mutable_chunk()->::lrpc::ChunkFrame::MergeFrom(
+          from._internal_chunk());
+      break;
+    }
+    case kBatchRequest: {
+      _this->_internal_mutable_batch_request()->::lrpc::BatchRequest::MergeFrom(
+          from._internal_batch_request());
+      break;
+    }
+    case kBatchResponse: {
+      _this->_internal_mutable_batch_response()->::lrpc::BatchResponse::MergeFrom(
+          from._internal_batch_response());
+      break;
+    }
+    case BODY_NOT_SET: {
+      break;
+    }
+  }
   // @@protoc_insertion_point(copy_constructor:lrpc.RpcMessage)
 }
 
-void RpcMessage::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
+inline void RpcMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.Body_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_Body();
 }
 
 RpcMessage::~RpcMessage() {
   // @@protoc_insertion_point(destructor:lrpc.RpcMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RpcMessage::SharedDtor() {
+inline void RpcMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_Body()) {
     clear_Body();
   }
-  if (this != default_instance_) {
-  }
 }
 
 void RpcMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* RpcMessage::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return RpcMessage_descriptor_;
-}
-
-const RpcMessage& RpcMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-RpcMessage* RpcMessage::default_instance_ = NULL;
-
-RpcMessage* RpcMessage::New(::google::protobuf::Arena* arena) const {
-  RpcMessage* n = new RpcMessage;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void RpcMessage::clear_Body() {
 // @@protoc_insertion_point(one_of_clear_start:lrpc.RpcMessage)
-  switch(Body_case()) {
+  switch (Body_case()) {
     case kRequest: {
-      delete Body_.request_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.request_;
+      }
       break;
     }
     case kResponse: {
-      delete Body_.response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.response_;
+      }
+      break;
+    }
+    case kStream: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.stream_;
+      }
+      break;
+    }
+    case kPush: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.push_;
+      }
+      break;
+    }
+    case kChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.chunk_;
+      }
+      break;
+    }
+    case kBatchRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.batch_request_;
+      }
+      break;
+    }
+    case kBatchResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.Body_.batch_response_;
+      }
       break;
     }
     case BODY_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = BODY_NOT_SET;
+  _impl_._oneof_case_[0] = BODY_NOT_SET;
 }
 
 
 void RpcMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.RpcMessage)
-  clear_Body();
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool RpcMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.RpcMessage)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .lrpc.Request request = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_request()));
-        } else {
+  clear_Body();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .lrpc.Request request = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_response;
-        break;
-      }
-
-      // optional .lrpc.Response response = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_response:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_response()));
-        } else {
+        continue;
+      // .lrpc.Response response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // .lrpc.StreamFrame stream = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stream(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.PushFrame push = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_push(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.ChunkFrame chunk = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.BatchRequest batch_request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .lrpc.BatchResponse batch_response = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.RpcMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.RpcMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void RpcMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.RpcMessage)
-  // optional .lrpc.Request request = 1;
-  if (has_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *Body_.request_, output);
+uint8_t* RpcMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lrpc.RpcMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .lrpc.Request request = 1;
+  if (_internal_has_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
   }
 
-  // optional .lrpc.Response response = 2;
-  if (has_response()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *Body_.response_, output);
+  // .lrpc.Response response = 2;
+  if (_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
   }
 
-  // @@protoc_insertion_point(serialize_end:lrpc.RpcMessage)
-}
+  // .lrpc.StreamFrame stream = 3;
+  if (_internal_has_stream()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::stream(this),
+        _Internal::stream(this).GetCachedSize(), target, stream);
+  }
 
-::google::protobuf::uint8* RpcMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lrpc.RpcMessage)
-  // optional .lrpc.Request request = 1;
-  if (has_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, *Body_.request_, false, target);
+  // .lrpc.PushFrame push = 4;
+  if (_internal_has_push()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::push(this),
+        _Internal::push(this).GetCachedSize(), target, stream);
+  }
+
+  // .lrpc.ChunkFrame chunk = 5;
+  if (_internal_has_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::chunk(this),
+        _Internal::chunk(this).GetCachedSize(), target, stream);
   }
 
-  // optional .lrpc.Response response = 2;
-  if (has_response()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *Body_.response_, false, target);
+  // .lrpc.BatchRequest batch_request = 6;
+  if (_internal_has_batch_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::batch_request(this),
+        _Internal::batch_request(this).GetCachedSize(), target, stream);
   }
 
+  // .lrpc.BatchResponse batch_response = 7;
+  if (_internal_has_batch_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::batch_response(this),
+        _Internal::batch_response(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.RpcMessage)
   return target;
 }
 
-int RpcMessage::ByteSize() const {
+size_t RpcMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.RpcMessage)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   switch (Body_case()) {
-    // optional .lrpc.Request request = 1;
+    // .lrpc.Request request = 1;
     case kRequest: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *Body_.request_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.request_);
       break;
     }
-    // optional .lrpc.Response response = 2;
+    // .lrpc.Response response = 2;
     case kResponse: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *Body_.response_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.response_);
+      break;
+    }
+    // .lrpc.StreamFrame stream = 3;
+    case kStream: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.stream_);
+      break;
+    }
+    // .lrpc.PushFrame push = 4;
+    case kPush: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.push_);
+      break;
+    }
+    // .lrpc.ChunkFrame chunk = 5;
+    case kChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.chunk_);
+      break;
+    }
+    // .lrpc.BatchRequest batch_request = 6;
+    case kBatchRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.batch_request_);
+      break;
+    }
+    // .lrpc.BatchResponse batch_response = 7;
+    case kBatchResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.Body_.batch_response_);
       break;
     }
     case BODY_NOT_SET: {
       break;
     }
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RpcMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.RpcMessage)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const RpcMessage* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const RpcMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.RpcMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.RpcMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcMessage::GetClassData() const { return &_class_data_; }
+
+
+void RpcMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcMessage*>(&to_msg);
+  auto& from = static_cast<const RpcMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.RpcMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void RpcMessage::MergeFrom(const RpcMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.RpcMessage)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
   switch (from.Body_case()) {
     case kRequest: {
-      mutable_request()->::lrpc::Request::MergeFrom(from.request());
+      _this->_internal_mutable_request()->::lrpc::Request::MergeFrom(
+          from._internal_request());
       break;
     }
     case kResponse: {
-      mutable_response()->::lrpc::Response::MergeFrom(from.response());
+      _this->_internal_mutable_response()->::lrpc::Response::MergeFrom(
+          from._internal_response());
+      break;
+    }
+    case kStream: {
+      _this->_internal_mutable_stream()->::lrpc::StreamFrame::MergeFrom(
+          from._internal_stream());
+      break;
+    }
+    case kPush: {
+      _this->_internal_mutable_push()->::lrpc::PushFrame::MergeFrom(
+          from._internal_push());
+      break;
+    }
+    case kChunk: {
+      _this->_internal_mutable_chunk()->::lrpc::ChunkFrame::MergeFrom(
+          from._internal_chunk());
+      break;
+    }
+    case kBatchRequest: {
+      _this->_internal_mutable_batch_request()->::lrpc::BatchRequest::MergeFrom(
+          from._internal_batch_request());
+      break;
+    }
+    case kBatchResponse: {
+      _this->_internal_mutable_batch_response()->::lrpc::BatchResponse::MergeFrom(
+          from._internal_batch_response());
       break;
     }
     case BODY_NOT_SET: {
       break;
     }
   }
-}
-
-void RpcMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.RpcMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RpcMessage::CopyFrom(const RpcMessage& from) {
@@ -1981,380 +3783,249 @@ void RpcMessage::CopyFrom(const RpcMessage& from) {
 }
 
 bool RpcMessage::IsInitialized() const {
-
   return true;
 }
 
-void RpcMessage::Swap(RpcMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RpcMessage::InternalSwap(RpcMessage* other) {
-  std::swap(Body_, other->Body_);
-  std::swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata RpcMessage::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = RpcMessage_descriptor_;
-  metadata.reflection = RpcMessage_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// RpcMessage
-
-// optional .lrpc.Request request = 1;
-bool RpcMessage::has_request() const {
-  return Body_case() == kRequest;
-}
-void RpcMessage::set_has_request() {
-  _oneof_case_[0] = kRequest;
-}
-void RpcMessage::clear_request() {
-  if (has_request()) {
-    delete Body_.request_;
-    clear_has_Body();
-  }
-}
- const ::lrpc::Request& RpcMessage::request() const {
-  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.request)
-  return has_request()
-      ? *Body_.request_
-      : ::lrpc::Request::default_instance();
-}
-::lrpc::Request* RpcMessage::mutable_request() {
-  if (!has_request()) {
-    clear_Body();
-    set_has_request();
-    Body_.request_ = new ::lrpc::Request;
-  }
-  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.request)
-  return Body_.request_;
-}
-::lrpc::Request* RpcMessage::release_request() {
-  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.request)
-  if (has_request()) {
-    clear_has_Body();
-    ::lrpc::Request* temp = Body_.request_;
-    Body_.request_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
-}
-void RpcMessage::set_allocated_request(::lrpc::Request* request) {
-  clear_Body();
-  if (request) {
-    set_has_request();
-    Body_.request_ = request;
-  }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.request)
-}
-
-// optional .lrpc.Response response = 2;
-bool RpcMessage::has_response() const {
-  return Body_case() == kResponse;
-}
-void RpcMessage::set_has_response() {
-  _oneof_case_[0] = kResponse;
-}
-void RpcMessage::clear_response() {
-  if (has_response()) {
-    delete Body_.response_;
-    clear_has_Body();
-  }
-}
- const ::lrpc::Response& RpcMessage::response() const {
-  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.response)
-  return has_response()
-      ? *Body_.response_
-      : ::lrpc::Response::default_instance();
-}
-::lrpc::Response* RpcMessage::mutable_response() {
-  if (!has_response()) {
-    clear_Body();
-    set_has_response();
-    Body_.response_ = new ::lrpc::Response;
-  }
-  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.response)
-  return Body_.response_;
-}
-::lrpc::Response* RpcMessage::release_response() {
-  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.response)
-  if (has_response()) {
-    clear_has_Body();
-    ::lrpc::Response* temp = Body_.response_;
-    Body_.response_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
-}
-void RpcMessage::set_allocated_response(::lrpc::Response* response) {
-  clear_Body();
-  if (response) {
-    set_has_response();
-    Body_.response_ = response;
-  }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.response)
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.Body_, other->_impl_.Body_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-bool RpcMessage::has_Body() const {
-  return Body_case() != BODY_NOT_SET;
-}
-void RpcMessage::clear_has_Body() {
-  _oneof_case_[0] = BODY_NOT_SET;
+::PROTOBUF_NAMESPACE_ID::Metadata RpcMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[8]);
 }
-RpcMessage::BodyCase RpcMessage::Body_case() const {
-  return RpcMessage::BodyCase(_oneof_case_[0]);
-}
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Endpoint::kIpFieldNumber;
-const int Endpoint::kPortFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Endpoint::Endpoint()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.Endpoint)
-}
+class Endpoint::_Internal {
+ public:
+};
 
-void Endpoint::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+Endpoint::Endpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.Endpoint)
 }
-
 Endpoint::Endpoint(const Endpoint& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Endpoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){}
+    , decltype(_impl_.weight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.port_, &from._impl_.port_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.weight_) -
+    reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.weight_));
   // @@protoc_insertion_point(copy_constructor:lrpc.Endpoint)
 }
 
-void Endpoint::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  port_ = 0;
+inline void Endpoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){0}
+    , decltype(_impl_.weight_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Endpoint::~Endpoint() {
   // @@protoc_insertion_point(destructor:lrpc.Endpoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Endpoint::SharedDtor() {
-  ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void Endpoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
 void Endpoint::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Endpoint::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Endpoint_descriptor_;
-}
-
-const Endpoint& Endpoint::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-Endpoint* Endpoint::default_instance_ = NULL;
-
-Endpoint* Endpoint::New(::google::protobuf::Arena* arena) const {
-  Endpoint* n = new Endpoint;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Endpoint::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.Endpoint)
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  port_ = 0;
-}
-
-bool Endpoint::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.Endpoint)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string ip = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_ip()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->ip().data(), this->ip().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "lrpc.Endpoint.ip"));
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ip_.ClearToEmpty();
+  ::memset(&_impl_.port_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.weight_) -
+      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.weight_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Endpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.Endpoint.ip"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_port;
-        break;
-      }
-
-      // optional int32 port = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-
-        } else {
+        continue;
+      // int32 port = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // int32 weight = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.Endpoint)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.Endpoint)
-  return false;
-#undef DO_
-}
-
-void Endpoint::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.Endpoint)
-  // optional string ip = 1;
-  if (this->ip().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->ip().data(), this->ip().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "lrpc.Endpoint.ip");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->ip(), output);
-  }
-
-  // optional int32 port = 2;
-  if (this->port() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->port(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:lrpc.Endpoint)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Endpoint::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* Endpoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:lrpc.Endpoint)
-  // optional string ip = 1;
-  if (this->ip().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->ip().data(), this->ip().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string ip = 1;
+  if (!this->_internal_ip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "lrpc.Endpoint.ip");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->ip(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_ip(), target);
+  }
+
+  // int32 port = 2;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_port(), target);
   }
 
-  // optional int32 port = 2;
-  if (this->port() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->port(), target);
+  // int32 weight = 3;
+  if (this->_internal_weight() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_weight(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.Endpoint)
   return target;
 }
 
-int Endpoint::ByteSize() const {
+size_t Endpoint::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.Endpoint)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional string ip = 1;
-  if (this->ip().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->ip());
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int32 port = 2;
-  if (this->port() != 0) {
+  // string ip = 1;
+  if (!this->_internal_ip().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->port());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Endpoint::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.Endpoint)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  // int32 port = 2;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
-  const Endpoint* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Endpoint>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.Endpoint)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.Endpoint)
-    MergeFrom(*source);
+
+  // int32 weight = 3;
+  if (this->_internal_weight() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_weight());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Endpoint::MergeFrom(const Endpoint& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Endpoint)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.ip().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Endpoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Endpoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Endpoint::GetClassData() const { return &_class_data_; }
+
 
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+void Endpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Endpoint*>(&to_msg);
+  auto& from = static_cast<const Endpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Endpoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
   }
-  if (from.port() != 0) {
-    set_port(from.port());
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
   }
-}
-
-void Endpoint::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.Endpoint)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_weight() != 0) {
+    _this->_internal_set_weight(from._internal_weight());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Endpoint::CopyFrom(const Endpoint& from) {
@@ -2365,282 +4036,192 @@ void Endpoint::CopyFrom(const Endpoint& from) {
 }
 
 bool Endpoint::IsInitialized() const {
-
   return true;
 }
 
-void Endpoint::Swap(Endpoint* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Endpoint::InternalSwap(Endpoint* other) {
-  ip_.Swap(&other->ip_);
-  std::swap(port_, other->port_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Endpoint::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Endpoint_descriptor_;
-  metadata.reflection = Endpoint_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Endpoint
-
-// optional string ip = 1;
-void Endpoint::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& Endpoint::ip() const {
-  // @@protoc_insertion_point(field_get:lrpc.Endpoint.ip)
-  return ip_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Endpoint::set_ip(const ::std::string& value) {
-  
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Endpoint.ip)
-}
- void Endpoint::set_ip(const char* value) {
-  
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Endpoint.ip)
-}
- void Endpoint::set_ip(const char* value, size_t size) {
-  
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Endpoint.ip)
-}
- ::std::string* Endpoint::mutable_ip() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.Endpoint.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Endpoint::release_ip() {
-  // @@protoc_insertion_point(field_release:lrpc.Endpoint.ip)
-  
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Endpoint::set_allocated_ip(::std::string* ip) {
-  if (ip != NULL) {
-    
-  } else {
-    
-  }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Endpoint.ip)
-}
-
-// optional int32 port = 2;
-void Endpoint::clear_port() {
-  port_ = 0;
-}
- ::google::protobuf::int32 Endpoint::port() const {
-  // @@protoc_insertion_point(field_get:lrpc.Endpoint.port)
-  return port_;
-}
- void Endpoint::set_port(::google::protobuf::int32 value) {
-  
-  port_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Endpoint.port)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Endpoint, _impl_.weight_)
+      + sizeof(Endpoint::_impl_.weight_)
+      - PROTOBUF_FIELD_OFFSET(Endpoint, _impl_.port_)>(
+          reinterpret_cast<char*>(&_impl_.port_),
+          reinterpret_cast<char*>(&other->_impl_.port_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Endpoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[9]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int EndpointList::kEndpointsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-EndpointList::EndpointList()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.EndpointList)
-}
+class EndpointList::_Internal {
+ public:
+};
 
-void EndpointList::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+EndpointList::EndpointList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.EndpointList)
 }
-
 EndpointList::EndpointList(const EndpointList& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EndpointList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.endpoints_){from._impl_.endpoints_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:lrpc.EndpointList)
 }
 
-void EndpointList::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
+inline void EndpointList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.endpoints_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 EndpointList::~EndpointList() {
   // @@protoc_insertion_point(destructor:lrpc.EndpointList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void EndpointList::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void EndpointList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.endpoints_.~RepeatedPtrField();
 }
 
 void EndpointList::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* EndpointList::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return EndpointList_descriptor_;
+  _impl_._cached_size_.Set(size);
 }
 
-const EndpointList& EndpointList::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-EndpointList* EndpointList::default_instance_ = NULL;
+void EndpointList::Clear() {
+// @@protoc_insertion_point(message_clear_start:lrpc.EndpointList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-EndpointList* EndpointList::New(::google::protobuf::Arena* arena) const {
-  EndpointList* n = new EndpointList;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_.endpoints_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void EndpointList::Clear() {
-// @@protoc_insertion_point(message_clear_start:lrpc.EndpointList)
-  endpoints_.Clear();
-}
-
-bool EndpointList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.EndpointList)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* EndpointList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .lrpc.Endpoint endpoints = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_endpoints:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_endpoints()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_endpoints(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_loop_endpoints;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.EndpointList)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.EndpointList)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void EndpointList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.EndpointList)
-  // repeated .lrpc.Endpoint endpoints = 1;
-  for (unsigned int i = 0, n = this->endpoints_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->endpoints(i), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:lrpc.EndpointList)
-}
-
-::google::protobuf::uint8* EndpointList::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* EndpointList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:lrpc.EndpointList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated .lrpc.Endpoint endpoints = 1;
-  for (unsigned int i = 0, n = this->endpoints_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, this->endpoints(i), false, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_endpoints_size()); i < n; i++) {
+    const auto& repfield = this->_internal_endpoints(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.EndpointList)
   return target;
 }
 
-int EndpointList::ByteSize() const {
+size_t EndpointList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.EndpointList)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .lrpc.Endpoint endpoints = 1;
-  total_size += 1 * this->endpoints_size();
-  for (int i = 0; i < this->endpoints_size(); i++) {
+  total_size += 1UL * this->_internal_endpoints_size();
+  for (const auto& msg : this->_impl_.endpoints_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->endpoints(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EndpointList::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.EndpointList)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const EndpointList* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const EndpointList>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.EndpointList)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.EndpointList)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EndpointList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EndpointList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EndpointList::GetClassData() const { return &_class_data_; }
 
-void EndpointList::MergeFrom(const EndpointList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.EndpointList)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  endpoints_.MergeFrom(from.endpoints_);
-}
 
-void EndpointList::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.EndpointList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void EndpointList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EndpointList*>(&to_msg);
+  auto& from = static_cast<const EndpointList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.EndpointList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.endpoints_.MergeFrom(from._impl_.endpoints_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EndpointList::CopyFrom(const EndpointList& from) {
@@ -2651,308 +4232,235 @@ void EndpointList::CopyFrom(const EndpointList& from) {
 }
 
 bool EndpointList::IsInitialized() const {
-
   return true;
 }
 
-void EndpointList::Swap(EndpointList* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void EndpointList::InternalSwap(EndpointList* other) {
-  endpoints_.UnsafeArenaSwap(&other->endpoints_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata EndpointList::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = EndpointList_descriptor_;
-  metadata.reflection = EndpointList_reflection_;
-  return metadata;
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.endpoints_.InternalSwap(&other->_impl_.endpoints_);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// EndpointList
-
-// repeated .lrpc.Endpoint endpoints = 1;
-int EndpointList::endpoints_size() const {
-  return endpoints_.size();
-}
-void EndpointList::clear_endpoints() {
-  endpoints_.Clear();
-}
-const ::lrpc::Endpoint& EndpointList::endpoints(int index) const {
-  // @@protoc_insertion_point(field_get:lrpc.EndpointList.endpoints)
-  return endpoints_.Get(index);
-}
-::lrpc::Endpoint* EndpointList::mutable_endpoints(int index) {
-  // @@protoc_insertion_point(field_mutable:lrpc.EndpointList.endpoints)
-  return endpoints_.Mutable(index);
-}
-::lrpc::Endpoint* EndpointList::add_endpoints() {
-  // @@protoc_insertion_point(field_add:lrpc.EndpointList.endpoints)
-  return endpoints_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint >*
-EndpointList::mutable_endpoints() {
-  // @@protoc_insertion_point(field_mutable_list:lrpc.EndpointList.endpoints)
-  return &endpoints_;
-}
-const ::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint >&
-EndpointList::endpoints() const {
-  // @@protoc_insertion_point(field_list:lrpc.EndpointList.endpoints)
-  return endpoints_;
+::PROTOBUF_NAMESPACE_ID::Metadata EndpointList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[10]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int KeepaliveInfo::kServiceNameFieldNumber;
-const int KeepaliveInfo::kEndpointFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class KeepaliveInfo::_Internal {
+ public:
+  static const ::lrpc::Endpoint& endpoint(const KeepaliveInfo* msg);
+};
 
-KeepaliveInfo::KeepaliveInfo()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.KeepaliveInfo)
+const ::lrpc::Endpoint&
+KeepaliveInfo::_Internal::endpoint(const KeepaliveInfo* msg) {
+  return *msg->_impl_.endpoint_;
 }
-
-void KeepaliveInfo::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  endpoint_ = const_cast< ::lrpc::Endpoint*>(&::lrpc::Endpoint::default_instance());
+KeepaliveInfo::KeepaliveInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.KeepaliveInfo)
 }
-
 KeepaliveInfo::KeepaliveInfo(const KeepaliveInfo& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeepaliveInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.servicename_){}
+    , decltype(_impl_.endpoint_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.servicename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.servicename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_servicename().empty()) {
+    _this->_impl_.servicename_.Set(from._internal_servicename(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_endpoint()) {
+    _this->_impl_.endpoint_ = new ::lrpc::Endpoint(*from._impl_.endpoint_);
+  }
   // @@protoc_insertion_point(copy_constructor:lrpc.KeepaliveInfo)
 }
 
-void KeepaliveInfo::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  servicename_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  endpoint_ = NULL;
+inline void KeepaliveInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.servicename_){}
+    , decltype(_impl_.endpoint_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.servicename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.servicename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 KeepaliveInfo::~KeepaliveInfo() {
   // @@protoc_insertion_point(destructor:lrpc.KeepaliveInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void KeepaliveInfo::SharedDtor() {
-  servicename_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-    delete endpoint_;
-  }
+inline void KeepaliveInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.servicename_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.endpoint_;
 }
 
 void KeepaliveInfo::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* KeepaliveInfo::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return KeepaliveInfo_descriptor_;
-}
-
-const KeepaliveInfo& KeepaliveInfo::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-KeepaliveInfo* KeepaliveInfo::default_instance_ = NULL;
-
-KeepaliveInfo* KeepaliveInfo::New(::google::protobuf::Arena* arena) const {
-  KeepaliveInfo* n = new KeepaliveInfo;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void KeepaliveInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.KeepaliveInfo)
-  servicename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && endpoint_ != NULL) delete endpoint_;
-  endpoint_ = NULL;
-}
-
-bool KeepaliveInfo::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.KeepaliveInfo)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string serviceName = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_servicename()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->servicename().data(), this->servicename().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "lrpc.KeepaliveInfo.serviceName"));
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.servicename_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.endpoint_ != nullptr) {
+    delete _impl_.endpoint_;
+  }
+  _impl_.endpoint_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeepaliveInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string serviceName = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_servicename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.KeepaliveInfo.serviceName"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_endpoint;
-        break;
-      }
-
-      // optional .lrpc.Endpoint endpoint = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_endpoint:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_endpoint()));
-        } else {
+        continue;
+      // .lrpc.Endpoint endpoint = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_endpoint(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.KeepaliveInfo)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.KeepaliveInfo)
-  return false;
-#undef DO_
-}
-
-void KeepaliveInfo::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.KeepaliveInfo)
-  // optional string serviceName = 1;
-  if (this->servicename().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->servicename().data(), this->servicename().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "lrpc.KeepaliveInfo.serviceName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->servicename(), output);
-  }
-
-  // optional .lrpc.Endpoint endpoint = 2;
-  if (this->has_endpoint()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->endpoint_, output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:lrpc.KeepaliveInfo)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* KeepaliveInfo::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* KeepaliveInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:lrpc.KeepaliveInfo)
-  // optional string serviceName = 1;
-  if (this->servicename().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->servicename().data(), this->servicename().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string serviceName = 1;
+  if (!this->_internal_servicename().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_servicename().data(), static_cast<int>(this->_internal_servicename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "lrpc.KeepaliveInfo.serviceName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->servicename(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_servicename(), target);
   }
 
-  // optional .lrpc.Endpoint endpoint = 2;
-  if (this->has_endpoint()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->endpoint_, false, target);
+  // .lrpc.Endpoint endpoint = 2;
+  if (this->_internal_has_endpoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::endpoint(this),
+        _Internal::endpoint(this).GetCachedSize(), target, stream);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.KeepaliveInfo)
   return target;
 }
 
-int KeepaliveInfo::ByteSize() const {
+size_t KeepaliveInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.KeepaliveInfo)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional string serviceName = 1;
-  if (this->servicename().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string serviceName = 1;
+  if (!this->_internal_servicename().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->servicename());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_servicename());
   }
 
-  // optional .lrpc.Endpoint endpoint = 2;
-  if (this->has_endpoint()) {
+  // .lrpc.Endpoint endpoint = 2;
+  if (this->_internal_has_endpoint()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->endpoint_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.endpoint_);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void KeepaliveInfo::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.KeepaliveInfo)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const KeepaliveInfo* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const KeepaliveInfo>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.KeepaliveInfo)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.KeepaliveInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeepaliveInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeepaliveInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeepaliveInfo::GetClassData() const { return &_class_data_; }
 
-void KeepaliveInfo::MergeFrom(const KeepaliveInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.KeepaliveInfo)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.servicename().size() > 0) {
 
-    servicename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.servicename_);
+void KeepaliveInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeepaliveInfo*>(&to_msg);
+  auto& from = static_cast<const KeepaliveInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.KeepaliveInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_servicename().empty()) {
+    _this->_internal_set_servicename(from._internal_servicename());
   }
-  if (from.has_endpoint()) {
-    mutable_endpoint()->::lrpc::Endpoint::MergeFrom(from.endpoint());
+  if (from._internal_has_endpoint()) {
+    _this->_internal_mutable_endpoint()->::lrpc::Endpoint::MergeFrom(
+        from._internal_endpoint());
   }
-}
-
-void KeepaliveInfo::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.KeepaliveInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void KeepaliveInfo::CopyFrom(const KeepaliveInfo& from) {
@@ -2963,319 +4471,200 @@ void KeepaliveInfo::CopyFrom(const KeepaliveInfo& from) {
 }
 
 bool KeepaliveInfo::IsInitialized() const {
-
   return true;
 }
 
-void KeepaliveInfo::Swap(KeepaliveInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void KeepaliveInfo::InternalSwap(KeepaliveInfo* other) {
-  servicename_.Swap(&other->servicename_);
-  std::swap(endpoint_, other->endpoint_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata KeepaliveInfo::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = KeepaliveInfo_descriptor_;
-  metadata.reflection = KeepaliveInfo_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// KeepaliveInfo
-
-// optional string serviceName = 1;
-void KeepaliveInfo::clear_servicename() {
-  servicename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& KeepaliveInfo::servicename() const {
-  // @@protoc_insertion_point(field_get:lrpc.KeepaliveInfo.serviceName)
-  return servicename_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void KeepaliveInfo::set_servicename(const ::std::string& value) {
-  
-  servicename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.KeepaliveInfo.serviceName)
-}
- void KeepaliveInfo::set_servicename(const char* value) {
-  
-  servicename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.KeepaliveInfo.serviceName)
-}
- void KeepaliveInfo::set_servicename(const char* value, size_t size) {
-  
-  servicename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.KeepaliveInfo.serviceName)
-}
- ::std::string* KeepaliveInfo::mutable_servicename() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.KeepaliveInfo.serviceName)
-  return servicename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* KeepaliveInfo::release_servicename() {
-  // @@protoc_insertion_point(field_release:lrpc.KeepaliveInfo.serviceName)
-  
-  return servicename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void KeepaliveInfo::set_allocated_servicename(::std::string* servicename) {
-  if (servicename != NULL) {
-    
-  } else {
-    
-  }
-  servicename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), servicename);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.KeepaliveInfo.serviceName)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.servicename_, lhs_arena,
+      &other->_impl_.servicename_, rhs_arena
+  );
+  swap(_impl_.endpoint_, other->_impl_.endpoint_);
 }
 
-// optional .lrpc.Endpoint endpoint = 2;
-bool KeepaliveInfo::has_endpoint() const {
-  return !_is_default_instance_ && endpoint_ != NULL;
-}
-void KeepaliveInfo::clear_endpoint() {
-  if (GetArenaNoVirtual() == NULL && endpoint_ != NULL) delete endpoint_;
-  endpoint_ = NULL;
-}
-const ::lrpc::Endpoint& KeepaliveInfo::endpoint() const {
-  // @@protoc_insertion_point(field_get:lrpc.KeepaliveInfo.endpoint)
-  return endpoint_ != NULL ? *endpoint_ : *default_instance_->endpoint_;
-}
-::lrpc::Endpoint* KeepaliveInfo::mutable_endpoint() {
-  
-  if (endpoint_ == NULL) {
-    endpoint_ = new ::lrpc::Endpoint;
-  }
-  // @@protoc_insertion_point(field_mutable:lrpc.KeepaliveInfo.endpoint)
-  return endpoint_;
-}
-::lrpc::Endpoint* KeepaliveInfo::release_endpoint() {
-  // @@protoc_insertion_point(field_release:lrpc.KeepaliveInfo.endpoint)
-  
-  ::lrpc::Endpoint* temp = endpoint_;
-  endpoint_ = NULL;
-  return temp;
-}
-void KeepaliveInfo::set_allocated_endpoint(::lrpc::Endpoint* endpoint) {
-  delete endpoint_;
-  endpoint_ = endpoint;
-  if (endpoint) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.KeepaliveInfo.endpoint)
+::PROTOBUF_NAMESPACE_ID::Metadata KeepaliveInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[11]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ServiceName::kNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ServiceName::ServiceName()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.ServiceName)
-}
+class ServiceName::_Internal {
+ public:
+};
 
-void ServiceName::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+ServiceName::ServiceName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.ServiceName)
 }
-
 ServiceName::ServiceName(const ServiceName& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServiceName* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
   // @@protoc_insertion_point(copy_constructor:lrpc.ServiceName)
 }
 
-void ServiceName::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ServiceName::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ServiceName::~ServiceName() {
   // @@protoc_insertion_point(destructor:lrpc.ServiceName)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ServiceName::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void ServiceName::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void ServiceName::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ServiceName::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ServiceName_descriptor_;
-}
-
-const ServiceName& ServiceName::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-ServiceName* ServiceName::default_instance_ = NULL;
-
-ServiceName* ServiceName::New(::google::protobuf::Arena* arena) const {
-  ServiceName* n = new ServiceName;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void ServiceName::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.ServiceName)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-bool ServiceName::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.ServiceName)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string name = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "lrpc.ServiceName.name"));
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServiceName::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lrpc.ServiceName.name"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.ServiceName)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.ServiceName)
-  return false;
-#undef DO_
-}
-
-void ServiceName::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.ServiceName)
-  // optional string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "lrpc.ServiceName.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:lrpc.ServiceName)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* ServiceName::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* ServiceName::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:lrpc.ServiceName)
-  // optional string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "lrpc.ServiceName.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.ServiceName)
   return target;
 }
 
-int ServiceName::ByteSize() const {
+size_t ServiceName::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.ServiceName)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional string name = 1;
-  if (this->name().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ServiceName::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.ServiceName)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const ServiceName* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ServiceName>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.ServiceName)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.ServiceName)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServiceName::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServiceName::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServiceName::GetClassData() const { return &_class_data_; }
 
-void ServiceName::MergeFrom(const ServiceName& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.ServiceName)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-}
+void ServiceName::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServiceName*>(&to_msg);
+  auto& from = static_cast<const ServiceName&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.ServiceName)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ServiceName::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.ServiceName)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ServiceName::CopyFrom(const ServiceName& from) {
@@ -3286,264 +4675,179 @@ void ServiceName::CopyFrom(const ServiceName& from) {
 }
 
 bool ServiceName::IsInitialized() const {
-
   return true;
 }
 
-void ServiceName::Swap(ServiceName* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ServiceName::InternalSwap(ServiceName* other) {
-  name_.Swap(&other->name_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata ServiceName::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ServiceName_descriptor_;
-  metadata.reflection = ServiceName_reflection_;
-  return metadata;
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ServiceName
-
-// optional string name = 1;
-void ServiceName::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& ServiceName::name() const {
-  // @@protoc_insertion_point(field_get:lrpc.ServiceName.name)
-  return name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void ServiceName::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.ServiceName.name)
-}
- void ServiceName::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.ServiceName.name)
-}
- void ServiceName::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.ServiceName.name)
-}
- ::std::string* ServiceName::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.ServiceName.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* ServiceName::release_name() {
-  // @@protoc_insertion_point(field_release:lrpc.ServiceName.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void ServiceName::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.ServiceName.name)
+::PROTOBUF_NAMESPACE_ID::Metadata ServiceName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[12]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Status::kResultFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Status::Status()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:lrpc.Status)
-}
+class Status::_Internal {
+ public:
+};
 
-void Status::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+Status::Status(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lrpc.Status)
 }
-
 Status::Status(const Status& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Status* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.result_ = from._impl_.result_;
   // @@protoc_insertion_point(copy_constructor:lrpc.Status)
 }
 
-void Status::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  result_ = 0;
+inline void Status::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Status::~Status() {
   // @@protoc_insertion_point(destructor:lrpc.Status)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Status::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Status::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Status::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Status::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Status_descriptor_;
-}
-
-const Status& Status::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_lrpc_2eproto();
-  return *default_instance_;
-}
-
-Status* Status::default_instance_ = NULL;
-
-Status* Status::New(::google::protobuf::Arena* arena) const {
-  Status* n = new Status;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Status::Clear() {
 // @@protoc_insertion_point(message_clear_start:lrpc.Status)
-  result_ = 0;
-}
-
-bool Status::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lrpc.Status)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 result = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &result_)));
-
-        } else {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.result_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Status::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.result_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:lrpc.Status)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:lrpc.Status)
-  return false;
-#undef DO_
-}
-
-void Status::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lrpc.Status)
-  // optional int32 result = 1;
-  if (this->result() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->result(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:lrpc.Status)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Status::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* Status::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:lrpc.Status)
-  // optional int32 result = 1;
-  if (this->result() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->result(), target);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 result = 1;
+  if (this->_internal_result() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_result(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:lrpc.Status)
   return target;
 }
 
-int Status::ByteSize() const {
+size_t Status::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:lrpc.Status)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  // optional int32 result = 1;
-  if (this->result() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->result());
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 result = 1;
+  if (this->_internal_result() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_result());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Status::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:lrpc.Status)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const Status* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Status>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:lrpc.Status)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:lrpc.Status)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Status::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Status::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Status::GetClassData() const { return &_class_data_; }
 
-void Status::MergeFrom(const Status& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Status)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from.result() != 0) {
-    set_result(from.result());
-  }
-}
 
-void Status::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:lrpc.Status)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Status::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Status*>(&to_msg);
+  auto& from = static_cast<const Status&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lrpc.Status)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_result() != 0) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Status::CopyFrom(const Status& from) {
@@ -3554,62 +4858,35 @@ void Status::CopyFrom(const Status& from) {
 }
 
 bool Status::IsInitialized() const {
-
   return true;
 }
 
-void Status::Swap(Status* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Status::InternalSwap(Status* other) {
-  std::swap(result_, other->result_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Status::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Status_descriptor_;
-  metadata.reflection = Status_reflection_;
-  return metadata;
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.result_, other->_impl_.result_);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Status
-
-// optional int32 result = 1;
-void Status::clear_result() {
-  result_ = 0;
-}
- ::google::protobuf::int32 Status::result() const {
-  // @@protoc_insertion_point(field_get:lrpc.Status.result)
-  return result_;
-}
- void Status::set_result(::google::protobuf::int32 value) {
-  
-  result_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Status.result)
+::PROTOBUF_NAMESPACE_ID::Metadata Status::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lrpc_2eproto_getter, &descriptor_table_lrpc_2eproto_once,
+      file_level_metadata_lrpc_2eproto[13]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
 NameService::~NameService() {}
 
-const ::google::protobuf::ServiceDescriptor* NameService::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NameService_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* NameService::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_lrpc_2eproto);
+  return file_level_service_descriptors_lrpc_2eproto[0];
 }
 
-const ::google::protobuf::ServiceDescriptor* NameService::GetDescriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NameService_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* NameService::GetDescriptor() {
+  return descriptor();
 }
 
-void NameService::GetEndpoints(::google::protobuf::RpcController* controller,
+void NameService::GetEndpoints(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                          const ::lrpc::ServiceName*,
                          ::lrpc::EndpointList*,
                          ::google::protobuf::Closure* done) {
@@ -3617,7 +4894,7 @@ void NameService::GetEndpoints(::google::protobuf::RpcController* controller,
   done->Run();
 }
 
-void NameService::Keepalive(::google::protobuf::RpcController* controller,
+void NameService::Keepalive(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                          const ::lrpc::KeepaliveInfo*,
                          ::lrpc::Status*,
                          ::google::protobuf::Closure* done) {
@@ -3625,23 +4902,27 @@ void NameService::Keepalive(::google::protobuf::RpcController* controller,
   done->Run();
 }
 
-void NameService::CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                             ::google::protobuf::RpcController* controller,
-                             const ::google::protobuf::Message* request,
-                             ::google::protobuf::Message* response,
+void NameService::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
                              ::google::protobuf::Closure* done) {
-  GOOGLE_DCHECK_EQ(method->service(), NameService_descriptor_);
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_lrpc_2eproto[0]);
   switch(method->index()) {
     case 0:
       GetEndpoints(controller,
-             ::google::protobuf::down_cast<const ::lrpc::ServiceName*>(request),
-             ::google::protobuf::down_cast< ::lrpc::EndpointList*>(response),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::lrpc::ServiceName*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::lrpc::EndpointList*>(
+                 response),
              done);
       break;
     case 1:
       Keepalive(controller,
-             ::google::protobuf::down_cast<const ::lrpc::KeepaliveInfo*>(request),
-             ::google::protobuf::down_cast< ::lrpc::Status*>(response),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::lrpc::KeepaliveInfo*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::lrpc::Status*>(
+                 response),
              done);
       break;
     default:
@@ -3650,8 +4931,8 @@ void NameService::CallMethod(const ::google::protobuf::MethodDescriptor* method,
   }
 }
 
-const ::google::protobuf::Message& NameService::GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
+const ::PROTOBUF_NAMESPACE_ID::Message& NameService::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
   GOOGLE_DCHECK_EQ(method->service(), descriptor());
   switch(method->index()) {
     case 0:
@@ -3660,13 +4941,13 @@ const ::google::protobuf::Message& NameService::GetRequestPrototype(
       return ::lrpc::KeepaliveInfo::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::google::protobuf::MessageFactory::generated_factory()
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
           ->GetPrototype(method->input_type());
   }
 }
 
-const ::google::protobuf::Message& NameService::GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
+const ::PROTOBUF_NAMESPACE_ID::Message& NameService::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
   GOOGLE_DCHECK_EQ(method->service(), descriptor());
   switch(method->index()) {
     case 0:
@@ -3675,30 +4956,30 @@ const ::google::protobuf::Message& NameService::GetResponsePrototype(
       return ::lrpc::Status::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::google::protobuf::MessageFactory::generated_factory()
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
           ->GetPrototype(method->output_type());
   }
 }
 
-NameService_Stub::NameService_Stub(::google::protobuf::RpcChannel* channel)
+NameService_Stub::NameService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
   : channel_(channel), owns_channel_(false) {}
 NameService_Stub::NameService_Stub(
-    ::google::protobuf::RpcChannel* channel,
-    ::google::protobuf::Service::ChannelOwnership ownership)
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
   : channel_(channel),
-    owns_channel_(ownership == ::google::protobuf::Service::STUB_OWNS_CHANNEL) {}
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
 NameService_Stub::~NameService_Stub() {
   if (owns_channel_) delete channel_;
 }
 
-void NameService_Stub::GetEndpoints(::google::protobuf::RpcController* controller,
+void NameService_Stub::GetEndpoints(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                               const ::lrpc::ServiceName* request,
                               ::lrpc::EndpointList* response,
                               ::google::protobuf::Closure* done) {
   channel_->CallMethod(descriptor()->method(0),
                        controller, request, response, done);
 }
-void NameService_Stub::Keepalive(::google::protobuf::RpcController* controller,
+void NameService_Stub::Keepalive(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                               const ::lrpc::KeepaliveInfo* request,
                               ::lrpc::Status* response,
                               ::google::protobuf::Closure* done) {
@@ -3707,7 +4988,65 @@ void NameService_Stub::Keepalive(::google::protobuf::RpcController* controller,
 }
 
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace lrpc
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::lrpc::Request*
+Arena::CreateMaybeMessage< ::lrpc::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::Error*
+Arena::CreateMaybeMessage< ::lrpc::Error >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::Error >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::Response*
+Arena::CreateMaybeMessage< ::lrpc::Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::StreamFrame*
+Arena::CreateMaybeMessage< ::lrpc::StreamFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::StreamFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::PushFrame*
+Arena::CreateMaybeMessage< ::lrpc::PushFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::PushFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::ChunkFrame*
+Arena::CreateMaybeMessage< ::lrpc::ChunkFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::ChunkFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::BatchRequest*
+Arena::CreateMaybeMessage< ::lrpc::BatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::BatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::BatchResponse*
+Arena::CreateMaybeMessage< ::lrpc::BatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::BatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::RpcMessage*
+Arena::CreateMaybeMessage< ::lrpc::RpcMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::RpcMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::Endpoint*
+Arena::CreateMaybeMessage< ::lrpc::Endpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::Endpoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::EndpointList*
+Arena::CreateMaybeMessage< ::lrpc::EndpointList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::EndpointList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::KeepaliveInfo*
+Arena::CreateMaybeMessage< ::lrpc::KeepaliveInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::KeepaliveInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::ServiceName*
+Arena::CreateMaybeMessage< ::lrpc::ServiceName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::ServiceName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lrpc::Status*
+Arena::CreateMaybeMessage< ::lrpc::Status >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lrpc::Status >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
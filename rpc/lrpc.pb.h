@@ -1,54 +1,168 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: lrpc.proto
 
-#ifndef PROTOBUF_lrpc_2eproto__INCLUDED
-#define PROTOBUF_lrpc_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_lrpc_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_lrpc_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_lrpc_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_lrpc_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_lrpc_2eproto;
 namespace lrpc {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_lrpc_2eproto();
-void protobuf_AssignDesc_lrpc_2eproto();
-void protobuf_ShutdownFile_lrpc_2eproto();
-
+class BatchRequest;
+struct BatchRequestDefaultTypeInternal;
+extern BatchRequestDefaultTypeInternal _BatchRequest_default_instance_;
+class BatchResponse;
+struct BatchResponseDefaultTypeInternal;
+extern BatchResponseDefaultTypeInternal _BatchResponse_default_instance_;
+class ChunkFrame;
+struct ChunkFrameDefaultTypeInternal;
+extern ChunkFrameDefaultTypeInternal _ChunkFrame_default_instance_;
 class Endpoint;
+struct EndpointDefaultTypeInternal;
+extern EndpointDefaultTypeInternal _Endpoint_default_instance_;
 class EndpointList;
+struct EndpointListDefaultTypeInternal;
+extern EndpointListDefaultTypeInternal _EndpointList_default_instance_;
 class Error;
+struct ErrorDefaultTypeInternal;
+extern ErrorDefaultTypeInternal _Error_default_instance_;
 class KeepaliveInfo;
+struct KeepaliveInfoDefaultTypeInternal;
+extern KeepaliveInfoDefaultTypeInternal _KeepaliveInfo_default_instance_;
+class PushFrame;
+struct PushFrameDefaultTypeInternal;
+extern PushFrameDefaultTypeInternal _PushFrame_default_instance_;
 class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
 class Response;
+struct ResponseDefaultTypeInternal;
+extern ResponseDefaultTypeInternal _Response_default_instance_;
 class RpcMessage;
+struct RpcMessageDefaultTypeInternal;
+extern RpcMessageDefaultTypeInternal _RpcMessage_default_instance_;
 class ServiceName;
+struct ServiceNameDefaultTypeInternal;
+extern ServiceNameDefaultTypeInternal _ServiceName_default_instance_;
 class Status;
+struct StatusDefaultTypeInternal;
+extern StatusDefaultTypeInternal _Status_default_instance_;
+class StreamFrame;
+struct StreamFrameDefaultTypeInternal;
+extern StreamFrameDefaultTypeInternal _StreamFrame_default_instance_;
+}  // namespace lrpc
+PROTOBUF_NAMESPACE_OPEN
+template<> ::lrpc::BatchRequest* Arena::CreateMaybeMessage<::lrpc::BatchRequest>(Arena*);
+template<> ::lrpc::BatchResponse* Arena::CreateMaybeMessage<::lrpc::BatchResponse>(Arena*);
+template<> ::lrpc::ChunkFrame* Arena::CreateMaybeMessage<::lrpc::ChunkFrame>(Arena*);
+template<> ::lrpc::Endpoint* Arena::CreateMaybeMessage<::lrpc::Endpoint>(Arena*);
+template<> ::lrpc::EndpointList* Arena::CreateMaybeMessage<::lrpc::EndpointList>(Arena*);
+template<> ::lrpc::Error* Arena::CreateMaybeMessage<::lrpc::Error>(Arena*);
+template<> ::lrpc::KeepaliveInfo* Arena::CreateMaybeMessage<::lrpc::KeepaliveInfo>(Arena*);
+template<> ::lrpc::PushFrame* Arena::CreateMaybeMessage<::lrpc::PushFrame>(Arena*);
+template<> ::lrpc::Request* Arena::CreateMaybeMessage<::lrpc::Request>(Arena*);
+template<> ::lrpc::Response* Arena::CreateMaybeMessage<::lrpc::Response>(Arena*);
+template<> ::lrpc::RpcMessage* Arena::CreateMaybeMessage<::lrpc::RpcMessage>(Arena*);
+template<> ::lrpc::ServiceName* Arena::CreateMaybeMessage<::lrpc::ServiceName>(Arena*);
+template<> ::lrpc::Status* Arena::CreateMaybeMessage<::lrpc::Status>(Arena*);
+template<> ::lrpc::StreamFrame* Arena::CreateMaybeMessage<::lrpc::StreamFrame>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace lrpc {
 
-enum MessageType {
+enum StreamFrame_Type : int {
+  StreamFrame_Type_OPEN = 0,
+  StreamFrame_Type_DATA = 1,
+  StreamFrame_Type_HALF_CLOSE = 2,
+  StreamFrame_Type_CANCEL = 3,
+  StreamFrame_Type_CREDIT = 4,
+  StreamFrame_Type_StreamFrame_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StreamFrame_Type_StreamFrame_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StreamFrame_Type_IsValid(int value);
+constexpr StreamFrame_Type StreamFrame_Type_Type_MIN = StreamFrame_Type_OPEN;
+constexpr StreamFrame_Type StreamFrame_Type_Type_MAX = StreamFrame_Type_CREDIT;
+constexpr int StreamFrame_Type_Type_ARRAYSIZE = StreamFrame_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StreamFrame_Type_descriptor();
+template<typename T>
+inline const std::string& StreamFrame_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StreamFrame_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StreamFrame_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StreamFrame_Type_descriptor(), enum_t_value);
+}
+inline bool StreamFrame_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StreamFrame_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StreamFrame_Type>(
+    StreamFrame_Type_descriptor(), name, value);
+}
+enum PushFrame_Type : int {
+  PushFrame_Type_SUBSCRIBE = 0,
+  PushFrame_Type_UNSUBSCRIBE = 1,
+  PushFrame_Type_PUBLISH = 2,
+  PushFrame_Type_PushFrame_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PushFrame_Type_PushFrame_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PushFrame_Type_IsValid(int value);
+constexpr PushFrame_Type PushFrame_Type_Type_MIN = PushFrame_Type_SUBSCRIBE;
+constexpr PushFrame_Type PushFrame_Type_Type_MAX = PushFrame_Type_PUBLISH;
+constexpr int PushFrame_Type_Type_ARRAYSIZE = PushFrame_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PushFrame_Type_descriptor();
+template<typename T>
+inline const std::string& PushFrame_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PushFrame_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PushFrame_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PushFrame_Type_descriptor(), enum_t_value);
+}
+inline bool PushFrame_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PushFrame_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PushFrame_Type>(
+    PushFrame_Type_descriptor(), name, value);
+}
+enum MessageType : int {
   HEARTBEAT_PACKET = 0,
   RPC_SERVICE_REGISTER = 1,
   RPC_SERVICE_REGISTER_RESPONSE = 2,
@@ -56,1649 +170,5342 @@ enum MessageType {
   RPC_SERVICE_DISCOVER_RESPONSE = 4,
   RPC_METHOD_REQUEST = 5,
   RPC_METHOD_RESPONSE = 6,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
-const MessageType MessageType_MIN = HEARTBEAT_PACKET;
-const MessageType MessageType_MAX = RPC_METHOD_RESPONSE;
-const int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor();
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    MessageType_descriptor(), value);
+constexpr MessageType MessageType_MIN = HEARTBEAT_PACKET;
+constexpr MessageType MessageType_MAX = RPC_METHOD_RESPONSE;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const ::std::string& name, MessageType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
+enum Priority : int {
+  PRIORITY_DEFAULT = 0,
+  PRIORITY_CONTROL = 1,
+  PRIORITY_CRITICAL = 2,
+  PRIORITY_BATCH = 3,
+  Priority_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Priority_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Priority_IsValid(int value);
+constexpr Priority Priority_MIN = PRIORITY_DEFAULT;
+constexpr Priority Priority_MAX = PRIORITY_BATCH;
+constexpr int Priority_ARRAYSIZE = Priority_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Priority_descriptor();
+template<typename T>
+inline const std::string& Priority_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Priority>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Priority_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Priority_descriptor(), enum_t_value);
+}
+inline bool Priority_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Priority* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Priority>(
+    Priority_descriptor(), name, value);
+}
 // ===================================================================
 
-class Request : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.Request) */ {
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.Request) */ {
  public:
-  Request();
-  virtual ~Request();
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
 
   inline Request& operator=(const Request& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Request& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Request* other);
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Request* New() const { return New(NULL); }
-
-  Request* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Request& from);
-  void MergeFrom(const Request& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Request* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.Request";
   }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 id = 1;
-  void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
-
-  // optional string service_name = 2;
+  enum : int {
+    kServiceNameFieldNumber = 2,
+    kMethodNameFieldNumber = 3,
+    kSerializedRequestFieldNumber = 4,
+    kAttachmentFieldNumber = 11,
+    kIdFieldNumber = 1,
+    kAcceptCompressFieldNumber = 7,
+    kTimeoutMsFieldNumber = 5,
+    kDeadlineUsFieldNumber = 6,
+    kCompressDictFieldNumber = 8,
+    kPriorityFieldNumber = 9,
+    kOnewayFieldNumber = 10,
+  };
+  // string service_name = 2;
   void clear_service_name();
-  static const int kServiceNameFieldNumber = 2;
-  const ::std::string& service_name() const;
-  void set_service_name(const ::std::string& value);
-  void set_service_name(const char* value);
-  void set_service_name(const char* value, size_t size);
-  ::std::string* mutable_service_name();
-  ::std::string* release_service_name();
-  void set_allocated_service_name(::std::string* service_name);
-
-  // optional string method_name = 3;
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
+
+  // string method_name = 3;
   void clear_method_name();
-  static const int kMethodNameFieldNumber = 3;
-  const ::std::string& method_name() const;
-  void set_method_name(const ::std::string& value);
-  void set_method_name(const char* value);
-  void set_method_name(const char* value, size_t size);
-  ::std::string* mutable_method_name();
-  ::std::string* release_method_name();
-  void set_allocated_method_name(::std::string* method_name);
-
-  // optional bytes serialized_request = 4;
+  const std::string& method_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
+  void set_allocated_method_name(std::string* method_name);
+  private:
+  const std::string& _internal_method_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
+  std::string* _internal_mutable_method_name();
+  public:
+
+  // bytes serialized_request = 4;
   void clear_serialized_request();
-  static const int kSerializedRequestFieldNumber = 4;
-  const ::std::string& serialized_request() const;
-  void set_serialized_request(const ::std::string& value);
-  void set_serialized_request(const char* value);
-  void set_serialized_request(const void* value, size_t size);
-  ::std::string* mutable_serialized_request();
-  ::std::string* release_serialized_request();
-  void set_allocated_serialized_request(::std::string* serialized_request);
+  const std::string& serialized_request() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_serialized_request(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_serialized_request();
+  PROTOBUF_NODISCARD std::string* release_serialized_request();
+  void set_allocated_serialized_request(std::string* serialized_request);
+  private:
+  const std::string& _internal_serialized_request() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_serialized_request(const std::string& value);
+  std::string* _internal_mutable_serialized_request();
+  public:
+
+  // bytes attachment = 11;
+  void clear_attachment();
+  const std::string& attachment() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attachment(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attachment();
+  PROTOBUF_NODISCARD std::string* release_attachment();
+  void set_allocated_attachment(std::string* attachment);
+  private:
+  const std::string& _internal_attachment() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attachment(const std::string& value);
+  std::string* _internal_mutable_attachment();
+  public:
+
+  // int32 id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // uint32 accept_compress = 7;
+  void clear_accept_compress();
+  uint32_t accept_compress() const;
+  void set_accept_compress(uint32_t value);
+  private:
+  uint32_t _internal_accept_compress() const;
+  void _internal_set_accept_compress(uint32_t value);
+  public:
+
+  // int64 timeout_ms = 5;
+  void clear_timeout_ms();
+  int64_t timeout_ms() const;
+  void set_timeout_ms(int64_t value);
+  private:
+  int64_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(int64_t value);
+  public:
+
+  // int64 deadline_us = 6;
+  void clear_deadline_us();
+  int64_t deadline_us() const;
+  void set_deadline_us(int64_t value);
+  private:
+  int64_t _internal_deadline_us() const;
+  void _internal_set_deadline_us(int64_t value);
+  public:
+
+  // uint32 compress_dict = 8;
+  void clear_compress_dict();
+  uint32_t compress_dict() const;
+  void set_compress_dict(uint32_t value);
+  private:
+  uint32_t _internal_compress_dict() const;
+  void _internal_set_compress_dict(uint32_t value);
+  public:
+
+  // .lrpc.Priority priority = 9;
+  void clear_priority();
+  ::lrpc::Priority priority() const;
+  void set_priority(::lrpc::Priority value);
+  private:
+  ::lrpc::Priority _internal_priority() const;
+  void _internal_set_priority(::lrpc::Priority value);
+  public:
+
+  // bool oneway = 10;
+  void clear_oneway();
+  bool oneway() const;
+  void set_oneway(bool value);
+  private:
+  bool _internal_oneway() const;
+  void _internal_set_oneway(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:lrpc.Request)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr service_name_;
-  ::google::protobuf::internal::ArenaStringPtr method_name_;
-  ::google::protobuf::internal::ArenaStringPtr serialized_request_;
-  ::google::protobuf::int32 id_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
-
-  void InitAsDefaultInstance();
-  static Request* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr serialized_request_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attachment_;
+    int32_t id_;
+    uint32_t accept_compress_;
+    int64_t timeout_ms_;
+    int64_t deadline_us_;
+    uint32_t compress_dict_;
+    int priority_;
+    bool oneway_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Error : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.Error) */ {
+class Error final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.Error) */ {
  public:
-  Error();
-  virtual ~Error();
+  inline Error() : Error(nullptr) {}
+  ~Error() override;
+  explicit PROTOBUF_CONSTEXPR Error(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Error(const Error& from);
+  Error(Error&& from) noexcept
+    : Error() {
+    *this = ::std::move(from);
+  }
 
   inline Error& operator=(const Error& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Error& operator=(Error&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Error& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Error& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Error* internal_default_instance() {
+    return reinterpret_cast<const Error*>(
+               &_Error_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Error* other);
+  friend void swap(Error& a, Error& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Error* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Error* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Error* New() const { return New(NULL); }
-
-  Error* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Error* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Error>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Error& from);
-  void MergeFrom(const Error& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Error& from) {
+    Error::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Error* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.Error";
   }
+  protected:
+  explicit Error(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 errnum = 1;
-  void clear_errnum();
-  static const int kErrnumFieldNumber = 1;
-  ::google::protobuf::int32 errnum() const;
-  void set_errnum(::google::protobuf::int32 value);
-
-  // optional string msg = 2;
+  enum : int {
+    kMsgFieldNumber = 2,
+    kErrnumFieldNumber = 1,
+  };
+  // string msg = 2;
   void clear_msg();
-  static const int kMsgFieldNumber = 2;
-  const ::std::string& msg() const;
-  void set_msg(const ::std::string& value);
-  void set_msg(const char* value);
-  void set_msg(const char* value, size_t size);
-  ::std::string* mutable_msg();
-  ::std::string* release_msg();
-  void set_allocated_msg(::std::string* msg);
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // int32 errnum = 1;
+  void clear_errnum();
+  int32_t errnum() const;
+  void set_errnum(int32_t value);
+  private:
+  int32_t _internal_errnum() const;
+  void _internal_set_errnum(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:lrpc.Error)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr msg_;
-  ::google::protobuf::int32 errnum_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
-
-  void InitAsDefaultInstance();
-  static Error* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    int32_t errnum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Response : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.Response) */ {
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.Response) */ {
  public:
-  Response();
-  virtual ~Response();
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
 
   inline Response& operator=(const Response& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Response& default_instance();
-
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
   enum BodyCase {
     kSerializedResponse = 2,
     kError = 3,
     BODY_NOT_SET = 0,
   };
 
-  void Swap(Response* other);
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  // implements Message ----------------------------------------------
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  inline Response* New() const { return New(NULL); }
+  // implements Message ----------------------------------------------
 
-  Response* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Response& from);
-  void MergeFrom(const Response& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Response* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.Response";
   }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 id = 1;
+  enum : int {
+    kAttachmentFieldNumber = 6,
+    kIdFieldNumber = 1,
+    kAcceptCompressFieldNumber = 4,
+    kCompressDictFieldNumber = 5,
+    kSerializedResponseFieldNumber = 2,
+    kErrorFieldNumber = 3,
+  };
+  // bytes attachment = 6;
+  void clear_attachment();
+  const std::string& attachment() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attachment(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attachment();
+  PROTOBUF_NODISCARD std::string* release_attachment();
+  void set_allocated_attachment(std::string* attachment);
+  private:
+  const std::string& _internal_attachment() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attachment(const std::string& value);
+  std::string* _internal_mutable_attachment();
+  public:
+
+  // int32 id = 1;
   void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
-  // optional bytes serialized_response = 2;
+  // uint32 accept_compress = 4;
+  void clear_accept_compress();
+  uint32_t accept_compress() const;
+  void set_accept_compress(uint32_t value);
   private:
+  uint32_t _internal_accept_compress() const;
+  void _internal_set_accept_compress(uint32_t value);
+  public:
+
+  // uint32 compress_dict = 5;
+  void clear_compress_dict();
+  uint32_t compress_dict() const;
+  void set_compress_dict(uint32_t value);
+  private:
+  uint32_t _internal_compress_dict() const;
+  void _internal_set_compress_dict(uint32_t value);
+  public:
+
+  // bytes serialized_response = 2;
   bool has_serialized_response() const;
+  private:
+  bool _internal_has_serialized_response() const;
   public:
   void clear_serialized_response();
-  static const int kSerializedResponseFieldNumber = 2;
-  const ::std::string& serialized_response() const;
-  void set_serialized_response(const ::std::string& value);
-  void set_serialized_response(const char* value);
-  void set_serialized_response(const void* value, size_t size);
-  ::std::string* mutable_serialized_response();
-  ::std::string* release_serialized_response();
-  void set_allocated_serialized_response(::std::string* serialized_response);
-
-  // optional .lrpc.Error error = 3;
+  const std::string& serialized_response() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_serialized_response(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_serialized_response();
+  PROTOBUF_NODISCARD std::string* release_serialized_response();
+  void set_allocated_serialized_response(std::string* serialized_response);
+  private:
+  const std::string& _internal_serialized_response() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_serialized_response(const std::string& value);
+  std::string* _internal_mutable_serialized_response();
+  public:
+
+  // .lrpc.Error error = 3;
   bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
   void clear_error();
-  static const int kErrorFieldNumber = 3;
   const ::lrpc::Error& error() const;
+  PROTOBUF_NODISCARD ::lrpc::Error* release_error();
   ::lrpc::Error* mutable_error();
-  ::lrpc::Error* release_error();
   void set_allocated_error(::lrpc::Error* error);
+  private:
+  const ::lrpc::Error& _internal_error() const;
+  ::lrpc::Error* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::lrpc::Error* error);
+  ::lrpc::Error* unsafe_arena_release_error();
 
+  void clear_Body();
   BodyCase Body_case() const;
   // @@protoc_insertion_point(class_scope:lrpc.Response)
  private:
-  inline void set_has_serialized_response();
-  inline void set_has_error();
+  class _Internal;
+  void set_has_serialized_response();
+  void set_has_error();
 
   inline bool has_Body() const;
-  void clear_Body();
   inline void clear_has_Body();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int32 id_;
-  union BodyUnion {
-    BodyUnion() {}
-    ::google::protobuf::internal::ArenaStringPtr serialized_response_;
-    ::lrpc::Error* error_;
-  } Body_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attachment_;
+    int32_t id_;
+    uint32_t accept_compress_;
+    uint32_t compress_dict_;
+    union BodyUnion {
+      constexpr BodyUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr serialized_response_;
+      ::lrpc::Error* error_;
+    } Body_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
-  void InitAsDefaultInstance();
-  static Response* default_instance_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RpcMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.RpcMessage) */ {
+class StreamFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.StreamFrame) */ {
  public:
-  RpcMessage();
-  virtual ~RpcMessage();
-
-  RpcMessage(const RpcMessage& from);
+  inline StreamFrame() : StreamFrame(nullptr) {}
+  ~StreamFrame() override;
+  explicit PROTOBUF_CONSTEXPR StreamFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StreamFrame(const StreamFrame& from);
+  StreamFrame(StreamFrame&& from) noexcept
+    : StreamFrame() {
+    *this = ::std::move(from);
+  }
 
-  inline RpcMessage& operator=(const RpcMessage& from) {
+  inline StreamFrame& operator=(const StreamFrame& from) {
     CopyFrom(from);
     return *this;
   }
+  inline StreamFrame& operator=(StreamFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RpcMessage& default_instance();
-
-  enum BodyCase {
-    kRequest = 1,
-    kResponse = 2,
-    BODY_NOT_SET = 0,
-  };
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StreamFrame* internal_default_instance() {
+    return reinterpret_cast<const StreamFrame*>(
+               &_StreamFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(RpcMessage* other);
+  friend void swap(StreamFrame& a, StreamFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StreamFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RpcMessage* New() const { return New(NULL); }
+  StreamFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StreamFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StreamFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StreamFrame& from) {
+    StreamFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  RpcMessage* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const RpcMessage& from);
-  void MergeFrom(const RpcMessage& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(RpcMessage* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StreamFrame* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.StreamFrame";
   }
+  protected:
+  explicit StreamFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef StreamFrame_Type Type;
+  static constexpr Type OPEN =
+    StreamFrame_Type_OPEN;
+  static constexpr Type DATA =
+    StreamFrame_Type_DATA;
+  static constexpr Type HALF_CLOSE =
+    StreamFrame_Type_HALF_CLOSE;
+  static constexpr Type CANCEL =
+    StreamFrame_Type_CANCEL;
+  static constexpr Type CREDIT =
+    StreamFrame_Type_CREDIT;
+  static inline bool Type_IsValid(int value) {
+    return StreamFrame_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    StreamFrame_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    StreamFrame_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    StreamFrame_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return StreamFrame_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return StreamFrame_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return StreamFrame_Type_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
-  // optional .lrpc.Request request = 1;
-  bool has_request() const;
-  void clear_request();
-  static const int kRequestFieldNumber = 1;
-  const ::lrpc::Request& request() const;
-  ::lrpc::Request* mutable_request();
-  ::lrpc::Request* release_request();
-  void set_allocated_request(::lrpc::Request* request);
+  enum : int {
+    kServiceNameFieldNumber = 3,
+    kMethodNameFieldNumber = 4,
+    kPayloadFieldNumber = 5,
+    kErrorFieldNumber = 7,
+    kIdFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kCreditFieldNumber = 6,
+  };
+  // string service_name = 3;
+  void clear_service_name();
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
 
-  // optional .lrpc.Response response = 2;
-  bool has_response() const;
-  void clear_response();
-  static const int kResponseFieldNumber = 2;
-  const ::lrpc::Response& response() const;
-  ::lrpc::Response* mutable_response();
-  ::lrpc::Response* release_response();
-  void set_allocated_response(::lrpc::Response* response);
+  // string method_name = 4;
+  void clear_method_name();
+  const std::string& method_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
+  void set_allocated_method_name(std::string* method_name);
+  private:
+  const std::string& _internal_method_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
+  std::string* _internal_mutable_method_name();
+  public:
 
-  BodyCase Body_case() const;
-  // @@protoc_insertion_point(class_scope:lrpc.RpcMessage)
- private:
-  inline void set_has_request();
-  inline void set_has_response();
+  // bytes payload = 5;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
 
-  inline bool has_Body() const;
-  void clear_Body();
-  inline void clear_has_Body();
+  // .lrpc.Error error = 7;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::lrpc::Error& error() const;
+  PROTOBUF_NODISCARD ::lrpc::Error* release_error();
+  ::lrpc::Error* mutable_error();
+  void set_allocated_error(::lrpc::Error* error);
+  private:
+  const ::lrpc::Error& _internal_error() const;
+  ::lrpc::Error* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::lrpc::Error* error);
+  ::lrpc::Error* unsafe_arena_release_error();
+
+  // int32 id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  union BodyUnion {
-    BodyUnion() {}
-    ::lrpc::Request* request_;
-    ::lrpc::Response* response_;
-  } Body_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
-
-  void InitAsDefaultInstance();
-  static RpcMessage* default_instance_;
+  // .lrpc.StreamFrame.Type type = 2;
+  void clear_type();
+  ::lrpc::StreamFrame_Type type() const;
+  void set_type(::lrpc::StreamFrame_Type value);
+  private:
+  ::lrpc::StreamFrame_Type _internal_type() const;
+  void _internal_set_type(::lrpc::StreamFrame_Type value);
+  public:
+
+  // uint32 credit = 6;
+  void clear_credit();
+  uint32_t credit() const;
+  void set_credit(uint32_t value);
+  private:
+  uint32_t _internal_credit() const;
+  void _internal_set_credit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lrpc.StreamFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    ::lrpc::Error* error_;
+    int32_t id_;
+    int type_;
+    uint32_t credit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Endpoint : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.Endpoint) */ {
+class PushFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.PushFrame) */ {
  public:
-  Endpoint();
-  virtual ~Endpoint();
-
-  Endpoint(const Endpoint& from);
+  inline PushFrame() : PushFrame(nullptr) {}
+  ~PushFrame() override;
+  explicit PROTOBUF_CONSTEXPR PushFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PushFrame(const PushFrame& from);
+  PushFrame(PushFrame&& from) noexcept
+    : PushFrame() {
+    *this = ::std::move(from);
+  }
 
-  inline Endpoint& operator=(const Endpoint& from) {
+  inline PushFrame& operator=(const PushFrame& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PushFrame& operator=(PushFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Endpoint& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PushFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PushFrame* internal_default_instance() {
+    return reinterpret_cast<const PushFrame*>(
+               &_PushFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(Endpoint* other);
+  friend void swap(PushFrame& a, PushFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PushFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PushFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Endpoint* New() const { return New(NULL); }
-
-  Endpoint* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Endpoint& from);
-  void MergeFrom(const Endpoint& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  PushFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PushFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PushFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PushFrame& from) {
+    PushFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Endpoint* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PushFrame* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.PushFrame";
   }
+  protected:
+  explicit PushFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef PushFrame_Type Type;
+  static constexpr Type SUBSCRIBE =
+    PushFrame_Type_SUBSCRIBE;
+  static constexpr Type UNSUBSCRIBE =
+    PushFrame_Type_UNSUBSCRIBE;
+  static constexpr Type PUBLISH =
+    PushFrame_Type_PUBLISH;
+  static inline bool Type_IsValid(int value) {
+    return PushFrame_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    PushFrame_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    PushFrame_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    PushFrame_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return PushFrame_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return PushFrame_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return PushFrame_Type_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
-  // optional string ip = 1;
-  void clear_ip();
-  static const int kIpFieldNumber = 1;
-  const ::std::string& ip() const;
-  void set_ip(const ::std::string& value);
-  void set_ip(const char* value);
-  void set_ip(const char* value, size_t size);
-  ::std::string* mutable_ip();
-  ::std::string* release_ip();
-  void set_allocated_ip(::std::string* ip);
-
-  // optional int32 port = 2;
-  void clear_port();
-  static const int kPortFieldNumber = 2;
-  ::google::protobuf::int32 port() const;
-  void set_port(::google::protobuf::int32 value);
+  enum : int {
+    kServiceNameFieldNumber = 2,
+    kTopicFieldNumber = 3,
+    kPayloadFieldNumber = 4,
+    kTypeFieldNumber = 1,
+  };
+  // string service_name = 2;
+  void clear_service_name();
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
 
-  // @@protoc_insertion_point(class_scope:lrpc.Endpoint)
- private:
+  // string topic = 3;
+  void clear_topic();
+  const std::string& topic() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_topic(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_topic();
+  PROTOBUF_NODISCARD std::string* release_topic();
+  void set_allocated_topic(std::string* topic);
+  private:
+  const std::string& _internal_topic() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_topic(const std::string& value);
+  std::string* _internal_mutable_topic();
+  public:
+
+  // bytes payload = 4;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // .lrpc.PushFrame.Type type = 1;
+  void clear_type();
+  ::lrpc::PushFrame_Type type() const;
+  void set_type(::lrpc::PushFrame_Type value);
+  private:
+  ::lrpc::PushFrame_Type _internal_type() const;
+  void _internal_set_type(::lrpc::PushFrame_Type value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr ip_;
-  ::google::protobuf::int32 port_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
-
-  void InitAsDefaultInstance();
-  static Endpoint* default_instance_;
+  // @@protoc_insertion_point(class_scope:lrpc.PushFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr topic_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EndpointList : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.EndpointList) */ {
+class ChunkFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.ChunkFrame) */ {
  public:
-  EndpointList();
-  virtual ~EndpointList();
-
-  EndpointList(const EndpointList& from);
+  inline ChunkFrame() : ChunkFrame(nullptr) {}
+  ~ChunkFrame() override;
+  explicit PROTOBUF_CONSTEXPR ChunkFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChunkFrame(const ChunkFrame& from);
+  ChunkFrame(ChunkFrame&& from) noexcept
+    : ChunkFrame() {
+    *this = ::std::move(from);
+  }
 
-  inline EndpointList& operator=(const EndpointList& from) {
+  inline ChunkFrame& operator=(const ChunkFrame& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ChunkFrame& operator=(ChunkFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const EndpointList& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChunkFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChunkFrame* internal_default_instance() {
+    return reinterpret_cast<const ChunkFrame*>(
+               &_ChunkFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(EndpointList* other);
+  friend void swap(ChunkFrame& a, ChunkFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChunkFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChunkFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline EndpointList* New() const { return New(NULL); }
+  ChunkFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChunkFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChunkFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChunkFrame& from) {
+    ChunkFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  EndpointList* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const EndpointList& from);
-  void MergeFrom(const EndpointList& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(EndpointList* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChunkFrame* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.ChunkFrame";
   }
+  protected:
+  explicit ChunkFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .lrpc.Endpoint endpoints = 1;
-  int endpoints_size() const;
-  void clear_endpoints();
-  static const int kEndpointsFieldNumber = 1;
-  const ::lrpc::Endpoint& endpoints(int index) const;
-  ::lrpc::Endpoint* mutable_endpoints(int index);
-  ::lrpc::Endpoint* add_endpoints();
-  ::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint >*
-      mutable_endpoints();
-  const ::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint >&
-      endpoints() const;
+  enum : int {
+    kDataFieldNumber = 3,
+    kTotalLenFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
-  // @@protoc_insertion_point(class_scope:lrpc.EndpointList)
- private:
+  // uint64 total_len = 2;
+  void clear_total_len();
+  uint64_t total_len() const;
+  void set_total_len(uint64_t value);
+  private:
+  uint64_t _internal_total_len() const;
+  void _internal_set_total_len(uint64_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint > endpoints_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static EndpointList* default_instance_;
+  // @@protoc_insertion_point(class_scope:lrpc.ChunkFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t total_len_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KeepaliveInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.KeepaliveInfo) */ {
+class BatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.BatchRequest) */ {
  public:
-  KeepaliveInfo();
-  virtual ~KeepaliveInfo();
-
-  KeepaliveInfo(const KeepaliveInfo& from);
+  inline BatchRequest() : BatchRequest(nullptr) {}
+  ~BatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchRequest(const BatchRequest& from);
+  BatchRequest(BatchRequest&& from) noexcept
+    : BatchRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline KeepaliveInfo& operator=(const KeepaliveInfo& from) {
+  inline BatchRequest& operator=(const BatchRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline BatchRequest& operator=(BatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const KeepaliveInfo& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchRequest*>(
+               &_BatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(KeepaliveInfo* other);
+  friend void swap(BatchRequest& a, BatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline KeepaliveInfo* New() const { return New(NULL); }
+  BatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchRequest& from) {
+    BatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  KeepaliveInfo* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const KeepaliveInfo& from);
-  void MergeFrom(const KeepaliveInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(KeepaliveInfo* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.BatchRequest";
   }
+  protected:
+  explicit BatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string serviceName = 1;
-  void clear_servicename();
-  static const int kServiceNameFieldNumber = 1;
-  const ::std::string& servicename() const;
-  void set_servicename(const ::std::string& value);
-  void set_servicename(const char* value);
-  void set_servicename(const char* value, size_t size);
-  ::std::string* mutable_servicename();
-  ::std::string* release_servicename();
-  void set_allocated_servicename(::std::string* servicename);
-
-  // optional .lrpc.Endpoint endpoint = 2;
-  bool has_endpoint() const;
-  void clear_endpoint();
-  static const int kEndpointFieldNumber = 2;
-  const ::lrpc::Endpoint& endpoint() const;
-  ::lrpc::Endpoint* mutable_endpoint();
-  ::lrpc::Endpoint* release_endpoint();
-  void set_allocated_endpoint(::lrpc::Endpoint* endpoint);
+  enum : int {
+    kRequestsFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated bytes requests = 2;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  const std::string& requests(int index) const;
+  std::string* mutable_requests(int index);
+  void set_requests(int index, const std::string& value);
+  void set_requests(int index, std::string&& value);
+  void set_requests(int index, const char* value);
+  void set_requests(int index, const void* value, size_t size);
+  std::string* add_requests();
+  void add_requests(const std::string& value);
+  void add_requests(std::string&& value);
+  void add_requests(const char* value);
+  void add_requests(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& requests() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_requests();
+  private:
+  const std::string& _internal_requests(int index) const;
+  std::string* _internal_add_requests();
+  public:
 
-  // @@protoc_insertion_point(class_scope:lrpc.KeepaliveInfo)
- private:
+  // .lrpc.Request header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::lrpc::Request& header() const;
+  PROTOBUF_NODISCARD ::lrpc::Request* release_header();
+  ::lrpc::Request* mutable_header();
+  void set_allocated_header(::lrpc::Request* header);
+  private:
+  const ::lrpc::Request& _internal_header() const;
+  ::lrpc::Request* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::lrpc::Request* header);
+  ::lrpc::Request* unsafe_arena_release_header();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr servicename_;
-  ::lrpc::Endpoint* endpoint_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
-
-  void InitAsDefaultInstance();
-  static KeepaliveInfo* default_instance_;
+  // @@protoc_insertion_point(class_scope:lrpc.BatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> requests_;
+    ::lrpc::Request* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServiceName : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.ServiceName) */ {
+class BatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.BatchResponse) */ {
  public:
-  ServiceName();
-  virtual ~ServiceName();
-
-  ServiceName(const ServiceName& from);
+  inline BatchResponse() : BatchResponse(nullptr) {}
+  ~BatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchResponse(const BatchResponse& from);
+  BatchResponse(BatchResponse&& from) noexcept
+    : BatchResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline ServiceName& operator=(const ServiceName& from) {
+  inline BatchResponse& operator=(const BatchResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline BatchResponse& operator=(BatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ServiceName& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchResponse*>(
+               &_BatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(ServiceName* other);
+  friend void swap(BatchResponse& a, BatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ServiceName* New() const { return New(NULL); }
+  BatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchResponse& from) {
+    BatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ServiceName* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ServiceName& from);
-  void MergeFrom(const ServiceName& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ServiceName* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.BatchResponse";
   }
+  protected:
+  explicit BatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string name = 1;
-  void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
-
-  // @@protoc_insertion_point(class_scope:lrpc.ServiceName)
- private:
+  enum : int {
+    kResponsesFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .lrpc.Response responses = 2;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::lrpc::Response* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Response >*
+      mutable_responses();
+  private:
+  const ::lrpc::Response& _internal_responses(int index) const;
+  ::lrpc::Response* _internal_add_responses();
+  public:
+  const ::lrpc::Response& responses(int index) const;
+  ::lrpc::Response* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Response >&
+      responses() const;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
+  // .lrpc.Response header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::lrpc::Response& header() const;
+  PROTOBUF_NODISCARD ::lrpc::Response* release_header();
+  ::lrpc::Response* mutable_header();
+  void set_allocated_header(::lrpc::Response* header);
+  private:
+  const ::lrpc::Response& _internal_header() const;
+  ::lrpc::Response* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::lrpc::Response* header);
+  ::lrpc::Response* unsafe_arena_release_header();
 
-  void InitAsDefaultInstance();
-  static ServiceName* default_instance_;
+  // @@protoc_insertion_point(class_scope:lrpc.BatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Response > responses_;
+    ::lrpc::Response* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:lrpc.Status) */ {
+class RpcMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.RpcMessage) */ {
  public:
-  Status();
-  virtual ~Status();
+  inline RpcMessage() : RpcMessage(nullptr) {}
+  ~RpcMessage() override;
+  explicit PROTOBUF_CONSTEXPR RpcMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Status(const Status& from);
+  RpcMessage(const RpcMessage& from);
+  RpcMessage(RpcMessage&& from) noexcept
+    : RpcMessage() {
+    *this = ::std::move(from);
+  }
 
-  inline Status& operator=(const Status& from) {
+  inline RpcMessage& operator=(const RpcMessage& from) {
     CopyFrom(from);
     return *this;
   }
+  inline RpcMessage& operator=(RpcMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum BodyCase {
+    kRequest = 1,
+    kResponse = 2,
+    kStream = 3,
+    kPush = 4,
+    kChunk = 5,
+    kBatchRequest = 6,
+    kBatchResponse = 7,
+    BODY_NOT_SET = 0,
+  };
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Status& default_instance();
+  static inline const RpcMessage* internal_default_instance() {
+    return reinterpret_cast<const RpcMessage*>(
+               &_RpcMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(Status* other);
+  friend void swap(RpcMessage& a, RpcMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Status* New() const { return New(NULL); }
+  RpcMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcMessage& from) {
+    RpcMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  Status* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Status& from);
-  void MergeFrom(const Status& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Status* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.RpcMessage";
   }
+  protected:
+  explicit RpcMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 result = 1;
-  void clear_result();
-  static const int kResultFieldNumber = 1;
-  ::google::protobuf::int32 result() const;
-  void set_result(::google::protobuf::int32 value);
+  enum : int {
+    kRequestFieldNumber = 1,
+    kResponseFieldNumber = 2,
+    kStreamFieldNumber = 3,
+    kPushFieldNumber = 4,
+    kChunkFieldNumber = 5,
+    kBatchRequestFieldNumber = 6,
+    kBatchResponseFieldNumber = 7,
+  };
+  // .lrpc.Request request = 1;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::lrpc::Request& request() const;
+  PROTOBUF_NODISCARD ::lrpc::Request* release_request();
+  ::lrpc::Request* mutable_request();
+  void set_allocated_request(::lrpc::Request* request);
+  private:
+  const ::lrpc::Request& _internal_request() const;
+  ::lrpc::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::lrpc::Request* request);
+  ::lrpc::Request* unsafe_arena_release_request();
 
-  // @@protoc_insertion_point(class_scope:lrpc.Status)
- private:
+  // .lrpc.Response response = 2;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::lrpc::Response& response() const;
+  PROTOBUF_NODISCARD ::lrpc::Response* release_response();
+  ::lrpc::Response* mutable_response();
+  void set_allocated_response(::lrpc::Response* response);
+  private:
+  const ::lrpc::Response& _internal_response() const;
+  ::lrpc::Response* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::lrpc::Response* response);
+  ::lrpc::Response* unsafe_arena_release_response();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int32 result_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_lrpc_2eproto();
-  friend void protobuf_AssignDesc_lrpc_2eproto();
-  friend void protobuf_ShutdownFile_lrpc_2eproto();
+  // .lrpc.StreamFrame stream = 3;
+  bool has_stream() const;
+  private:
+  bool _internal_has_stream() const;
+  public:
+  void clear_stream();
+  const ::lrpc::StreamFrame& stream() const;
+  PROTOBUF_NODISCARD ::lrpc::StreamFrame* release_stream();
+  ::lrpc::StreamFrame* mutable_stream();
+  void set_allocated_stream(::lrpc::StreamFrame* stream);
+  private:
+  const ::lrpc::StreamFrame& _internal_stream() const;
+  ::lrpc::StreamFrame* _internal_mutable_stream();
+  public:
+  void unsafe_arena_set_allocated_stream(
+      ::lrpc::StreamFrame* stream);
+  ::lrpc::StreamFrame* unsafe_arena_release_stream();
 
-  void InitAsDefaultInstance();
-  static Status* default_instance_;
-};
-// ===================================================================
+  // .lrpc.PushFrame push = 4;
+  bool has_push() const;
+  private:
+  bool _internal_has_push() const;
+  public:
+  void clear_push();
+  const ::lrpc::PushFrame& push() const;
+  PROTOBUF_NODISCARD ::lrpc::PushFrame* release_push();
+  ::lrpc::PushFrame* mutable_push();
+  void set_allocated_push(::lrpc::PushFrame* push);
+  private:
+  const ::lrpc::PushFrame& _internal_push() const;
+  ::lrpc::PushFrame* _internal_mutable_push();
+  public:
+  void unsafe_arena_set_allocated_push(
+      ::lrpc::PushFrame* push);
+  ::lrpc::PushFrame* unsafe_arena_release_push();
 
-class NameService_Stub;
+  // .lrpc.ChunkFrame chunk = 5;
+  bool has_chunk() const;
+  private:
+  bool _internal_has_chunk() const;
+  public:
+  void clear_chunk();
+  const ::lrpc::ChunkFrame& chunk() const;
+  PROTOBUF_NODISCARD ::lrpc::ChunkFrame* release_chunk();
+  ::lrpc::ChunkFrame* mutable_chunk();
+  void set_allocated_chunk(::lrpc::ChunkFrame* chunk);
+  private:
+  const ::lrpc::ChunkFrame& _internal_chunk() const;
+  ::lrpc::ChunkFrame* _internal_mutable_chunk();
+  public:
+  void unsafe_arena_set_allocated_chunk(
+      ::lrpc::ChunkFrame* chunk);
+  ::lrpc::ChunkFrame* unsafe_arena_release_chunk();
 
-class NameService : public ::google::protobuf::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline NameService() {};
- public:
-  virtual ~NameService();
+  // .lrpc.BatchRequest batch_request = 6;
+  bool has_batch_request() const;
+  private:
+  bool _internal_has_batch_request() const;
+  public:
+  void clear_batch_request();
+  const ::lrpc::BatchRequest& batch_request() const;
+  PROTOBUF_NODISCARD ::lrpc::BatchRequest* release_batch_request();
+  ::lrpc::BatchRequest* mutable_batch_request();
+  void set_allocated_batch_request(::lrpc::BatchRequest* batch_request);
+  private:
+  const ::lrpc::BatchRequest& _internal_batch_request() const;
+  ::lrpc::BatchRequest* _internal_mutable_batch_request();
+  public:
+  void unsafe_arena_set_allocated_batch_request(
+      ::lrpc::BatchRequest* batch_request);
+  ::lrpc::BatchRequest* unsafe_arena_release_batch_request();
 
-  typedef NameService_Stub Stub;
+  // .lrpc.BatchResponse batch_response = 7;
+  bool has_batch_response() const;
+  private:
+  bool _internal_has_batch_response() const;
+  public:
+  void clear_batch_response();
+  const ::lrpc::BatchResponse& batch_response() const;
+  PROTOBUF_NODISCARD ::lrpc::BatchResponse* release_batch_response();
+  ::lrpc::BatchResponse* mutable_batch_response();
+  void set_allocated_batch_response(::lrpc::BatchResponse* batch_response);
+  private:
+  const ::lrpc::BatchResponse& _internal_batch_response() const;
+  ::lrpc::BatchResponse* _internal_mutable_batch_response();
+  public:
+  void unsafe_arena_set_allocated_batch_response(
+      ::lrpc::BatchResponse* batch_response);
+  ::lrpc::BatchResponse* unsafe_arena_release_batch_response();
 
-  static const ::google::protobuf::ServiceDescriptor* descriptor();
+  void clear_Body();
+  BodyCase Body_case() const;
+  // @@protoc_insertion_point(class_scope:lrpc.RpcMessage)
+ private:
+  class _Internal;
+  void set_has_request();
+  void set_has_response();
+  void set_has_stream();
+  void set_has_push();
+  void set_has_chunk();
+  void set_has_batch_request();
+  void set_has_batch_response();
 
-  virtual void GetEndpoints(::google::protobuf::RpcController* controller,
-                       const ::lrpc::ServiceName* request,
-                       ::lrpc::EndpointList* response,
-                       ::google::protobuf::Closure* done);
-  virtual void Keepalive(::google::protobuf::RpcController* controller,
-                       const ::lrpc::KeepaliveInfo* request,
-                       ::lrpc::Status* response,
-                       ::google::protobuf::Closure* done);
+  inline bool has_Body() const;
+  inline void clear_has_Body();
 
-  // implements Service ----------------------------------------------
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union BodyUnion {
+      constexpr BodyUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::lrpc::Request* request_;
+      ::lrpc::Response* response_;
+      ::lrpc::StreamFrame* stream_;
+      ::lrpc::PushFrame* push_;
+      ::lrpc::ChunkFrame* chunk_;
+      ::lrpc::BatchRequest* batch_request_;
+      ::lrpc::BatchResponse* batch_response_;
+    } Body_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
-  const ::google::protobuf::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                  ::google::protobuf::RpcController* controller,
-                  const ::google::protobuf::Message* request,
-                  ::google::protobuf::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::google::protobuf::Message& GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
-  const ::google::protobuf::Message& GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Endpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.Endpoint) */ {
+ public:
+  inline Endpoint() : Endpoint(nullptr) {}
+  ~Endpoint() override;
+  explicit PROTOBUF_CONSTEXPR Endpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Endpoint(const Endpoint& from);
+  Endpoint(Endpoint&& from) noexcept
+    : Endpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline Endpoint& operator=(const Endpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Endpoint& operator=(Endpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Endpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Endpoint* internal_default_instance() {
+    return reinterpret_cast<const Endpoint*>(
+               &_Endpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(Endpoint& a, Endpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Endpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Endpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Endpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Endpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Endpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Endpoint& from) {
+    Endpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Endpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.Endpoint";
+  }
+  protected:
+  explicit Endpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 1,
+    kPortFieldNumber = 2,
+    kWeightFieldNumber = 3,
+  };
+  // string ip = 1;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // int32 port = 2;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
 
+  // int32 weight = 3;
+  void clear_weight();
+  int32_t weight() const;
+  void set_weight(int32_t value);
+  private:
+  int32_t _internal_weight() const;
+  void _internal_set_weight(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lrpc.Endpoint)
  private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(NameService);
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t port_;
+    int32_t weight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
+// -------------------------------------------------------------------
 
-class NameService_Stub : public NameService {
+class EndpointList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.EndpointList) */ {
  public:
-  NameService_Stub(::google::protobuf::RpcChannel* channel);
-  NameService_Stub(::google::protobuf::RpcChannel* channel,
-                   ::google::protobuf::Service::ChannelOwnership ownership);
-  ~NameService_Stub();
+  inline EndpointList() : EndpointList(nullptr) {}
+  ~EndpointList() override;
+  explicit PROTOBUF_CONSTEXPR EndpointList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
+  EndpointList(const EndpointList& from);
+  EndpointList(EndpointList&& from) noexcept
+    : EndpointList() {
+    *this = ::std::move(from);
+  }
 
-  // implements NameService ------------------------------------------
+  inline EndpointList& operator=(const EndpointList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EndpointList& operator=(EndpointList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  void GetEndpoints(::google::protobuf::RpcController* controller,
-                       const ::lrpc::ServiceName* request,
-                       ::lrpc::EndpointList* response,
-                       ::google::protobuf::Closure* done);
-  void Keepalive(::google::protobuf::RpcController* controller,
-                       const ::lrpc::KeepaliveInfo* request,
-                       ::lrpc::Status* response,
-                       ::google::protobuf::Closure* done);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EndpointList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EndpointList* internal_default_instance() {
+    return reinterpret_cast<const EndpointList*>(
+               &_EndpointList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(EndpointList& a, EndpointList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EndpointList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EndpointList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EndpointList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EndpointList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EndpointList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EndpointList& from) {
+    EndpointList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EndpointList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.EndpointList";
+  }
+  protected:
+  explicit EndpointList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEndpointsFieldNumber = 1,
+  };
+  // repeated .lrpc.Endpoint endpoints = 1;
+  int endpoints_size() const;
+  private:
+  int _internal_endpoints_size() const;
+  public:
+  void clear_endpoints();
+  ::lrpc::Endpoint* mutable_endpoints(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Endpoint >*
+      mutable_endpoints();
+  private:
+  const ::lrpc::Endpoint& _internal_endpoints(int index) const;
+  ::lrpc::Endpoint* _internal_add_endpoints();
+  public:
+  const ::lrpc::Endpoint& endpoints(int index) const;
+  ::lrpc::Endpoint* add_endpoints();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Endpoint >&
+      endpoints() const;
+
+  // @@protoc_insertion_point(class_scope:lrpc.EndpointList)
  private:
-  ::google::protobuf::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(NameService_Stub);
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Endpoint > endpoints_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeepaliveInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.KeepaliveInfo) */ {
+ public:
+  inline KeepaliveInfo() : KeepaliveInfo(nullptr) {}
+  ~KeepaliveInfo() override;
+  explicit PROTOBUF_CONSTEXPR KeepaliveInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeepaliveInfo(const KeepaliveInfo& from);
+  KeepaliveInfo(KeepaliveInfo&& from) noexcept
+    : KeepaliveInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline KeepaliveInfo& operator=(const KeepaliveInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeepaliveInfo& operator=(KeepaliveInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepaliveInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepaliveInfo* internal_default_instance() {
+    return reinterpret_cast<const KeepaliveInfo*>(
+               &_KeepaliveInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(KeepaliveInfo& a, KeepaliveInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepaliveInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepaliveInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeepaliveInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepaliveInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepaliveInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepaliveInfo& from) {
+    KeepaliveInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepaliveInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.KeepaliveInfo";
+  }
+  protected:
+  explicit KeepaliveInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kEndpointFieldNumber = 2,
+  };
+  // string serviceName = 1;
+  void clear_servicename();
+  const std::string& servicename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_servicename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_servicename();
+  PROTOBUF_NODISCARD std::string* release_servicename();
+  void set_allocated_servicename(std::string* servicename);
+  private:
+  const std::string& _internal_servicename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_servicename(const std::string& value);
+  std::string* _internal_mutable_servicename();
+  public:
+
+  // .lrpc.Endpoint endpoint = 2;
+  bool has_endpoint() const;
+  private:
+  bool _internal_has_endpoint() const;
+  public:
+  void clear_endpoint();
+  const ::lrpc::Endpoint& endpoint() const;
+  PROTOBUF_NODISCARD ::lrpc::Endpoint* release_endpoint();
+  ::lrpc::Endpoint* mutable_endpoint();
+  void set_allocated_endpoint(::lrpc::Endpoint* endpoint);
+  private:
+  const ::lrpc::Endpoint& _internal_endpoint() const;
+  ::lrpc::Endpoint* _internal_mutable_endpoint();
+  public:
+  void unsafe_arena_set_allocated_endpoint(
+      ::lrpc::Endpoint* endpoint);
+  ::lrpc::Endpoint* unsafe_arena_release_endpoint();
+
+  // @@protoc_insertion_point(class_scope:lrpc.KeepaliveInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr servicename_;
+    ::lrpc::Endpoint* endpoint_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
 };
+// -------------------------------------------------------------------
+
+class ServiceName final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.ServiceName) */ {
+ public:
+  inline ServiceName() : ServiceName(nullptr) {}
+  ~ServiceName() override;
+  explicit PROTOBUF_CONSTEXPR ServiceName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServiceName(const ServiceName& from);
+  ServiceName(ServiceName&& from) noexcept
+    : ServiceName() {
+    *this = ::std::move(from);
+  }
+
+  inline ServiceName& operator=(const ServiceName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServiceName& operator=(ServiceName&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServiceName& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServiceName* internal_default_instance() {
+    return reinterpret_cast<const ServiceName*>(
+               &_ServiceName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ServiceName& a, ServiceName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServiceName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServiceName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServiceName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServiceName>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServiceName& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServiceName& from) {
+    ServiceName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServiceName* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.ServiceName";
+  }
+  protected:
+  explicit ServiceName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:lrpc.ServiceName)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Status final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lrpc.Status) */ {
+ public:
+  inline Status() : Status(nullptr) {}
+  ~Status() override;
+  explicit PROTOBUF_CONSTEXPR Status(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Status(const Status& from);
+  Status(Status&& from) noexcept
+    : Status() {
+    *this = ::std::move(from);
+  }
+
+  inline Status& operator=(const Status& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Status& operator=(Status&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Status& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Status* internal_default_instance() {
+    return reinterpret_cast<const Status*>(
+               &_Status_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(Status& a, Status& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Status* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Status* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Status* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Status>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Status& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Status& from) {
+    Status::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Status* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lrpc.Status";
+  }
+  protected:
+  explicit Status(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 1,
+  };
+  // int32 result = 1;
+  void clear_result();
+  int32_t result() const;
+  void set_result(int32_t value);
+  private:
+  int32_t _internal_result() const;
+  void _internal_set_result(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lrpc.Status)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lrpc_2eproto;
+};
+// ===================================================================
+
+class NameService_Stub;
+
+class NameService : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline NameService() {};
+ public:
+  virtual ~NameService();
+
+  typedef NameService_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void GetEndpoints(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::lrpc::ServiceName* request,
+                       ::lrpc::EndpointList* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Keepalive(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::lrpc::KeepaliveInfo* request,
+                       ::lrpc::Status* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(NameService);
+};
+
+class NameService_Stub : public NameService {
+ public:
+  NameService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  NameService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~NameService_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements NameService ------------------------------------------
+
+  void GetEndpoints(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::lrpc::ServiceName* request,
+                       ::lrpc::EndpointList* response,
+                       ::google::protobuf::Closure* done);
+  void Keepalive(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::lrpc::KeepaliveInfo* request,
+                       ::lrpc::Status* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(NameService_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Request
+
+// int32 id = 1;
+inline void Request::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t Request::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Request::id() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.id)
+  return _internal_id();
+}
+inline void Request::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Request::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.id)
+}
+
+// string service_name = 2;
+inline void Request::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
+}
+inline const std::string& Request::service_name() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.service_name)
+  return _internal_service_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Request.service_name)
+}
+inline std::string* Request::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:lrpc.Request.service_name)
+  return _s;
+}
+inline const std::string& Request::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void Request::_internal_set_service_name(const std::string& value) {
+  
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_service_name() {
+  
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_service_name() {
+  // @@protoc_insertion_point(field_release:lrpc.Request.service_name)
+  return _impl_.service_name_.Release();
+}
+inline void Request::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.service_name)
+}
+
+// string method_name = 3;
+inline void Request::clear_method_name() {
+  _impl_.method_name_.ClearToEmpty();
+}
+inline const std::string& Request::method_name() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.method_name)
+  return _internal_method_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Request.method_name)
+}
+inline std::string* Request::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
+  // @@protoc_insertion_point(field_mutable:lrpc.Request.method_name)
+  return _s;
+}
+inline const std::string& Request::_internal_method_name() const {
+  return _impl_.method_name_.Get();
+}
+inline void Request::_internal_set_method_name(const std::string& value) {
+  
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_method_name() {
+  
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_method_name() {
+  // @@protoc_insertion_point(field_release:lrpc.Request.method_name)
+  return _impl_.method_name_.Release();
+}
+inline void Request::set_allocated_method_name(std::string* method_name) {
+  if (method_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.method_name)
+}
+
+// bytes serialized_request = 4;
+inline void Request::clear_serialized_request() {
+  _impl_.serialized_request_.ClearToEmpty();
+}
+inline const std::string& Request::serialized_request() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.serialized_request)
+  return _internal_serialized_request();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_serialized_request(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.serialized_request_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Request.serialized_request)
+}
+inline std::string* Request::mutable_serialized_request() {
+  std::string* _s = _internal_mutable_serialized_request();
+  // @@protoc_insertion_point(field_mutable:lrpc.Request.serialized_request)
+  return _s;
+}
+inline const std::string& Request::_internal_serialized_request() const {
+  return _impl_.serialized_request_.Get();
+}
+inline void Request::_internal_set_serialized_request(const std::string& value) {
+  
+  _impl_.serialized_request_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_serialized_request() {
+  
+  return _impl_.serialized_request_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_serialized_request() {
+  // @@protoc_insertion_point(field_release:lrpc.Request.serialized_request)
+  return _impl_.serialized_request_.Release();
+}
+inline void Request::set_allocated_serialized_request(std::string* serialized_request) {
+  if (serialized_request != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.serialized_request_.SetAllocated(serialized_request, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.serialized_request_.IsDefault()) {
+    _impl_.serialized_request_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.serialized_request)
+}
+
+// int64 timeout_ms = 5;
+inline void Request::clear_timeout_ms() {
+  _impl_.timeout_ms_ = int64_t{0};
+}
+inline int64_t Request::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline int64_t Request::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void Request::_internal_set_timeout_ms(int64_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void Request::set_timeout_ms(int64_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.timeout_ms)
+}
+
+// int64 deadline_us = 6;
+inline void Request::clear_deadline_us() {
+  _impl_.deadline_us_ = int64_t{0};
+}
+inline int64_t Request::_internal_deadline_us() const {
+  return _impl_.deadline_us_;
+}
+inline int64_t Request::deadline_us() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.deadline_us)
+  return _internal_deadline_us();
+}
+inline void Request::_internal_set_deadline_us(int64_t value) {
+  
+  _impl_.deadline_us_ = value;
+}
+inline void Request::set_deadline_us(int64_t value) {
+  _internal_set_deadline_us(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.deadline_us)
+}
+
+// uint32 accept_compress = 7;
+inline void Request::clear_accept_compress() {
+  _impl_.accept_compress_ = 0u;
+}
+inline uint32_t Request::_internal_accept_compress() const {
+  return _impl_.accept_compress_;
+}
+inline uint32_t Request::accept_compress() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.accept_compress)
+  return _internal_accept_compress();
+}
+inline void Request::_internal_set_accept_compress(uint32_t value) {
+  
+  _impl_.accept_compress_ = value;
+}
+inline void Request::set_accept_compress(uint32_t value) {
+  _internal_set_accept_compress(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.accept_compress)
+}
+
+// uint32 compress_dict = 8;
+inline void Request::clear_compress_dict() {
+  _impl_.compress_dict_ = 0u;
+}
+inline uint32_t Request::_internal_compress_dict() const {
+  return _impl_.compress_dict_;
+}
+inline uint32_t Request::compress_dict() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.compress_dict)
+  return _internal_compress_dict();
+}
+inline void Request::_internal_set_compress_dict(uint32_t value) {
+  
+  _impl_.compress_dict_ = value;
+}
+inline void Request::set_compress_dict(uint32_t value) {
+  _internal_set_compress_dict(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.compress_dict)
+}
+
+// .lrpc.Priority priority = 9;
+inline void Request::clear_priority() {
+  _impl_.priority_ = 0;
+}
+inline ::lrpc::Priority Request::_internal_priority() const {
+  return static_cast< ::lrpc::Priority >(_impl_.priority_);
+}
+inline ::lrpc::Priority Request::priority() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.priority)
+  return _internal_priority();
+}
+inline void Request::_internal_set_priority(::lrpc::Priority value) {
+  
+  _impl_.priority_ = value;
+}
+inline void Request::set_priority(::lrpc::Priority value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.priority)
+}
+
+// bool oneway = 10;
+inline void Request::clear_oneway() {
+  _impl_.oneway_ = false;
+}
+inline bool Request::_internal_oneway() const {
+  return _impl_.oneway_;
+}
+inline bool Request::oneway() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.oneway)
+  return _internal_oneway();
+}
+inline void Request::_internal_set_oneway(bool value) {
+  
+  _impl_.oneway_ = value;
+}
+inline void Request::set_oneway(bool value) {
+  _internal_set_oneway(value);
+  // @@protoc_insertion_point(field_set:lrpc.Request.oneway)
+}
+
+// bytes attachment = 11;
+inline void Request::clear_attachment() {
+  _impl_.attachment_.ClearToEmpty();
+}
+inline const std::string& Request::attachment() const {
+  // @@protoc_insertion_point(field_get:lrpc.Request.attachment)
+  return _internal_attachment();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_attachment(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.attachment_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Request.attachment)
+}
+inline std::string* Request::mutable_attachment() {
+  std::string* _s = _internal_mutable_attachment();
+  // @@protoc_insertion_point(field_mutable:lrpc.Request.attachment)
+  return _s;
+}
+inline const std::string& Request::_internal_attachment() const {
+  return _impl_.attachment_.Get();
+}
+inline void Request::_internal_set_attachment(const std::string& value) {
+  
+  _impl_.attachment_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_attachment() {
+  
+  return _impl_.attachment_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_attachment() {
+  // @@protoc_insertion_point(field_release:lrpc.Request.attachment)
+  return _impl_.attachment_.Release();
+}
+inline void Request::set_allocated_attachment(std::string* attachment) {
+  if (attachment != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.attachment_.SetAllocated(attachment, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attachment_.IsDefault()) {
+    _impl_.attachment_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.attachment)
+}
+
+// -------------------------------------------------------------------
+
+// Error
+
+// int32 errnum = 1;
+inline void Error::clear_errnum() {
+  _impl_.errnum_ = 0;
+}
+inline int32_t Error::_internal_errnum() const {
+  return _impl_.errnum_;
+}
+inline int32_t Error::errnum() const {
+  // @@protoc_insertion_point(field_get:lrpc.Error.errnum)
+  return _internal_errnum();
+}
+inline void Error::_internal_set_errnum(int32_t value) {
+  
+  _impl_.errnum_ = value;
+}
+inline void Error::set_errnum(int32_t value) {
+  _internal_set_errnum(value);
+  // @@protoc_insertion_point(field_set:lrpc.Error.errnum)
+}
+
+// string msg = 2;
+inline void Error::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+}
+inline const std::string& Error::msg() const {
+  // @@protoc_insertion_point(field_get:lrpc.Error.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Error::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Error.msg)
+}
+inline std::string* Error::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:lrpc.Error.msg)
+  return _s;
+}
+inline const std::string& Error::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void Error::_internal_set_msg(const std::string& value) {
+  
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Error::_internal_mutable_msg() {
+  
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Error::release_msg() {
+  // @@protoc_insertion_point(field_release:lrpc.Error.msg)
+  return _impl_.msg_.Release();
+}
+inline void Error::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Error.msg)
+}
+
+// -------------------------------------------------------------------
+
+// Response
+
+// int32 id = 1;
+inline void Response::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t Response::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Response::id() const {
+  // @@protoc_insertion_point(field_get:lrpc.Response.id)
+  return _internal_id();
+}
+inline void Response::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Response::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:lrpc.Response.id)
+}
+
+// bytes serialized_response = 2;
+inline bool Response::_internal_has_serialized_response() const {
+  return Body_case() == kSerializedResponse;
+}
+inline bool Response::has_serialized_response() const {
+  return _internal_has_serialized_response();
+}
+inline void Response::set_has_serialized_response() {
+  _impl_._oneof_case_[0] = kSerializedResponse;
+}
+inline void Response::clear_serialized_response() {
+  if (_internal_has_serialized_response()) {
+    _impl_.Body_.serialized_response_.Destroy();
+    clear_has_Body();
+  }
+}
+inline const std::string& Response::serialized_response() const {
+  // @@protoc_insertion_point(field_get:lrpc.Response.serialized_response)
+  return _internal_serialized_response();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Response::set_serialized_response(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_serialized_response()) {
+    clear_Body();
+    set_has_serialized_response();
+    _impl_.Body_.serialized_response_.InitDefault();
+  }
+  _impl_.Body_.serialized_response_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Response.serialized_response)
+}
+inline std::string* Response::mutable_serialized_response() {
+  std::string* _s = _internal_mutable_serialized_response();
+  // @@protoc_insertion_point(field_mutable:lrpc.Response.serialized_response)
+  return _s;
+}
+inline const std::string& Response::_internal_serialized_response() const {
+  if (_internal_has_serialized_response()) {
+    return _impl_.Body_.serialized_response_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Response::_internal_set_serialized_response(const std::string& value) {
+  if (!_internal_has_serialized_response()) {
+    clear_Body();
+    set_has_serialized_response();
+    _impl_.Body_.serialized_response_.InitDefault();
+  }
+  _impl_.Body_.serialized_response_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_serialized_response() {
+  if (!_internal_has_serialized_response()) {
+    clear_Body();
+    set_has_serialized_response();
+    _impl_.Body_.serialized_response_.InitDefault();
+  }
+  return _impl_.Body_.serialized_response_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Response::release_serialized_response() {
+  // @@protoc_insertion_point(field_release:lrpc.Response.serialized_response)
+  if (_internal_has_serialized_response()) {
+    clear_has_Body();
+    return _impl_.Body_.serialized_response_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::set_allocated_serialized_response(std::string* serialized_response) {
+  if (has_Body()) {
+    clear_Body();
+  }
+  if (serialized_response != nullptr) {
+    set_has_serialized_response();
+    _impl_.Body_.serialized_response_.InitAllocated(serialized_response, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.serialized_response)
+}
+
+// .lrpc.Error error = 3;
+inline bool Response::_internal_has_error() const {
+  return Body_case() == kError;
+}
+inline bool Response::has_error() const {
+  return _internal_has_error();
+}
+inline void Response::set_has_error() {
+  _impl_._oneof_case_[0] = kError;
+}
+inline void Response::clear_error() {
+  if (_internal_has_error()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.error_;
+    }
+    clear_has_Body();
+  }
+}
+inline ::lrpc::Error* Response::release_error() {
+  // @@protoc_insertion_point(field_release:lrpc.Response.error)
+  if (_internal_has_error()) {
+    clear_has_Body();
+    ::lrpc::Error* temp = _impl_.Body_.error_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.error_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::lrpc::Error& Response::_internal_error() const {
+  return _internal_has_error()
+      ? *_impl_.Body_.error_
+      : reinterpret_cast< ::lrpc::Error&>(::lrpc::_Error_default_instance_);
+}
+inline const ::lrpc::Error& Response::error() const {
+  // @@protoc_insertion_point(field_get:lrpc.Response.error)
+  return _internal_error();
+}
+inline ::lrpc::Error* Response::unsafe_arena_release_error() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.Response.error)
+  if (_internal_has_error()) {
+    clear_has_Body();
+    ::lrpc::Error* temp = _impl_.Body_.error_;
+    _impl_.Body_.error_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_error(::lrpc::Error* error) {
+  clear_Body();
+  if (error) {
+    set_has_error();
+    _impl_.Body_.error_ = error;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.Response.error)
+}
+inline ::lrpc::Error* Response::_internal_mutable_error() {
+  if (!_internal_has_error()) {
+    clear_Body();
+    set_has_error();
+    _impl_.Body_.error_ = CreateMaybeMessage< ::lrpc::Error >(GetArenaForAllocation());
+  }
+  return _impl_.Body_.error_;
+}
+inline ::lrpc::Error* Response::mutable_error() {
+  ::lrpc::Error* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:lrpc.Response.error)
+  return _msg;
+}
+
+// uint32 accept_compress = 4;
+inline void Response::clear_accept_compress() {
+  _impl_.accept_compress_ = 0u;
+}
+inline uint32_t Response::_internal_accept_compress() const {
+  return _impl_.accept_compress_;
+}
+inline uint32_t Response::accept_compress() const {
+  // @@protoc_insertion_point(field_get:lrpc.Response.accept_compress)
+  return _internal_accept_compress();
+}
+inline void Response::_internal_set_accept_compress(uint32_t value) {
+  
+  _impl_.accept_compress_ = value;
+}
+inline void Response::set_accept_compress(uint32_t value) {
+  _internal_set_accept_compress(value);
+  // @@protoc_insertion_point(field_set:lrpc.Response.accept_compress)
+}
+
+// uint32 compress_dict = 5;
+inline void Response::clear_compress_dict() {
+  _impl_.compress_dict_ = 0u;
+}
+inline uint32_t Response::_internal_compress_dict() const {
+  return _impl_.compress_dict_;
+}
+inline uint32_t Response::compress_dict() const {
+  // @@protoc_insertion_point(field_get:lrpc.Response.compress_dict)
+  return _internal_compress_dict();
+}
+inline void Response::_internal_set_compress_dict(uint32_t value) {
+  
+  _impl_.compress_dict_ = value;
+}
+inline void Response::set_compress_dict(uint32_t value) {
+  _internal_set_compress_dict(value);
+  // @@protoc_insertion_point(field_set:lrpc.Response.compress_dict)
+}
+
+// bytes attachment = 6;
+inline void Response::clear_attachment() {
+  _impl_.attachment_.ClearToEmpty();
+}
+inline const std::string& Response::attachment() const {
+  // @@protoc_insertion_point(field_get:lrpc.Response.attachment)
+  return _internal_attachment();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_attachment(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.attachment_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.Response.attachment)
+}
+inline std::string* Response::mutable_attachment() {
+  std::string* _s = _internal_mutable_attachment();
+  // @@protoc_insertion_point(field_mutable:lrpc.Response.attachment)
+  return _s;
+}
+inline const std::string& Response::_internal_attachment() const {
+  return _impl_.attachment_.Get();
+}
+inline void Response::_internal_set_attachment(const std::string& value) {
+  
+  _impl_.attachment_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_attachment() {
+  
+  return _impl_.attachment_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_attachment() {
+  // @@protoc_insertion_point(field_release:lrpc.Response.attachment)
+  return _impl_.attachment_.Release();
+}
+inline void Response::set_allocated_attachment(std::string* attachment) {
+  if (attachment != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.attachment_.SetAllocated(attachment, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attachment_.IsDefault()) {
+    _impl_.attachment_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.attachment)
+}
+
+inline bool Response::has_Body() const {
+  return Body_case() != BODY_NOT_SET;
+}
+inline void Response::clear_has_Body() {
+  _impl_._oneof_case_[0] = BODY_NOT_SET;
+}
+inline Response::BodyCase Response::Body_case() const {
+  return Response::BodyCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// StreamFrame
+
+// int32 id = 1;
+inline void StreamFrame::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t StreamFrame::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t StreamFrame::id() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.id)
+  return _internal_id();
+}
+inline void StreamFrame::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void StreamFrame::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:lrpc.StreamFrame.id)
+}
+
+// .lrpc.StreamFrame.Type type = 2;
+inline void StreamFrame::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::lrpc::StreamFrame_Type StreamFrame::_internal_type() const {
+  return static_cast< ::lrpc::StreamFrame_Type >(_impl_.type_);
+}
+inline ::lrpc::StreamFrame_Type StreamFrame::type() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.type)
+  return _internal_type();
+}
+inline void StreamFrame::_internal_set_type(::lrpc::StreamFrame_Type value) {
+  
+  _impl_.type_ = value;
+}
+inline void StreamFrame::set_type(::lrpc::StreamFrame_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:lrpc.StreamFrame.type)
+}
+
+// string service_name = 3;
+inline void StreamFrame::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
+}
+inline const std::string& StreamFrame::service_name() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.service_name)
+  return _internal_service_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamFrame::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.StreamFrame.service_name)
+}
+inline std::string* StreamFrame::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:lrpc.StreamFrame.service_name)
+  return _s;
+}
+inline const std::string& StreamFrame::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void StreamFrame::_internal_set_service_name(const std::string& value) {
+  
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamFrame::_internal_mutable_service_name() {
+  
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamFrame::release_service_name() {
+  // @@protoc_insertion_point(field_release:lrpc.StreamFrame.service_name)
+  return _impl_.service_name_.Release();
+}
+inline void StreamFrame::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.StreamFrame.service_name)
+}
+
+// string method_name = 4;
+inline void StreamFrame::clear_method_name() {
+  _impl_.method_name_.ClearToEmpty();
+}
+inline const std::string& StreamFrame::method_name() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.method_name)
+  return _internal_method_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamFrame::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.StreamFrame.method_name)
+}
+inline std::string* StreamFrame::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
+  // @@protoc_insertion_point(field_mutable:lrpc.StreamFrame.method_name)
+  return _s;
+}
+inline const std::string& StreamFrame::_internal_method_name() const {
+  return _impl_.method_name_.Get();
+}
+inline void StreamFrame::_internal_set_method_name(const std::string& value) {
+  
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamFrame::_internal_mutable_method_name() {
+  
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamFrame::release_method_name() {
+  // @@protoc_insertion_point(field_release:lrpc.StreamFrame.method_name)
+  return _impl_.method_name_.Release();
+}
+inline void StreamFrame::set_allocated_method_name(std::string* method_name) {
+  if (method_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.StreamFrame.method_name)
+}
 
+// bytes payload = 5;
+inline void StreamFrame::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+}
+inline const std::string& StreamFrame::payload() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StreamFrame::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.StreamFrame.payload)
+}
+inline std::string* StreamFrame::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:lrpc.StreamFrame.payload)
+  return _s;
+}
+inline const std::string& StreamFrame::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void StreamFrame::_internal_set_payload(const std::string& value) {
+  
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StreamFrame::_internal_mutable_payload() {
+  
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StreamFrame::release_payload() {
+  // @@protoc_insertion_point(field_release:lrpc.StreamFrame.payload)
+  return _impl_.payload_.Release();
+}
+inline void StreamFrame::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.StreamFrame.payload)
+}
 
-// ===================================================================
+// uint32 credit = 6;
+inline void StreamFrame::clear_credit() {
+  _impl_.credit_ = 0u;
+}
+inline uint32_t StreamFrame::_internal_credit() const {
+  return _impl_.credit_;
+}
+inline uint32_t StreamFrame::credit() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.credit)
+  return _internal_credit();
+}
+inline void StreamFrame::_internal_set_credit(uint32_t value) {
+  
+  _impl_.credit_ = value;
+}
+inline void StreamFrame::set_credit(uint32_t value) {
+  _internal_set_credit(value);
+  // @@protoc_insertion_point(field_set:lrpc.StreamFrame.credit)
+}
 
+// .lrpc.Error error = 7;
+inline bool StreamFrame::_internal_has_error() const {
+  return this != internal_default_instance() && _impl_.error_ != nullptr;
+}
+inline bool StreamFrame::has_error() const {
+  return _internal_has_error();
+}
+inline void StreamFrame::clear_error() {
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+}
+inline const ::lrpc::Error& StreamFrame::_internal_error() const {
+  const ::lrpc::Error* p = _impl_.error_;
+  return p != nullptr ? *p : reinterpret_cast<const ::lrpc::Error&>(
+      ::lrpc::_Error_default_instance_);
+}
+inline const ::lrpc::Error& StreamFrame::error() const {
+  // @@protoc_insertion_point(field_get:lrpc.StreamFrame.error)
+  return _internal_error();
+}
+inline void StreamFrame::unsafe_arena_set_allocated_error(
+    ::lrpc::Error* error) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.error_);
+  }
+  _impl_.error_ = error;
+  if (error) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.StreamFrame.error)
+}
+inline ::lrpc::Error* StreamFrame::release_error() {
+  
+  ::lrpc::Error* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::lrpc::Error* StreamFrame::unsafe_arena_release_error() {
+  // @@protoc_insertion_point(field_release:lrpc.StreamFrame.error)
+  
+  ::lrpc::Error* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+  return temp;
+}
+inline ::lrpc::Error* StreamFrame::_internal_mutable_error() {
+  
+  if (_impl_.error_ == nullptr) {
+    auto* p = CreateMaybeMessage<::lrpc::Error>(GetArenaForAllocation());
+    _impl_.error_ = p;
+  }
+  return _impl_.error_;
+}
+inline ::lrpc::Error* StreamFrame::mutable_error() {
+  ::lrpc::Error* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:lrpc.StreamFrame.error)
+  return _msg;
+}
+inline void StreamFrame::set_allocated_error(::lrpc::Error* error) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.error_;
+  }
+  if (error) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(error);
+    if (message_arena != submessage_arena) {
+      error = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, error, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.error_ = error;
+  // @@protoc_insertion_point(field_set_allocated:lrpc.StreamFrame.error)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
-// Request
+// PushFrame
 
-// optional int32 id = 1;
-inline void Request::clear_id() {
-  id_ = 0;
+// .lrpc.PushFrame.Type type = 1;
+inline void PushFrame::clear_type() {
+  _impl_.type_ = 0;
 }
-inline ::google::protobuf::int32 Request::id() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.id)
-  return id_;
+inline ::lrpc::PushFrame_Type PushFrame::_internal_type() const {
+  return static_cast< ::lrpc::PushFrame_Type >(_impl_.type_);
+}
+inline ::lrpc::PushFrame_Type PushFrame::type() const {
+  // @@protoc_insertion_point(field_get:lrpc.PushFrame.type)
+  return _internal_type();
 }
-inline void Request::set_id(::google::protobuf::int32 value) {
+inline void PushFrame::_internal_set_type(::lrpc::PushFrame_Type value) {
   
-  id_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Request.id)
+  _impl_.type_ = value;
+}
+inline void PushFrame::set_type(::lrpc::PushFrame_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:lrpc.PushFrame.type)
 }
 
-// optional string service_name = 2;
-inline void Request::clear_service_name() {
-  service_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string service_name = 2;
+inline void PushFrame::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
 }
-inline const ::std::string& Request::service_name() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.service_name)
-  return service_name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& PushFrame::service_name() const {
+  // @@protoc_insertion_point(field_get:lrpc.PushFrame.service_name)
+  return _internal_service_name();
 }
-inline void Request::set_service_name(const ::std::string& value) {
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Request.service_name)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PushFrame::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.PushFrame.service_name)
 }
-inline void Request::set_service_name(const char* value) {
+inline std::string* PushFrame::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:lrpc.PushFrame.service_name)
+  return _s;
+}
+inline const std::string& PushFrame::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void PushFrame::_internal_set_service_name(const std::string& value) {
   
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Request.service_name)
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
-inline void Request::set_service_name(const char* value, size_t size) {
+inline std::string* PushFrame::_internal_mutable_service_name() {
   
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Request.service_name)
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PushFrame::release_service_name() {
+  // @@protoc_insertion_point(field_release:lrpc.PushFrame.service_name)
+  return _impl_.service_name_.Release();
+}
+inline void PushFrame::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.PushFrame.service_name)
+}
+
+// string topic = 3;
+inline void PushFrame::clear_topic() {
+  _impl_.topic_.ClearToEmpty();
+}
+inline const std::string& PushFrame::topic() const {
+  // @@protoc_insertion_point(field_get:lrpc.PushFrame.topic)
+  return _internal_topic();
 }
-inline ::std::string* Request::mutable_service_name() {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PushFrame::set_topic(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.topic_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.PushFrame.topic)
+}
+inline std::string* PushFrame::mutable_topic() {
+  std::string* _s = _internal_mutable_topic();
+  // @@protoc_insertion_point(field_mutable:lrpc.PushFrame.topic)
+  return _s;
+}
+inline const std::string& PushFrame::_internal_topic() const {
+  return _impl_.topic_.Get();
+}
+inline void PushFrame::_internal_set_topic(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:lrpc.Request.service_name)
-  return service_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.topic_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Request::release_service_name() {
-  // @@protoc_insertion_point(field_release:lrpc.Request.service_name)
+inline std::string* PushFrame::_internal_mutable_topic() {
   
-  return service_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.topic_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PushFrame::release_topic() {
+  // @@protoc_insertion_point(field_release:lrpc.PushFrame.topic)
+  return _impl_.topic_.Release();
 }
-inline void Request::set_allocated_service_name(::std::string* service_name) {
-  if (service_name != NULL) {
+inline void PushFrame::set_allocated_topic(std::string* topic) {
+  if (topic != nullptr) {
     
   } else {
     
   }
-  service_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), service_name);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.service_name)
+  _impl_.topic_.SetAllocated(topic, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.topic_.IsDefault()) {
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.PushFrame.topic)
 }
 
-// optional string method_name = 3;
-inline void Request::clear_method_name() {
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes payload = 4;
+inline void PushFrame::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
 }
-inline const ::std::string& Request::method_name() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.method_name)
-  return method_name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& PushFrame::payload() const {
+  // @@protoc_insertion_point(field_get:lrpc.PushFrame.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PushFrame::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.PushFrame.payload)
+}
+inline std::string* PushFrame::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:lrpc.PushFrame.payload)
+  return _s;
 }
-inline void Request::set_method_name(const ::std::string& value) {
+inline const std::string& PushFrame::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void PushFrame::_internal_set_payload(const std::string& value) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Request.method_name)
+  _impl_.payload_.Set(value, GetArenaForAllocation());
 }
-inline void Request::set_method_name(const char* value) {
+inline std::string* PushFrame::_internal_mutable_payload() {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Request.method_name)
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PushFrame::release_payload() {
+  // @@protoc_insertion_point(field_release:lrpc.PushFrame.payload)
+  return _impl_.payload_.Release();
+}
+inline void PushFrame::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.PushFrame.payload)
+}
+
+// -------------------------------------------------------------------
+
+// ChunkFrame
+
+// uint32 id = 1;
+inline void ChunkFrame::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t ChunkFrame::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t ChunkFrame::id() const {
+  // @@protoc_insertion_point(field_get:lrpc.ChunkFrame.id)
+  return _internal_id();
 }
-inline void Request::set_method_name(const char* value, size_t size) {
+inline void ChunkFrame::_internal_set_id(uint32_t value) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Request.method_name)
+  _impl_.id_ = value;
+}
+inline void ChunkFrame::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:lrpc.ChunkFrame.id)
+}
+
+// uint64 total_len = 2;
+inline void ChunkFrame::clear_total_len() {
+  _impl_.total_len_ = uint64_t{0u};
+}
+inline uint64_t ChunkFrame::_internal_total_len() const {
+  return _impl_.total_len_;
 }
-inline ::std::string* Request::mutable_method_name() {
+inline uint64_t ChunkFrame::total_len() const {
+  // @@protoc_insertion_point(field_get:lrpc.ChunkFrame.total_len)
+  return _internal_total_len();
+}
+inline void ChunkFrame::_internal_set_total_len(uint64_t value) {
   
-  // @@protoc_insertion_point(field_mutable:lrpc.Request.method_name)
-  return method_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.total_len_ = value;
 }
-inline ::std::string* Request::release_method_name() {
-  // @@protoc_insertion_point(field_release:lrpc.Request.method_name)
+inline void ChunkFrame::set_total_len(uint64_t value) {
+  _internal_set_total_len(value);
+  // @@protoc_insertion_point(field_set:lrpc.ChunkFrame.total_len)
+}
+
+// bytes data = 3;
+inline void ChunkFrame::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ChunkFrame::data() const {
+  // @@protoc_insertion_point(field_get:lrpc.ChunkFrame.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChunkFrame::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lrpc.ChunkFrame.data)
+}
+inline std::string* ChunkFrame::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:lrpc.ChunkFrame.data)
+  return _s;
+}
+inline const std::string& ChunkFrame::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ChunkFrame::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChunkFrame::_internal_mutable_data() {
   
-  return method_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline void Request::set_allocated_method_name(::std::string* method_name) {
-  if (method_name != NULL) {
+inline std::string* ChunkFrame::release_data() {
+  // @@protoc_insertion_point(field_release:lrpc.ChunkFrame.data)
+  return _impl_.data_.Release();
+}
+inline void ChunkFrame::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  method_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.method_name)
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lrpc.ChunkFrame.data)
 }
 
-// optional bytes serialized_request = 4;
-inline void Request::clear_serialized_request() {
-  serialized_request_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// BatchRequest
+
+// .lrpc.Request header = 1;
+inline bool BatchRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline const ::std::string& Request::serialized_request() const {
-  // @@protoc_insertion_point(field_get:lrpc.Request.serialized_request)
-  return serialized_request_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool BatchRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void BatchRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::lrpc::Request& BatchRequest::_internal_header() const {
+  const ::lrpc::Request* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::lrpc::Request&>(
+      ::lrpc::_Request_default_instance_);
+}
+inline const ::lrpc::Request& BatchRequest::header() const {
+  // @@protoc_insertion_point(field_get:lrpc.BatchRequest.header)
+  return _internal_header();
 }
-inline void Request::set_serialized_request(const ::std::string& value) {
+inline void BatchRequest::unsafe_arena_set_allocated_header(
+    ::lrpc::Request* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.BatchRequest.header)
+}
+inline ::lrpc::Request* BatchRequest::release_header() {
   
-  serialized_request_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Request.serialized_request)
+  ::lrpc::Request* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::lrpc::Request* BatchRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:lrpc.BatchRequest.header)
+  
+  ::lrpc::Request* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline void Request::set_serialized_request(const char* value) {
+inline ::lrpc::Request* BatchRequest::_internal_mutable_header() {
   
-  serialized_request_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Request.serialized_request)
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::lrpc::Request>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::lrpc::Request* BatchRequest::mutable_header() {
+  ::lrpc::Request* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:lrpc.BatchRequest.header)
+  return _msg;
+}
+inline void BatchRequest::set_allocated_header(::lrpc::Request* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:lrpc.BatchRequest.header)
+}
+
+// repeated bytes requests = 2;
+inline int BatchRequest::_internal_requests_size() const {
+  return _impl_.requests_.size();
+}
+inline int BatchRequest::requests_size() const {
+  return _internal_requests_size();
+}
+inline void BatchRequest::clear_requests() {
+  _impl_.requests_.Clear();
+}
+inline std::string* BatchRequest::add_requests() {
+  std::string* _s = _internal_add_requests();
+  // @@protoc_insertion_point(field_add_mutable:lrpc.BatchRequest.requests)
+  return _s;
+}
+inline const std::string& BatchRequest::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const std::string& BatchRequest::requests(int index) const {
+  // @@protoc_insertion_point(field_get:lrpc.BatchRequest.requests)
+  return _internal_requests(index);
+}
+inline std::string* BatchRequest::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:lrpc.BatchRequest.requests)
+  return _impl_.requests_.Mutable(index);
+}
+inline void BatchRequest::set_requests(int index, const std::string& value) {
+  _impl_.requests_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:lrpc.BatchRequest.requests)
+}
+inline void BatchRequest::set_requests(int index, std::string&& value) {
+  _impl_.requests_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:lrpc.BatchRequest.requests)
+}
+inline void BatchRequest::set_requests(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.requests_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:lrpc.BatchRequest.requests)
+}
+inline void BatchRequest::set_requests(int index, const void* value, size_t size) {
+  _impl_.requests_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lrpc.BatchRequest.requests)
+}
+inline std::string* BatchRequest::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline void BatchRequest::add_requests(const std::string& value) {
+  _impl_.requests_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:lrpc.BatchRequest.requests)
+}
+inline void BatchRequest::add_requests(std::string&& value) {
+  _impl_.requests_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:lrpc.BatchRequest.requests)
+}
+inline void BatchRequest::add_requests(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.requests_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:lrpc.BatchRequest.requests)
+}
+inline void BatchRequest::add_requests(const void* value, size_t size) {
+  _impl_.requests_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:lrpc.BatchRequest.requests)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRequest::requests() const {
+  // @@protoc_insertion_point(field_list:lrpc.BatchRequest.requests)
+  return _impl_.requests_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRequest::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:lrpc.BatchRequest.requests)
+  return &_impl_.requests_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchResponse
+
+// .lrpc.Response header = 1;
+inline bool BatchResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool BatchResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void BatchResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::lrpc::Response& BatchResponse::_internal_header() const {
+  const ::lrpc::Response* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::lrpc::Response&>(
+      ::lrpc::_Response_default_instance_);
 }
-inline void Request::set_serialized_request(const void* value, size_t size) {
+inline const ::lrpc::Response& BatchResponse::header() const {
+  // @@protoc_insertion_point(field_get:lrpc.BatchResponse.header)
+  return _internal_header();
+}
+inline void BatchResponse::unsafe_arena_set_allocated_header(
+    ::lrpc::Response* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.BatchResponse.header)
+}
+inline ::lrpc::Response* BatchResponse::release_header() {
   
-  serialized_request_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Request.serialized_request)
+  ::lrpc::Response* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* Request::mutable_serialized_request() {
+inline ::lrpc::Response* BatchResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:lrpc.BatchResponse.header)
   
-  // @@protoc_insertion_point(field_mutable:lrpc.Request.serialized_request)
-  return serialized_request_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::lrpc::Response* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline ::std::string* Request::release_serialized_request() {
-  // @@protoc_insertion_point(field_release:lrpc.Request.serialized_request)
+inline ::lrpc::Response* BatchResponse::_internal_mutable_header() {
   
-  return serialized_request_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::lrpc::Response>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::lrpc::Response* BatchResponse::mutable_header() {
+  ::lrpc::Response* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:lrpc.BatchResponse.header)
+  return _msg;
 }
-inline void Request::set_allocated_serialized_request(::std::string* serialized_request) {
-  if (serialized_request != NULL) {
+inline void BatchResponse::set_allocated_header(::lrpc::Response* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  serialized_request_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), serialized_request);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Request.serialized_request)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:lrpc.BatchResponse.header)
+}
+
+// repeated .lrpc.Response responses = 2;
+inline int BatchResponse::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int BatchResponse::responses_size() const {
+  return _internal_responses_size();
+}
+inline void BatchResponse::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::lrpc::Response* BatchResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:lrpc.BatchResponse.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Response >*
+BatchResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:lrpc.BatchResponse.responses)
+  return &_impl_.responses_;
+}
+inline const ::lrpc::Response& BatchResponse::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::lrpc::Response& BatchResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:lrpc.BatchResponse.responses)
+  return _internal_responses(index);
+}
+inline ::lrpc::Response* BatchResponse::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::lrpc::Response* BatchResponse::add_responses() {
+  ::lrpc::Response* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:lrpc.BatchResponse.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Response >&
+BatchResponse::responses() const {
+  // @@protoc_insertion_point(field_list:lrpc.BatchResponse.responses)
+  return _impl_.responses_;
 }
 
 // -------------------------------------------------------------------
 
-// Error
+// RpcMessage
 
-// optional int32 errnum = 1;
-inline void Error::clear_errnum() {
-  errnum_ = 0;
+// .lrpc.Request request = 1;
+inline bool RpcMessage::_internal_has_request() const {
+  return Body_case() == kRequest;
 }
-inline ::google::protobuf::int32 Error::errnum() const {
-  // @@protoc_insertion_point(field_get:lrpc.Error.errnum)
-  return errnum_;
+inline bool RpcMessage::has_request() const {
+  return _internal_has_request();
 }
-inline void Error::set_errnum(::google::protobuf::int32 value) {
-  
-  errnum_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Error.errnum)
+inline void RpcMessage::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void RpcMessage::clear_request() {
+  if (_internal_has_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.request_;
+    }
+    clear_has_Body();
+  }
+}
+inline ::lrpc::Request* RpcMessage::release_request() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.request)
+  if (_internal_has_request()) {
+    clear_has_Body();
+    ::lrpc::Request* temp = _impl_.Body_.request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::lrpc::Request& RpcMessage::_internal_request() const {
+  return _internal_has_request()
+      ? *_impl_.Body_.request_
+      : reinterpret_cast< ::lrpc::Request&>(::lrpc::_Request_default_instance_);
+}
+inline const ::lrpc::Request& RpcMessage::request() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.request)
+  return _internal_request();
+}
+inline ::lrpc::Request* RpcMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.request)
+  if (_internal_has_request()) {
+    clear_has_Body();
+    ::lrpc::Request* temp = _impl_.Body_.request_;
+    _impl_.Body_.request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void RpcMessage::unsafe_arena_set_allocated_request(::lrpc::Request* request) {
+  clear_Body();
+  if (request) {
+    set_has_request();
+    _impl_.Body_.request_ = request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.request)
+}
+inline ::lrpc::Request* RpcMessage::_internal_mutable_request() {
+  if (!_internal_has_request()) {
+    clear_Body();
+    set_has_request();
+    _impl_.Body_.request_ = CreateMaybeMessage< ::lrpc::Request >(GetArenaForAllocation());
+  }
+  return _impl_.Body_.request_;
+}
+inline ::lrpc::Request* RpcMessage::mutable_request() {
+  ::lrpc::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.request)
+  return _msg;
 }
 
-// optional string msg = 2;
-inline void Error::clear_msg() {
-  msg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .lrpc.Response response = 2;
+inline bool RpcMessage::_internal_has_response() const {
+  return Body_case() == kResponse;
 }
-inline const ::std::string& Error::msg() const {
-  // @@protoc_insertion_point(field_get:lrpc.Error.msg)
-  return msg_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool RpcMessage::has_response() const {
+  return _internal_has_response();
 }
-inline void Error::set_msg(const ::std::string& value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Error.msg)
+inline void RpcMessage::set_has_response() {
+  _impl_._oneof_case_[0] = kResponse;
 }
-inline void Error::set_msg(const char* value) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Error.msg)
+inline void RpcMessage::clear_response() {
+  if (_internal_has_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.response_;
+    }
+    clear_has_Body();
+  }
 }
-inline void Error::set_msg(const char* value, size_t size) {
-  
-  msg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Error.msg)
+inline ::lrpc::Response* RpcMessage::release_response() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.response)
+  if (_internal_has_response()) {
+    clear_has_Body();
+    ::lrpc::Response* temp = _impl_.Body_.response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::std::string* Error::mutable_msg() {
-  
-  // @@protoc_insertion_point(field_mutable:lrpc.Error.msg)
-  return msg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::lrpc::Response& RpcMessage::_internal_response() const {
+  return _internal_has_response()
+      ? *_impl_.Body_.response_
+      : reinterpret_cast< ::lrpc::Response&>(::lrpc::_Response_default_instance_);
 }
-inline ::std::string* Error::release_msg() {
-  // @@protoc_insertion_point(field_release:lrpc.Error.msg)
-  
-  return msg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::lrpc::Response& RpcMessage::response() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.response)
+  return _internal_response();
 }
-inline void Error::set_allocated_msg(::std::string* msg) {
-  if (msg != NULL) {
-    
+inline ::lrpc::Response* RpcMessage::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.response)
+  if (_internal_has_response()) {
+    clear_has_Body();
+    ::lrpc::Response* temp = _impl_.Body_.response_;
+    _impl_.Body_.response_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  msg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), msg);
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Error.msg)
 }
-
-// -------------------------------------------------------------------
-
-// Response
-
-// optional int32 id = 1;
-inline void Response::clear_id() {
-  id_ = 0;
+inline void RpcMessage::unsafe_arena_set_allocated_response(::lrpc::Response* response) {
+  clear_Body();
+  if (response) {
+    set_has_response();
+    _impl_.Body_.response_ = response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.response)
 }
-inline ::google::protobuf::int32 Response::id() const {
-  // @@protoc_insertion_point(field_get:lrpc.Response.id)
-  return id_;
+inline ::lrpc::Response* RpcMessage::_internal_mutable_response() {
+  if (!_internal_has_response()) {
+    clear_Body();
+    set_has_response();
+    _impl_.Body_.response_ = CreateMaybeMessage< ::lrpc::Response >(GetArenaForAllocation());
+  }
+  return _impl_.Body_.response_;
 }
-inline void Response::set_id(::google::protobuf::int32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:lrpc.Response.id)
+inline ::lrpc::Response* RpcMessage::mutable_response() {
+  ::lrpc::Response* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.response)
+  return _msg;
 }
 
-// optional bytes serialized_response = 2;
-inline bool Response::has_serialized_response() const {
-  return Body_case() == kSerializedResponse;
+// .lrpc.StreamFrame stream = 3;
+inline bool RpcMessage::_internal_has_stream() const {
+  return Body_case() == kStream;
 }
-inline void Response::set_has_serialized_response() {
-  _oneof_case_[0] = kSerializedResponse;
+inline bool RpcMessage::has_stream() const {
+  return _internal_has_stream();
 }
-inline void Response::clear_serialized_response() {
-  if (has_serialized_response()) {
-    Body_.serialized_response_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RpcMessage::set_has_stream() {
+  _impl_._oneof_case_[0] = kStream;
+}
+inline void RpcMessage::clear_stream() {
+  if (_internal_has_stream()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.stream_;
+    }
     clear_has_Body();
   }
 }
-inline const ::std::string& Response::serialized_response() const {
-  // @@protoc_insertion_point(field_get:lrpc.Response.serialized_response)
-  if (has_serialized_response()) {
-    return Body_.serialized_response_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::lrpc::StreamFrame* RpcMessage::release_stream() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.stream)
+  if (_internal_has_stream()) {
+    clear_has_Body();
+    ::lrpc::StreamFrame* temp = _impl_.Body_.stream_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.stream_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
 }
-inline void Response::set_serialized_response(const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:lrpc.Response.serialized_response)
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::lrpc::StreamFrame& RpcMessage::_internal_stream() const {
+  return _internal_has_stream()
+      ? *_impl_.Body_.stream_
+      : reinterpret_cast< ::lrpc::StreamFrame&>(::lrpc::_StreamFrame_default_instance_);
+}
+inline const ::lrpc::StreamFrame& RpcMessage::stream() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.stream)
+  return _internal_stream();
+}
+inline ::lrpc::StreamFrame* RpcMessage::unsafe_arena_release_stream() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.stream)
+  if (_internal_has_stream()) {
+    clear_has_Body();
+    ::lrpc::StreamFrame* temp = _impl_.Body_.stream_;
+    _impl_.Body_.stream_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  Body_.serialized_response_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:lrpc.Response.serialized_response)
 }
-inline void Response::set_serialized_response(const char* value) {
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RpcMessage::unsafe_arena_set_allocated_stream(::lrpc::StreamFrame* stream) {
+  clear_Body();
+  if (stream) {
+    set_has_stream();
+    _impl_.Body_.stream_ = stream;
   }
-  Body_.serialized_response_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Response.serialized_response)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.stream)
 }
-inline void Response::set_serialized_response(const void* value, size_t size) {
-  if (!has_serialized_response()) {
+inline ::lrpc::StreamFrame* RpcMessage::_internal_mutable_stream() {
+  if (!_internal_has_stream()) {
     clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    set_has_stream();
+    _impl_.Body_.stream_ = CreateMaybeMessage< ::lrpc::StreamFrame >(GetArenaForAllocation());
   }
-  Body_.serialized_response_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Response.serialized_response)
+  return _impl_.Body_.stream_;
 }
-inline ::std::string* Response::mutable_serialized_response() {
-  if (!has_serialized_response()) {
-    clear_Body();
-    set_has_serialized_response();
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::lrpc::StreamFrame* RpcMessage::mutable_stream() {
+  ::lrpc::StreamFrame* _msg = _internal_mutable_stream();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.stream)
+  return _msg;
+}
+
+// .lrpc.PushFrame push = 4;
+inline bool RpcMessage::_internal_has_push() const {
+  return Body_case() == kPush;
+}
+inline bool RpcMessage::has_push() const {
+  return _internal_has_push();
+}
+inline void RpcMessage::set_has_push() {
+  _impl_._oneof_case_[0] = kPush;
+}
+inline void RpcMessage::clear_push() {
+  if (_internal_has_push()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.push_;
+    }
+    clear_has_Body();
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.Response.serialized_response)
-  return Body_.serialized_response_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Response::release_serialized_response() {
-  // @@protoc_insertion_point(field_release:lrpc.Response.serialized_response)
-  if (has_serialized_response()) {
+inline ::lrpc::PushFrame* RpcMessage::release_push() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.push)
+  if (_internal_has_push()) {
     clear_has_Body();
-    return Body_.serialized_response_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    ::lrpc::PushFrame* temp = _impl_.Body_.push_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.push_ = nullptr;
+    return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void Response::set_allocated_serialized_response(::std::string* serialized_response) {
-  if (!has_serialized_response()) {
-    Body_.serialized_response_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::lrpc::PushFrame& RpcMessage::_internal_push() const {
+  return _internal_has_push()
+      ? *_impl_.Body_.push_
+      : reinterpret_cast< ::lrpc::PushFrame&>(::lrpc::_PushFrame_default_instance_);
+}
+inline const ::lrpc::PushFrame& RpcMessage::push() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.push)
+  return _internal_push();
+}
+inline ::lrpc::PushFrame* RpcMessage::unsafe_arena_release_push() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.push)
+  if (_internal_has_push()) {
+    clear_has_Body();
+    ::lrpc::PushFrame* temp = _impl_.Body_.push_;
+    _impl_.Body_.push_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
+}
+inline void RpcMessage::unsafe_arena_set_allocated_push(::lrpc::PushFrame* push) {
   clear_Body();
-  if (serialized_response != NULL) {
-    set_has_serialized_response();
-    Body_.serialized_response_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        serialized_response);
+  if (push) {
+    set_has_push();
+    _impl_.Body_.push_ = push;
   }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.serialized_response)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.push)
+}
+inline ::lrpc::PushFrame* RpcMessage::_internal_mutable_push() {
+  if (!_internal_has_push()) {
+    clear_Body();
+    set_has_push();
+    _impl_.Body_.push_ = CreateMaybeMessage< ::lrpc::PushFrame >(GetArenaForAllocation());
+  }
+  return _impl_.Body_.push_;
+}
+inline ::lrpc::PushFrame* RpcMessage::mutable_push() {
+  ::lrpc::PushFrame* _msg = _internal_mutable_push();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.push)
+  return _msg;
 }
 
-// optional .lrpc.Error error = 3;
-inline bool Response::has_error() const {
-  return Body_case() == kError;
+// .lrpc.ChunkFrame chunk = 5;
+inline bool RpcMessage::_internal_has_chunk() const {
+  return Body_case() == kChunk;
 }
-inline void Response::set_has_error() {
-  _oneof_case_[0] = kError;
+inline bool RpcMessage::has_chunk() const {
+  return _internal_has_chunk();
 }
-inline void Response::clear_error() {
-  if (has_error()) {
-    delete Body_.error_;
+inline void RpcMessage::set_has_chunk() {
+  _impl_._oneof_case_[0] = kChunk;
+}
+inline void RpcMessage::clear_chunk() {
+  if (_internal_has_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.chunk_;
+    }
     clear_has_Body();
   }
 }
-inline  const ::lrpc::Error& Response::error() const {
-  // @@protoc_insertion_point(field_get:lrpc.Response.error)
-  return has_error()
-      ? *Body_.error_
-      : ::lrpc::Error::default_instance();
-}
-inline ::lrpc::Error* Response::mutable_error() {
-  if (!has_error()) {
-    clear_Body();
-    set_has_error();
-    Body_.error_ = new ::lrpc::Error;
+inline ::lrpc::ChunkFrame* RpcMessage::release_chunk() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.chunk)
+  if (_internal_has_chunk()) {
+    clear_has_Body();
+    ::lrpc::ChunkFrame* temp = _impl_.Body_.chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.Response.error)
-  return Body_.error_;
 }
-inline ::lrpc::Error* Response::release_error() {
-  // @@protoc_insertion_point(field_release:lrpc.Response.error)
-  if (has_error()) {
+inline const ::lrpc::ChunkFrame& RpcMessage::_internal_chunk() const {
+  return _internal_has_chunk()
+      ? *_impl_.Body_.chunk_
+      : reinterpret_cast< ::lrpc::ChunkFrame&>(::lrpc::_ChunkFrame_default_instance_);
+}
+inline const ::lrpc::ChunkFrame& RpcMessage::chunk() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.chunk)
+  return _internal_chunk();
+}
+inline ::lrpc::ChunkFrame* RpcMessage::unsafe_arena_release_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.chunk)
+  if (_internal_has_chunk()) {
     clear_has_Body();
-    ::lrpc::Error* temp = Body_.error_;
-    Body_.error_ = NULL;
+    ::lrpc::ChunkFrame* temp = _impl_.Body_.chunk_;
+    _impl_.Body_.chunk_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void Response::set_allocated_error(::lrpc::Error* error) {
+inline void RpcMessage::unsafe_arena_set_allocated_chunk(::lrpc::ChunkFrame* chunk) {
   clear_Body();
-  if (error) {
-    set_has_error();
-    Body_.error_ = error;
+  if (chunk) {
+    set_has_chunk();
+    _impl_.Body_.chunk_ = chunk;
   }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.Response.error)
-}
-
-inline bool Response::has_Body() const {
-  return Body_case() != BODY_NOT_SET;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.chunk)
 }
-inline void Response::clear_has_Body() {
-  _oneof_case_[0] = BODY_NOT_SET;
+inline ::lrpc::ChunkFrame* RpcMessage::_internal_mutable_chunk() {
+  if (!_internal_has_chunk()) {
+    clear_Body();
+    set_has_chunk();
+    _impl_.Body_.chunk_ = CreateMaybeMessage< ::lrpc::ChunkFrame >(GetArenaForAllocation());
+  }
+  return _impl_.Body_.chunk_;
 }
-inline Response::BodyCase Response::Body_case() const {
-  return Response::BodyCase(_oneof_case_[0]);
+inline ::lrpc::ChunkFrame* RpcMessage::mutable_chunk() {
+  ::lrpc::ChunkFrame* _msg = _internal_mutable_chunk();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.chunk)
+  return _msg;
 }
-// -------------------------------------------------------------------
-
-// RpcMessage
 
-// optional .lrpc.Request request = 1;
-inline bool RpcMessage::has_request() const {
-  return Body_case() == kRequest;
+// .lrpc.BatchRequest batch_request = 6;
+inline bool RpcMessage::_internal_has_batch_request() const {
+  return Body_case() == kBatchRequest;
 }
-inline void RpcMessage::set_has_request() {
-  _oneof_case_[0] = kRequest;
+inline bool RpcMessage::has_batch_request() const {
+  return _internal_has_batch_request();
 }
-inline void RpcMessage::clear_request() {
-  if (has_request()) {
-    delete Body_.request_;
+inline void RpcMessage::set_has_batch_request() {
+  _impl_._oneof_case_[0] = kBatchRequest;
+}
+inline void RpcMessage::clear_batch_request() {
+  if (_internal_has_batch_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.batch_request_;
+    }
     clear_has_Body();
   }
 }
-inline  const ::lrpc::Request& RpcMessage::request() const {
-  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.request)
-  return has_request()
-      ? *Body_.request_
-      : ::lrpc::Request::default_instance();
-}
-inline ::lrpc::Request* RpcMessage::mutable_request() {
-  if (!has_request()) {
-    clear_Body();
-    set_has_request();
-    Body_.request_ = new ::lrpc::Request;
+inline ::lrpc::BatchRequest* RpcMessage::release_batch_request() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.batch_request)
+  if (_internal_has_batch_request()) {
+    clear_has_Body();
+    ::lrpc::BatchRequest* temp = _impl_.Body_.batch_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.batch_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.request)
-  return Body_.request_;
 }
-inline ::lrpc::Request* RpcMessage::release_request() {
-  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.request)
-  if (has_request()) {
+inline const ::lrpc::BatchRequest& RpcMessage::_internal_batch_request() const {
+  return _internal_has_batch_request()
+      ? *_impl_.Body_.batch_request_
+      : reinterpret_cast< ::lrpc::BatchRequest&>(::lrpc::_BatchRequest_default_instance_);
+}
+inline const ::lrpc::BatchRequest& RpcMessage::batch_request() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.batch_request)
+  return _internal_batch_request();
+}
+inline ::lrpc::BatchRequest* RpcMessage::unsafe_arena_release_batch_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.batch_request)
+  if (_internal_has_batch_request()) {
     clear_has_Body();
-    ::lrpc::Request* temp = Body_.request_;
-    Body_.request_ = NULL;
+    ::lrpc::BatchRequest* temp = _impl_.Body_.batch_request_;
+    _impl_.Body_.batch_request_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void RpcMessage::set_allocated_request(::lrpc::Request* request) {
+inline void RpcMessage::unsafe_arena_set_allocated_batch_request(::lrpc::BatchRequest* batch_request) {
   clear_Body();
-  if (request) {
-    set_has_request();
-    Body_.request_ = request;
+  if (batch_request) {
+    set_has_batch_request();
+    _impl_.Body_.batch_request_ = batch_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.batch_request)
+}
+inline ::lrpc::BatchRequest* RpcMessage::_internal_mutable_batch_request() {
+  if (!_internal_has_batch_request()) {
+    clear_Body();
+    set_has_batch_request();
+    _impl_.Body_.batch_request_ = CreateMaybeMessage< ::lrpc::BatchRequest >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.request)
+  return _impl_.Body_.batch_request_;
+}
+inline ::lrpc::BatchRequest* RpcMessage::mutable_batch_request() {
+  ::lrpc::BatchRequest* _msg = _internal_mutable_batch_request();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.batch_request)
+  return _msg;
 }
 
-// optional .lrpc.Response response = 2;
-inline bool RpcMessage::has_response() const {
-  return Body_case() == kResponse;
+// .lrpc.BatchResponse batch_response = 7;
+inline bool RpcMessage::_internal_has_batch_response() const {
+  return Body_case() == kBatchResponse;
 }
-inline void RpcMessage::set_has_response() {
-  _oneof_case_[0] = kResponse;
+inline bool RpcMessage::has_batch_response() const {
+  return _internal_has_batch_response();
 }
-inline void RpcMessage::clear_response() {
-  if (has_response()) {
-    delete Body_.response_;
+inline void RpcMessage::set_has_batch_response() {
+  _impl_._oneof_case_[0] = kBatchResponse;
+}
+inline void RpcMessage::clear_batch_response() {
+  if (_internal_has_batch_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.Body_.batch_response_;
+    }
     clear_has_Body();
   }
 }
-inline  const ::lrpc::Response& RpcMessage::response() const {
-  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.response)
-  return has_response()
-      ? *Body_.response_
-      : ::lrpc::Response::default_instance();
-}
-inline ::lrpc::Response* RpcMessage::mutable_response() {
-  if (!has_response()) {
-    clear_Body();
-    set_has_response();
-    Body_.response_ = new ::lrpc::Response;
+inline ::lrpc::BatchResponse* RpcMessage::release_batch_response() {
+  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.batch_response)
+  if (_internal_has_batch_response()) {
+    clear_has_Body();
+    ::lrpc::BatchResponse* temp = _impl_.Body_.batch_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.Body_.batch_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.response)
-  return Body_.response_;
 }
-inline ::lrpc::Response* RpcMessage::release_response() {
-  // @@protoc_insertion_point(field_release:lrpc.RpcMessage.response)
-  if (has_response()) {
+inline const ::lrpc::BatchResponse& RpcMessage::_internal_batch_response() const {
+  return _internal_has_batch_response()
+      ? *_impl_.Body_.batch_response_
+      : reinterpret_cast< ::lrpc::BatchResponse&>(::lrpc::_BatchResponse_default_instance_);
+}
+inline const ::lrpc::BatchResponse& RpcMessage::batch_response() const {
+  // @@protoc_insertion_point(field_get:lrpc.RpcMessage.batch_response)
+  return _internal_batch_response();
+}
+inline ::lrpc::BatchResponse* RpcMessage::unsafe_arena_release_batch_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:lrpc.RpcMessage.batch_response)
+  if (_internal_has_batch_response()) {
     clear_has_Body();
-    ::lrpc::Response* temp = Body_.response_;
-    Body_.response_ = NULL;
+    ::lrpc::BatchResponse* temp = _impl_.Body_.batch_response_;
+    _impl_.Body_.batch_response_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void RpcMessage::set_allocated_response(::lrpc::Response* response) {
+inline void RpcMessage::unsafe_arena_set_allocated_batch_response(::lrpc::BatchResponse* batch_response) {
   clear_Body();
-  if (response) {
-    set_has_response();
-    Body_.response_ = response;
+  if (batch_response) {
+    set_has_batch_response();
+    _impl_.Body_.batch_response_ = batch_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.RpcMessage.batch_response)
+}
+inline ::lrpc::BatchResponse* RpcMessage::_internal_mutable_batch_response() {
+  if (!_internal_has_batch_response()) {
+    clear_Body();
+    set_has_batch_response();
+    _impl_.Body_.batch_response_ = CreateMaybeMessage< ::lrpc::BatchResponse >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_set_allocated:lrpc.RpcMessage.response)
+  return _impl_.Body_.batch_response_;
+}
+inline ::lrpc::BatchResponse* RpcMessage::mutable_batch_response() {
+  ::lrpc::BatchResponse* _msg = _internal_mutable_batch_response();
+  // @@protoc_insertion_point(field_mutable:lrpc.RpcMessage.batch_response)
+  return _msg;
 }
 
 inline bool RpcMessage::has_Body() const {
   return Body_case() != BODY_NOT_SET;
 }
 inline void RpcMessage::clear_has_Body() {
-  _oneof_case_[0] = BODY_NOT_SET;
+  _impl_._oneof_case_[0] = BODY_NOT_SET;
 }
 inline RpcMessage::BodyCase RpcMessage::Body_case() const {
-  return RpcMessage::BodyCase(_oneof_case_[0]);
+  return RpcMessage::BodyCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
 // Endpoint
 
-// optional string ip = 1;
+// string ip = 1;
 inline void Endpoint::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.ip_.ClearToEmpty();
 }
-inline const ::std::string& Endpoint::ip() const {
+inline const std::string& Endpoint::ip() const {
   // @@protoc_insertion_point(field_get:lrpc.Endpoint.ip)
-  return ip_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_ip();
 }
-inline void Endpoint::set_ip(const ::std::string& value) {
-  
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Endpoint::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:lrpc.Endpoint.ip)
 }
-inline void Endpoint::set_ip(const char* value) {
-  
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.Endpoint.ip)
+inline std::string* Endpoint::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:lrpc.Endpoint.ip)
+  return _s;
 }
-inline void Endpoint::set_ip(const char* value, size_t size) {
+inline const std::string& Endpoint::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void Endpoint::_internal_set_ip(const std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.Endpoint.ip)
+  _impl_.ip_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Endpoint::mutable_ip() {
+inline std::string* Endpoint::_internal_mutable_ip() {
   
-  // @@protoc_insertion_point(field_mutable:lrpc.Endpoint.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Endpoint::release_ip() {
+inline std::string* Endpoint::release_ip() {
   // @@protoc_insertion_point(field_release:lrpc.Endpoint.ip)
-  
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.ip_.Release();
 }
-inline void Endpoint::set_allocated_ip(::std::string* ip) {
-  if (ip != NULL) {
+inline void Endpoint::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:lrpc.Endpoint.ip)
 }
 
-// optional int32 port = 2;
+// int32 port = 2;
 inline void Endpoint::clear_port() {
-  port_ = 0;
+  _impl_.port_ = 0;
 }
-inline ::google::protobuf::int32 Endpoint::port() const {
+inline int32_t Endpoint::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t Endpoint::port() const {
   // @@protoc_insertion_point(field_get:lrpc.Endpoint.port)
-  return port_;
+  return _internal_port();
 }
-inline void Endpoint::set_port(::google::protobuf::int32 value) {
+inline void Endpoint::_internal_set_port(int32_t value) {
   
-  port_ = value;
+  _impl_.port_ = value;
+}
+inline void Endpoint::set_port(int32_t value) {
+  _internal_set_port(value);
   // @@protoc_insertion_point(field_set:lrpc.Endpoint.port)
 }
 
+// int32 weight = 3;
+inline void Endpoint::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline int32_t Endpoint::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline int32_t Endpoint::weight() const {
+  // @@protoc_insertion_point(field_get:lrpc.Endpoint.weight)
+  return _internal_weight();
+}
+inline void Endpoint::_internal_set_weight(int32_t value) {
+  
+  _impl_.weight_ = value;
+}
+inline void Endpoint::set_weight(int32_t value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:lrpc.Endpoint.weight)
+}
+
 // -------------------------------------------------------------------
 
 // EndpointList
 
 // repeated .lrpc.Endpoint endpoints = 1;
+inline int EndpointList::_internal_endpoints_size() const {
+  return _impl_.endpoints_.size();
+}
 inline int EndpointList::endpoints_size() const {
-  return endpoints_.size();
+  return _internal_endpoints_size();
 }
 inline void EndpointList::clear_endpoints() {
-  endpoints_.Clear();
+  _impl_.endpoints_.Clear();
+}
+inline ::lrpc::Endpoint* EndpointList::mutable_endpoints(int index) {
+  // @@protoc_insertion_point(field_mutable:lrpc.EndpointList.endpoints)
+  return _impl_.endpoints_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Endpoint >*
+EndpointList::mutable_endpoints() {
+  // @@protoc_insertion_point(field_mutable_list:lrpc.EndpointList.endpoints)
+  return &_impl_.endpoints_;
+}
+inline const ::lrpc::Endpoint& EndpointList::_internal_endpoints(int index) const {
+  return _impl_.endpoints_.Get(index);
 }
 inline const ::lrpc::Endpoint& EndpointList::endpoints(int index) const {
   // @@protoc_insertion_point(field_get:lrpc.EndpointList.endpoints)
-  return endpoints_.Get(index);
+  return _internal_endpoints(index);
 }
-inline ::lrpc::Endpoint* EndpointList::mutable_endpoints(int index) {
-  // @@protoc_insertion_point(field_mutable:lrpc.EndpointList.endpoints)
-  return endpoints_.Mutable(index);
+inline ::lrpc::Endpoint* EndpointList::_internal_add_endpoints() {
+  return _impl_.endpoints_.Add();
 }
 inline ::lrpc::Endpoint* EndpointList::add_endpoints() {
+  ::lrpc::Endpoint* _add = _internal_add_endpoints();
   // @@protoc_insertion_point(field_add:lrpc.EndpointList.endpoints)
-  return endpoints_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint >*
-EndpointList::mutable_endpoints() {
-  // @@protoc_insertion_point(field_mutable_list:lrpc.EndpointList.endpoints)
-  return &endpoints_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::lrpc::Endpoint >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lrpc::Endpoint >&
 EndpointList::endpoints() const {
   // @@protoc_insertion_point(field_list:lrpc.EndpointList.endpoints)
-  return endpoints_;
+  return _impl_.endpoints_;
 }
 
 // -------------------------------------------------------------------
 
 // KeepaliveInfo
 
-// optional string serviceName = 1;
+// string serviceName = 1;
 inline void KeepaliveInfo::clear_servicename() {
-  servicename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.servicename_.ClearToEmpty();
 }
-inline const ::std::string& KeepaliveInfo::servicename() const {
+inline const std::string& KeepaliveInfo::servicename() const {
   // @@protoc_insertion_point(field_get:lrpc.KeepaliveInfo.serviceName)
-  return servicename_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_servicename();
 }
-inline void KeepaliveInfo::set_servicename(const ::std::string& value) {
-  
-  servicename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepaliveInfo::set_servicename(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.servicename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:lrpc.KeepaliveInfo.serviceName)
 }
-inline void KeepaliveInfo::set_servicename(const char* value) {
-  
-  servicename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.KeepaliveInfo.serviceName)
+inline std::string* KeepaliveInfo::mutable_servicename() {
+  std::string* _s = _internal_mutable_servicename();
+  // @@protoc_insertion_point(field_mutable:lrpc.KeepaliveInfo.serviceName)
+  return _s;
+}
+inline const std::string& KeepaliveInfo::_internal_servicename() const {
+  return _impl_.servicename_.Get();
 }
-inline void KeepaliveInfo::set_servicename(const char* value, size_t size) {
+inline void KeepaliveInfo::_internal_set_servicename(const std::string& value) {
   
-  servicename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.KeepaliveInfo.serviceName)
+  _impl_.servicename_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* KeepaliveInfo::mutable_servicename() {
+inline std::string* KeepaliveInfo::_internal_mutable_servicename() {
   
-  // @@protoc_insertion_point(field_mutable:lrpc.KeepaliveInfo.serviceName)
-  return servicename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.servicename_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* KeepaliveInfo::release_servicename() {
+inline std::string* KeepaliveInfo::release_servicename() {
   // @@protoc_insertion_point(field_release:lrpc.KeepaliveInfo.serviceName)
-  
-  return servicename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.servicename_.Release();
 }
-inline void KeepaliveInfo::set_allocated_servicename(::std::string* servicename) {
-  if (servicename != NULL) {
+inline void KeepaliveInfo::set_allocated_servicename(std::string* servicename) {
+  if (servicename != nullptr) {
     
   } else {
     
   }
-  servicename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), servicename);
+  _impl_.servicename_.SetAllocated(servicename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.servicename_.IsDefault()) {
+    _impl_.servicename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:lrpc.KeepaliveInfo.serviceName)
 }
 
-// optional .lrpc.Endpoint endpoint = 2;
+// .lrpc.Endpoint endpoint = 2;
+inline bool KeepaliveInfo::_internal_has_endpoint() const {
+  return this != internal_default_instance() && _impl_.endpoint_ != nullptr;
+}
 inline bool KeepaliveInfo::has_endpoint() const {
-  return !_is_default_instance_ && endpoint_ != NULL;
+  return _internal_has_endpoint();
 }
 inline void KeepaliveInfo::clear_endpoint() {
-  if (GetArenaNoVirtual() == NULL && endpoint_ != NULL) delete endpoint_;
-  endpoint_ = NULL;
+  if (GetArenaForAllocation() == nullptr && _impl_.endpoint_ != nullptr) {
+    delete _impl_.endpoint_;
+  }
+  _impl_.endpoint_ = nullptr;
+}
+inline const ::lrpc::Endpoint& KeepaliveInfo::_internal_endpoint() const {
+  const ::lrpc::Endpoint* p = _impl_.endpoint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::lrpc::Endpoint&>(
+      ::lrpc::_Endpoint_default_instance_);
 }
 inline const ::lrpc::Endpoint& KeepaliveInfo::endpoint() const {
   // @@protoc_insertion_point(field_get:lrpc.KeepaliveInfo.endpoint)
-  return endpoint_ != NULL ? *endpoint_ : *default_instance_->endpoint_;
+  return _internal_endpoint();
 }
-inline ::lrpc::Endpoint* KeepaliveInfo::mutable_endpoint() {
-  
-  if (endpoint_ == NULL) {
-    endpoint_ = new ::lrpc::Endpoint;
+inline void KeepaliveInfo::unsafe_arena_set_allocated_endpoint(
+    ::lrpc::Endpoint* endpoint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.endpoint_);
   }
-  // @@protoc_insertion_point(field_mutable:lrpc.KeepaliveInfo.endpoint)
-  return endpoint_;
+  _impl_.endpoint_ = endpoint;
+  if (endpoint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:lrpc.KeepaliveInfo.endpoint)
 }
 inline ::lrpc::Endpoint* KeepaliveInfo::release_endpoint() {
+  
+  ::lrpc::Endpoint* temp = _impl_.endpoint_;
+  _impl_.endpoint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::lrpc::Endpoint* KeepaliveInfo::unsafe_arena_release_endpoint() {
   // @@protoc_insertion_point(field_release:lrpc.KeepaliveInfo.endpoint)
   
-  ::lrpc::Endpoint* temp = endpoint_;
-  endpoint_ = NULL;
+  ::lrpc::Endpoint* temp = _impl_.endpoint_;
+  _impl_.endpoint_ = nullptr;
   return temp;
 }
+inline ::lrpc::Endpoint* KeepaliveInfo::_internal_mutable_endpoint() {
+  
+  if (_impl_.endpoint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::lrpc::Endpoint>(GetArenaForAllocation());
+    _impl_.endpoint_ = p;
+  }
+  return _impl_.endpoint_;
+}
+inline ::lrpc::Endpoint* KeepaliveInfo::mutable_endpoint() {
+  ::lrpc::Endpoint* _msg = _internal_mutable_endpoint();
+  // @@protoc_insertion_point(field_mutable:lrpc.KeepaliveInfo.endpoint)
+  return _msg;
+}
 inline void KeepaliveInfo::set_allocated_endpoint(::lrpc::Endpoint* endpoint) {
-  delete endpoint_;
-  endpoint_ = endpoint;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.endpoint_;
+  }
   if (endpoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(endpoint);
+    if (message_arena != submessage_arena) {
+      endpoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, endpoint, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.endpoint_ = endpoint;
   // @@protoc_insertion_point(field_set_allocated:lrpc.KeepaliveInfo.endpoint)
 }
 
@@ -1706,47 +5513,53 @@ inline void KeepaliveInfo::set_allocated_endpoint(::lrpc::Endpoint* endpoint) {
 
 // ServiceName
 
-// optional string name = 1;
+// string name = 1;
 inline void ServiceName::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& ServiceName::name() const {
+inline const std::string& ServiceName::name() const {
   // @@protoc_insertion_point(field_get:lrpc.ServiceName.name)
-  return name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_name();
 }
-inline void ServiceName::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServiceName::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:lrpc.ServiceName.name)
 }
-inline void ServiceName::set_name(const char* value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:lrpc.ServiceName.name)
+inline std::string* ServiceName::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:lrpc.ServiceName.name)
+  return _s;
 }
-inline void ServiceName::set_name(const char* value, size_t size) {
+inline const std::string& ServiceName::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ServiceName::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:lrpc.ServiceName.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ServiceName::mutable_name() {
+inline std::string* ServiceName::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:lrpc.ServiceName.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ServiceName::release_name() {
+inline std::string* ServiceName::release_name() {
   // @@protoc_insertion_point(field_release:lrpc.ServiceName.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void ServiceName::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void ServiceName::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:lrpc.ServiceName.name)
 }
 
@@ -1754,21 +5567,39 @@ inline void ServiceName::set_allocated_name(::std::string* name) {
 
 // Status
 
-// optional int32 result = 1;
+// int32 result = 1;
 inline void Status::clear_result() {
-  result_ = 0;
+  _impl_.result_ = 0;
 }
-inline ::google::protobuf::int32 Status::result() const {
+inline int32_t Status::_internal_result() const {
+  return _impl_.result_;
+}
+inline int32_t Status::result() const {
   // @@protoc_insertion_point(field_get:lrpc.Status.result)
-  return result_;
+  return _internal_result();
 }
-inline void Status::set_result(::google::protobuf::int32 value) {
+inline void Status::_internal_set_result(int32_t value) {
   
-  result_ = value;
+  _impl_.result_ = value;
+}
+inline void Status::set_result(int32_t value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:lrpc.Status.result)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1790,20 +5621,32 @@ inline void Status::set_result(::google::protobuf::int32 value) {
 
 }  // namespace lrpc
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::lrpc::MessageType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::lrpc::StreamFrame_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::lrpc::StreamFrame_Type>() {
+  return ::lrpc::StreamFrame_Type_descriptor();
+}
+template <> struct is_proto_enum< ::lrpc::PushFrame_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::lrpc::PushFrame_Type>() {
+  return ::lrpc::PushFrame_Type_descriptor();
+}
+template <> struct is_proto_enum< ::lrpc::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::lrpc::MessageType>() {
   return ::lrpc::MessageType_descriptor();
 }
+template <> struct is_proto_enum< ::lrpc::Priority> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::lrpc::Priority>() {
+  return ::lrpc::Priority_descriptor();
+}
 
-}  // namespace protobuf
-}  // namespace google
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_lrpc_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_lrpc_2eproto
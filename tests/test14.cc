@@ -0,0 +1,142 @@
+/**
+ * @file test14.cc
+ * @brief 超时的请求释放 pendingCalls_ 的 slot：超时之后 outstanding 回到 0，
+ * 迟到的 response 携带旧的 id，不会交给复用同一个 slot 的新请求，
+ * generation 回绕之后也不会
+ */
+
+#include "ClientStub.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "PendingCalls.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+class TestServiceImpl : public test::TestService {
+public:
+  /// @brief "slow" 在 200ms 之后回复，其他的立即回复
+  void Echo(::google::protobuf::RpcController *,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    response->set_text(request->text());
+    if (request->text() != "slow") {
+      done->Run();
+      return;
+    }
+    EventLoop::getEventLoopOfCurrentThread()->runAfter(
+        0.2, [done]() { done->Run(); });
+  }
+  /// @brief "drop" 永远不回复
+  void AppendDots(::google::protobuf::RpcController *,
+                  const test::EchoRequest *request,
+                  test::EchoResponse *response,
+                  ::google::protobuf::Closure *done) override {
+    if (request->text() == "drop")
+      return;
+    response->set_text(request->text() + "...");
+    done->Run();
+  }
+};
+
+/// @brief 每次只有一个请求在等待，slot 反复释放和分配，旧的 id 在 generation
+/// 回绕之前不会再次有效
+static void testGenerationWrap() {
+  PendingCalls calls;
+  PendingCalls::Call call;
+  const int stale = calls.add(PendingCalls::Call());
+  calls.take(stale, &call); // 超时
+  // 超过 11 位 generation 的回绕周期很多倍
+  const int kCalls = 200 * 1000;
+  int matched = 0;
+  for (int i = 0; i < kCalls; ++i) {
+    const int id = calls.add(PendingCalls::Call());
+    if (id == stale || calls.contains(stale))
+      ++matched;
+    calls.take(id, &call);
+  }
+  check(matched == 0, "stale id never matches after generation wrap");
+  check(!calls.take(stale, &call) && calls.empty(),
+        "late response of a timed out call is dropped");
+}
+
+static void runTests(ClientStub *stub) {
+  const std::string S = "lrpc.test.TestService";
+  auto chan = stub->getChannel().wait();
+  ClientChannelPtr channel = chan.getValue();
+
+  // 没有回复的请求全部超时，slot 全部释放
+  CallOptions shortTimeout;
+  shortTimeout.timeout = std::chrono::milliseconds(50);
+  auto drop = std::make_shared<test::EchoRequest>();
+  drop->set_text("drop");
+  std::vector<Future<Result<test::EchoResponse>>> futures;
+  for (int i = 0; i < 500; ++i)
+    futures.push_back(
+        call<test::EchoResponse>(S, "AppendDots", drop, shortTimeout));
+  int timeouts = 0;
+  for (auto &f : futures) {
+    auto r = f.wait();
+    if (isError(r, ErrorCode::Timeout))
+      ++timeouts;
+  }
+  check(timeouts == 500, "dropped calls time out");
+  check(channel->outstanding() == 0, "timed out calls release their slots");
+
+  // 迟到的 response 不会交给复用 slot 的请求
+  auto slow = std::make_shared<test::EchoRequest>();
+  slow->set_text("slow");
+  auto late = call<test::EchoResponse>(S, "Echo", slow, shortTimeout).wait();
+  check(isError(late, ErrorCode::Timeout), "slow call times out");
+  int matched = 0;
+  const auto start = std::chrono::steady_clock::now();
+  // 持续发送请求，覆盖 slow 的 response 到达的时间
+  while (std::chrono::steady_clock::now() - start <
+         std::chrono::milliseconds(400)) {
+    auto req = std::make_shared<test::EchoRequest>();
+    req->set_text("fast" + std::to_string(matched));
+    auto r = call<test::EchoResponse>(S, "Echo", req).wait();
+    test::EchoResponse rsp = std::move(r);
+    if (rsp.text() != req->text())
+      break;
+    ++matched;
+  }
+  check(std::chrono::steady_clock::now() - start >=
+            std::chrono::milliseconds(400),
+        "late response is not delivered to another call");
+  check(channel->outstanding() == 0, "no call left after late response");
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9994"));
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9994");
+
+  RpcServer server;
+  server.setThreadNum(2);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([stub]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    testGenerationWrap();
+    runTests(stub);
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
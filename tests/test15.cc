@@ -0,0 +1,142 @@
+/**
+ * @file test15.cc
+ * @brief frame 压缩：算法和字典的协商，压缩/解压往返，伪造的 rawLen
+ * 在分配内存之前被拒绝，以及 Service / ClientStub 都开启压缩的端到端调用
+ */
+
+#include "ClientStub.h"
+#include "Compression.h"
+#include "Logging.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+using namespace lrpc;
+
+class TestServiceImpl : public test::TestService {
+public:
+  void Echo(::google::protobuf::RpcController *,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    response->set_text(request->text());
+    done->Run();
+  }
+};
+
+static std::string sample(size_t len) {
+  std::string s;
+  while (s.size() < len)
+    s += "lrpc compressed frame " + std::to_string(s.size() % 97) + ";";
+  s.resize(len);
+  return s;
+}
+
+static void testNegotiate(uint32_t dictId) {
+  const uint32_t zlibMask = 1u << static_cast<int>(CompressType::Zlib);
+  CompressOptions local;
+  local.type = CompressType::Zlib;
+  local.dictId = dictId;
+  check(negotiateCompress(local, zlibMask, dictId).type == CompressType::Zlib,
+        "peer accepts zlib");
+  check(negotiateCompress(local, 0, dictId).type == CompressType::None,
+        "peer without compression");
+  auto noDict = negotiateCompress(local, zlibMask, dictId + 1);
+  check(noDict.type == CompressType::Zlib && noDict.dictId == 0,
+        "dictionary mismatch disables the dictionary only");
+}
+
+static void testCodec(uint32_t dictId) {
+  const std::string raw = sample(100 * 1000);
+  std::string packed;
+  check(compress(CompressType::Zlib, raw.data(), raw.size(), nullptr, &packed) &&
+            packed.size() < raw.size() / 4,
+        "zlib compresses");
+  std::string out;
+  check(decompress(CompressType::Zlib, packed.data(), packed.size(),
+                   raw.size(), nullptr, &out) &&
+            out == raw,
+        "zlib round trip");
+
+  auto dict = findCompressDictionary(dictId);
+  std::string dictPacked, dictOut;
+  check(dict &&
+            compress(CompressType::Zlib, raw.data(), 200, dict.get(),
+                     &dictPacked) &&
+            decompress(CompressType::Zlib, dictPacked.data(),
+                       dictPacked.size(), 200, dict.get(), &dictOut) &&
+            dictOut == raw.substr(0, 200),
+        "dictionary round trip");
+
+  // 对端声明的长度超过算法的最大压缩比
+  const size_t forged = decompressBound(CompressType::Zlib, packed.size()) + 1;
+  out.clear();
+  check(!decompress(CompressType::Zlib, packed.data(), packed.size(), forged,
+                    nullptr, &out) &&
+            out.capacity() < forged,
+        "rawLen above the ratio bound is rejected before allocating");
+  check(!decompress(CompressType::Zlib, packed.data(), packed.size(),
+                    maxDecompressedSize() + 1, nullptr, &out),
+        "rawLen above maxDecompressedSize is rejected");
+  // 声明的长度比实际的大或者小
+  check(!decompress(CompressType::Zlib, packed.data(), packed.size(),
+                    raw.size() + 1, nullptr, &out),
+        "rawLen larger than the data");
+  check(!decompress(CompressType::Zlib, packed.data(), packed.size(),
+                    raw.size() - 1, nullptr, &out),
+        "rawLen smaller than the data");
+  check(!decompress(CompressType::Zlib, packed.data(), packed.size() / 2,
+                    raw.size(), nullptr, &out),
+        "truncated data");
+}
+
+static void testCall() {
+  const std::string S = "lrpc.test.TestService";
+  for (size_t len : {10, 1000, 300 * 1000}) {
+    auto req = std::make_shared<test::EchoRequest>();
+    req->set_text(sample(len));
+    auto r = call<test::EchoResponse>(S, "Echo", req).wait();
+    bool ok = false;
+    try {
+      test::EchoResponse rsp = std::move(r);
+      ok = rsp.text() == req->text();
+    } catch (const std::exception &e) {
+      printf("call failed: %s\n", e.what());
+    }
+    check(ok, ("compressed call " + std::to_string(len)).c_str());
+  }
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  const std::string dictionary = sample(4096);
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9995"));
+  service->setCompression(CompressType::Zlib, 64, dictionary);
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9995");
+  stub->setCompression(CompressType::Zlib, 64, dictionary);
+  const uint32_t dictId = service->compressOptions().dictId;
+
+  RpcServer server;
+  server.setThreadNum(2);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([dictId]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    testNegotiate(dictId);
+    testCodec(dictId);
+    testCall();
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
@@ -0,0 +1,147 @@
+/**
+ * @file test16.cc
+ * @brief 连接断开的时候等待中的请求立即以 ConnectionLost 失败；重试只针对
+ * 请求没有执行的错误：连接错误会换一个 endpoint 重试，服务端返回的错误
+ * 不重试
+ */
+
+#include "ClientStub.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcController.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "TcpServer.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+static std::atomic<int> g_failCalls{0};
+
+class TestServiceImpl : public test::TestService {
+public:
+  void Echo(::google::protobuf::RpcController *controller,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    if (request->text() == "fail") {
+      ++g_failCalls;
+      controller->SetFailed("failed on purpose");
+    }
+    response->set_text(request->text());
+    done->Run();
+  }
+};
+
+/// @brief 收到数据之后关闭连接的对端，模拟处理请求之前崩溃的服务
+static void runClosingServer(uint16_t port) {
+  EventLoop loop;
+  TcpServer server(&loop, InetAddress("127.0.0.1", port));
+  server.setMessageCallback(
+      [](const TcpConnectionPtr &conn, Buffer *buf, Timestamp) {
+        buf->retrieveAll();
+        conn->shutdown();
+      });
+  server.start();
+  loop.loop();
+}
+
+static void testRetryable() {
+  RetryPolicy policy;
+  auto error = [](ErrorCode code) {
+    return std::make_exception_ptr(Exception(code, "test"));
+  };
+  check(policy.retryable(error(ErrorCode::ConnectionLost)) &&
+            policy.retryable(error(ErrorCode::ConnectRefused)) &&
+            policy.retryable(error(ErrorCode::Overloaded)),
+        "connection errors and overload are retryable");
+  check(!policy.retryable(error(ErrorCode::Timeout)),
+        "timeout is not retried by default");
+  policy.retryOnTimeout = true;
+  check(policy.retryable(error(ErrorCode::Timeout)), "retryOnTimeout");
+  check(!policy.retryable(error(ErrorCode::ThrowInMethod)) &&
+            !policy.retryable(
+                std::make_exception_ptr(std::runtime_error("other"))),
+        "other errors are not retried");
+}
+
+static void testCalls() {
+  const std::string S = "lrpc.test.TestService";
+  auto req = std::make_shared<test::EchoRequest>();
+  req->set_text("hello");
+
+  // 不重试：发送到关闭连接的 endpoint 的请求立即以 ConnectionLost 失败
+  int lost = 0, ok = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 4; ++i) {
+    auto r = call<test::EchoResponse>(S, "Echo", req).wait();
+    if (isError(r, ErrorCode::ConnectionLost))
+      ++lost;
+    else if (!r.hasException())
+      ++ok;
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  check(lost > 0 && lost + ok == 4, "pending calls fail with ConnectionLost");
+  check(elapsed < std::chrono::seconds(1), "failure does not wait for timeout");
+
+  // 重试：连接错误换一个 endpoint 重试，所有的请求都成功
+  CallOptions options;
+  options.retry.maxAttempts = 3;
+  options.retry.initialBackoff = std::chrono::milliseconds(1);
+  ok = 0;
+  for (int i = 0; i < 20; ++i) {
+    auto r = call<test::EchoResponse>(S, "Echo", req, options).wait();
+    if (!r.hasException())
+      ++ok;
+  }
+  check(ok == 20, "connection errors are retried on another endpoint");
+
+  // 服务端返回的错误不重试
+  auto fail = std::make_shared<test::EchoRequest>();
+  fail->set_text("fail");
+  int failed = 0;
+  for (int i = 0; i < 5; ++i) {
+    auto r = call<test::EchoResponse>(S, "Echo", fail, options).wait();
+    if (r.hasException())
+      ++failed;
+  }
+  check(failed == 5 && g_failCalls == 5, "server errors are not retried");
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9997"));
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9996;127.0.0.1:9997");
+  stub->setRetryBudget(1.0, 100);
+
+  RpcServer server;
+  server.setThreadNum(2);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    // ClientStub 按照 EventLoop 的编号保存连接，对端的 loop 在 RpcServer
+    // 的 loop 之后创建
+    std::thread closing(runClosingServer, 9996);
+    closing.detach();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    testRetryable();
+    testCalls();
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
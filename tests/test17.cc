@@ -0,0 +1,202 @@
+/**
+ * @file test17.cc
+ * @brief 分块传输：ChunkAssembler 的组装和 ChunkLimits 限制，停滞的消息被丢弃；
+ * Service / ClientStub 都开启分块的端到端调用，多个大消息同时发送，
+ * 以及超过接收端 maxMessageSize 的请求被拒绝
+ */
+
+#include "Chunk.h"
+#include "ClientStub.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+class TestServiceImpl : public test::TestService {
+public:
+  void Echo(::google::protobuf::RpcController *,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    response->set_text(request->text());
+    done->Run();
+  }
+};
+
+static ChunkFrame makeChunk(uint32_t id, uint64_t totalLen,
+                            const std::string &data) {
+  ChunkFrame frame;
+  frame.set_id(id);
+  frame.set_total_len(totalLen);
+  frame.set_data(data);
+  return frame;
+}
+
+static std::string sample(size_t len, char seed) {
+  std::string s(len, seed);
+  for (size_t i = 0; i < len; i += 997)
+    s[i] = static_cast<char>('a' + i % 26);
+  return s;
+}
+
+static void testAssembler() {
+  EventLoop loop;
+
+  // 乱序交错到达的两个消息分别组装
+  RpcMessage m1, m2;
+  m1.mutable_request()->set_method_name("first");
+  m2.mutable_request()->set_method_name("second");
+  const std::string s1 = m1.SerializeAsString();
+  const std::string s2 = m2.SerializeAsString();
+  ChunkAssembler assembler(&loop, ChunkLimits());
+  auto c1 = makeChunk(1, s1.size(), s1.substr(0, 3));
+  auto c2 = makeChunk(2, s2.size(), s2.substr(0, 4));
+  auto c3 = makeChunk(2, 0, s2.substr(4));
+  auto c4 = makeChunk(1, 0, s1.substr(3));
+  check(!assembler.onChunk(c1) && !assembler.onChunk(c2), "partial chunks");
+  check(assembler.partials() == 2 && assembler.bytes() == 7,
+        "bytes follow the received data");
+  auto second = assembler.onChunk(c3);
+  auto first = assembler.onChunk(c4);
+  check(first && first->request().method_name() == "first" && second &&
+            second->request().method_name() == "second",
+        "interleaved messages are assembled");
+  check(assembler.partials() == 0 && assembler.bytes() == 0,
+        "assembled messages are released");
+  check(throws(ErrorCode::DecodeFail,
+               [&] {
+                 auto c = makeChunk(9, 0, "x");
+                 assembler.onChunk(c);
+               }),
+        "continuation of an unknown message");
+
+  ChunkLimits limits;
+  limits.maxMessageSize = 1000;
+  limits.maxPartials = 2;
+  limits.maxPendingBytes = 1500;
+  limits.stallTimeout = std::chrono::milliseconds(200);
+  ChunkAssembler limited(&loop, limits);
+  check(throws(ErrorCode::TooLongFrame,
+               [&] {
+                 auto c = makeChunk(1, 2000ULL * 1000 * 1000, "x");
+                 limited.onChunk(c);
+               }),
+        "declared length above maxMessageSize");
+  auto big = makeChunk(1, 900, "abc");
+  limited.onChunk(big);
+  check(throws(ErrorCode::TooLongFrame,
+               [&] {
+                 auto c = makeChunk(2, 700, "x");
+                 limited.onChunk(c);
+               }),
+        "declared lengths above maxPendingBytes");
+  auto small = makeChunk(2, 500, "x");
+  limited.onChunk(small);
+  check(throws(ErrorCode::TooLongFrame,
+               [&] {
+                 auto c = makeChunk(3, 10, "x");
+                 limited.onChunk(c);
+               }),
+        "messages above maxPartials");
+
+  // 消息 2 一直有新的 chunk，消息 1 停滞之后被丢弃
+  size_t afterStall = 0, atEnd = 0;
+  loop.runAfter(0.1, [&] {
+    auto c = makeChunk(2, 0, "y");
+    limited.onChunk(c);
+  });
+  loop.runAfter(0.25, [&] { afterStall = limited.partials(); });
+  loop.runAfter(0.45, [&] {
+    atEnd = limited.partials() + limited.bytes();
+    loop.quit();
+  });
+  loop.loop();
+  check(afterStall == 1, "stalled message is dropped");
+  check(atEnd == 0, "every stalled message is dropped");
+}
+
+static void testCall() {
+  const std::string S = "lrpc.test.TestService";
+  // 一个大消息
+  auto req = std::make_shared<test::EchoRequest>();
+  req->set_text(sample(1024 * 1024, 'x'));
+  auto r = call<test::EchoResponse>(S, "Echo", req).wait();
+  bool ok = false;
+  try {
+    test::EchoResponse rsp = std::move(r);
+    ok = rsp.text() == req->text();
+  } catch (const std::exception &e) {
+    printf("call failed: %s\n", e.what());
+  }
+  check(ok, "chunked call");
+
+  // 多个大消息和小消息同时发送
+  std::vector<std::shared_ptr<test::EchoRequest>> reqs;
+  std::vector<Future<Result<test::EchoResponse>>> futures;
+  for (int i = 0; i < 24; ++i) {
+    auto one = std::make_shared<test::EchoRequest>();
+    one->set_text(i % 3 == 0 ? "small" + std::to_string(i)
+                             : sample(300 * 1000 + i, 'a' + i % 26));
+    reqs.push_back(one);
+    futures.push_back(call<test::EchoResponse>(S, "Echo", one));
+  }
+  int matched = 0;
+  for (size_t i = 0; i < futures.size(); ++i) {
+    auto one = futures[i].wait();
+    if (!one.hasException() && one.getValue().text() == reqs[i]->text())
+      ++matched;
+  }
+  check(matched == 24, "pipelined chunked calls");
+
+  // 超过 Service 的 maxMessageSize 的请求被拒绝，之后的请求重新连接
+  auto tooBig = std::make_shared<test::EchoRequest>();
+  tooBig->set_text(sample(3 * 1024 * 1024, 'z'));
+  auto rejected = call<test::EchoResponse>(S, "Echo", tooBig).wait();
+  check(rejected.hasException(), "message above maxMessageSize is rejected");
+  auto again = call<test::EchoResponse>(S, "Echo", req).wait();
+  check(!again.hasException() && again.getValue().text() == req->text(),
+        "call after rejection");
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9998"));
+  service->setChunkSize(64 * 1024);
+  ChunkLimits limits;
+  limits.maxMessageSize = 2 * 1024 * 1024;
+  service->setChunkLimits(limits);
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9998");
+  stub->setChunkSize(64 * 1024);
+
+  RpcServer server;
+  server.setThreadNum(2);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    // ClientStub 按照 EventLoop 的编号保存连接，测试用的 loop 在 RpcServer
+    // 的 loop 之后创建
+    testAssembler();
+    testCall();
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
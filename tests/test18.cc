@@ -0,0 +1,230 @@
+/**
+ * @file test18.cc
+ * @brief 批量调用：整批的 response 按照下标拆分给每个 request 的 future，
+ * 单个 request 的失败只影响它自己，handler 乱序完成不影响对应关系；
+ * 整批的错误交给所有的 future，整批超时之后释放唯一的 pending call
+ */
+
+#include "ClientStub.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+class TestServiceImpl : public test::TestService {
+public:
+  /// @brief "fail" 返回错误，"slowN" 在 N * 10ms 之后回复
+  void Echo(::google::protobuf::RpcController *controller,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    const std::string &text = request->text();
+    if (text == "fail")
+      controller->SetFailed("failed on purpose");
+    response->set_text(text);
+    if (text.compare(0, 4, "slow") != 0) {
+      done->Run();
+      return;
+    }
+    const double delay = std::stoi(text.substr(4)) * 0.01;
+    EventLoop::getEventLoopOfCurrentThread()->runAfter(
+        delay, [done]() { done->Run(); });
+  }
+  /// @brief "drop" 永远不回复
+  void AppendDots(::google::protobuf::RpcController *,
+                  const test::EchoRequest *request,
+                  test::EchoResponse *response,
+                  ::google::protobuf::Closure *done) override {
+    if (request->text() == "drop")
+      return;
+    response->set_text(request->text() + "...");
+    done->Run();
+  }
+};
+
+static std::vector<std::shared_ptr<Message>>
+makeRequests(int n, const std::string &prefix) {
+  std::vector<std::shared_ptr<Message>> reqs;
+  for (int i = 0; i < n; ++i) {
+    auto req = std::make_shared<test::EchoRequest>();
+    req->set_text(prefix + std::to_string(i));
+    reqs.push_back(req);
+  }
+  return reqs;
+}
+
+static const std::string &textOf(const std::shared_ptr<Message> &req) {
+  return static_cast<test::EchoRequest *>(req.get())->text();
+}
+
+/// @brief 直接拆分构造的 BatchResponse
+static void testSplit() {
+  auto frame = std::make_shared<RpcMessage>();
+  BatchResponse *batch = frame->mutable_batch_response();
+  test::EchoResponse ok;
+  ok.set_text("ok");
+  batch->add_responses()->set_serialized_response(ok.SerializeAsString());
+  auto error = batch->add_responses()->mutable_error();
+  error->set_errnum(static_cast<int>(ErrorCode::ThrowInMethod));
+  error->set_msg("item failed");
+  batch->add_responses()->set_serialized_response("\xff\xff\xff");
+
+  std::vector<Promise<Result<test::EchoResponse>>> promises(3);
+  std::vector<Future<Result<test::EchoResponse>>> futures;
+  for (auto &promise : promises)
+    futures.push_back(promise.getFuture());
+  _completeBatch<test::EchoResponse>(
+      promises, Result<std::shared_ptr<Message>>(
+                    std::static_pointer_cast<Message>(frame)));
+  auto r0 = futures[0].wait();
+  auto r1 = futures[1].wait();
+  auto r2 = futures[2].wait();
+  check(!r0.hasException() && r0.getValue().text() == "ok",
+        "successful item");
+  check(isError(r1, ErrorCode::ThrowInMethod), "item error");
+  check(isError(r2, ErrorCode::DecodeFail), "undecodable item");
+
+  // response 的个数和 request 不一致
+  std::vector<Promise<Result<test::EchoResponse>>> more(4);
+  std::vector<Future<Result<test::EchoResponse>>> moreFutures;
+  for (auto &promise : more)
+    moreFutures.push_back(promise.getFuture());
+  _completeBatch<test::EchoResponse>(
+      more, Result<std::shared_ptr<Message>>(
+                std::static_pointer_cast<Message>(frame)));
+  int decodeFail = 0;
+  for (auto &f : moreFutures) {
+    auto r = f.wait();
+    if (isError(r, ErrorCode::DecodeFail))
+      ++decodeFail;
+  }
+  check(decodeFail == 4, "mismatched response count fails every item");
+
+  // 整批没有执行，服务端以普通的 Response 回复错误
+  auto whole = std::make_shared<RpcMessage>();
+  whole->mutable_response()->mutable_error()->set_errnum(
+      static_cast<int>(ErrorCode::Overloaded));
+  std::vector<Promise<Result<test::EchoResponse>>> rejected(2);
+  std::vector<Future<Result<test::EchoResponse>>> rejectedFutures;
+  for (auto &promise : rejected)
+    rejectedFutures.push_back(promise.getFuture());
+  _completeBatch<test::EchoResponse>(
+      rejected, Result<std::shared_ptr<Message>>(
+                    std::static_pointer_cast<Message>(whole)));
+  int overloaded = 0;
+  for (auto &f : rejectedFutures) {
+    auto r = f.wait();
+    if (isError(r, ErrorCode::Overloaded))
+      ++overloaded;
+  }
+  check(overloaded == 2, "batch error goes to every item");
+}
+
+static void testCall(ClientStub *stub) {
+  const std::string S = "lrpc.test.TestService";
+
+  // 每个 future 得到自己的 response
+  auto reqs = makeRequests(200, "k");
+  auto futures = callBatch<test::EchoResponse>(S, "Echo", reqs);
+  int matched = 0;
+  for (size_t i = 0; i < futures.size(); ++i) {
+    auto r = futures[i].wait();
+    if (!r.hasException() && r.getValue().text() == textOf(reqs[i]))
+      ++matched;
+  }
+  check(futures.size() == 200 && matched == 200, "responses split by index");
+
+  // 单个 request 失败
+  auto mixed = makeRequests(5, "m");
+  static_cast<test::EchoRequest *>(mixed[2].get())->set_text("fail");
+  auto mixedFutures = callBatch<test::EchoResponse>(S, "Echo", mixed);
+  int ok = 0;
+  bool failed = false;
+  for (size_t i = 0; i < mixedFutures.size(); ++i) {
+    auto r = mixedFutures[i].wait();
+    if (i == 2)
+      failed = isError(r, ErrorCode::ThrowInMethod);
+    else if (!r.hasException() && r.getValue().text() == textOf(mixed[i]))
+      ++ok;
+  }
+  check(failed && ok == 4, "one failed request only fails its own future");
+
+  // handler 逆序完成
+  std::vector<std::shared_ptr<Message>> slow;
+  for (int i = 10; i > 0; --i) {
+    auto req = std::make_shared<test::EchoRequest>();
+    req->set_text("slow" + std::to_string(i));
+    slow.push_back(req);
+  }
+  auto slowFutures = callBatch<test::EchoResponse>(S, "Echo", slow);
+  matched = 0;
+  for (size_t i = 0; i < slowFutures.size(); ++i) {
+    auto r = slowFutures[i].wait();
+    if (!r.hasException() && r.getValue().text() == textOf(slow[i]))
+      ++matched;
+  }
+  check(matched == 10, "out of order completion keeps the order");
+
+  // 整批的错误
+  auto unknown = callBatch<test::EchoResponse>(S, "Nope", makeRequests(3, "n"));
+  int noMethod = 0;
+  for (auto &f : unknown) {
+    auto r = f.wait();
+    if (isError(r, ErrorCode::NoSuchMethod))
+      ++noMethod;
+  }
+  check(noMethod == 3, "unknown method fails every future");
+  check(callBatch<test::EchoResponse>(S, "Echo", {}).empty(), "empty batch");
+
+  // 一个 request 没有回复，整批超时，只占用一个 pending call
+  auto chan = stub->getChannel().wait();
+  ClientChannelPtr channel = chan.getValue();
+  auto dropped = makeRequests(3, "d");
+  static_cast<test::EchoRequest *>(dropped[1].get())->set_text("drop");
+  CallOptions shortTimeout;
+  shortTimeout.timeout = std::chrono::milliseconds(100);
+  auto droppedFutures =
+      callBatch<test::EchoResponse>(S, "AppendDots", dropped, shortTimeout);
+  int timeouts = 0;
+  for (auto &f : droppedFutures) {
+    auto r = f.wait();
+    if (isError(r, ErrorCode::Timeout))
+      ++timeouts;
+  }
+  check(timeouts == 3, "unanswered batch times out as a whole");
+  check(channel->outstanding() == 0, "timed out batch releases its slot");
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9999"));
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9999");
+
+  RpcServer server;
+  server.setThreadNum(2);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([stub]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    testSplit();
+    testCall(stub);
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
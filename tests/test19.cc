@@ -0,0 +1,195 @@
+/**
+ * @file test19.cc
+ * @brief fanout 收集结果：只有成功的结果计入 quorum，失败的 endpoint 不会
+ * 提前完成 quorum；达不到 quorum 的时候立即完成；超过截止时间以部分结果
+ * 完成. 等待所有 endpoint 的时候，没有回复或者连接一直建立不起来的 endpoint
+ * 在截止时间以 Timeout 出现在结果中，结果按照 endpoints 的顺序排列
+ */
+
+#include "ClientStub.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "TcpServer.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <netinet/in.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+class TestServiceImpl : public test::TestService {
+public:
+  void Echo(::google::protobuf::RpcController *,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    response->set_text(request->text());
+    done->Run();
+  }
+};
+
+/// @brief 收到数据之后关闭连接的对端，和收到数据之后从不回复的对端
+static void runFakeServers(uint16_t closingPort, uint16_t silentPort) {
+  EventLoop loop;
+  TcpServer closing(&loop, InetAddress("127.0.0.1", closingPort));
+  closing.setMessageCallback(
+      [](const TcpConnectionPtr &conn, Buffer *buf, Timestamp) {
+        buf->retrieveAll();
+        conn->shutdown();
+      });
+  TcpServer silent(&loop, InetAddress("127.0.0.1", silentPort));
+  silent.setMessageCallback(
+      [](const TcpConnectionPtr &, Buffer *buf, Timestamp) {
+        buf->retrieveAll();
+      });
+  closing.start();
+  silent.start();
+  loop.loop();
+}
+
+/// @brief 监听但是从不 accept 的端口，accept 队列填满之后新的 SYN 被丢弃，
+/// 连接一直建立不起来
+static void blackholePort(uint16_t port) {
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  int listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+  int on = 1;
+  ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  ::bind(listenFd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+  ::listen(listenFd, 0);
+  for (int i = 0; i < 4; ++i) {
+    int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    ::connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+  }
+}
+
+using Replies = std::vector<FanoutReply<test::EchoResponse>>;
+
+static size_t successes(Replies &replies) {
+  size_t n = 0;
+  for (auto &reply : replies)
+    if (!reply.result.hasException())
+      ++n;
+  return n;
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+static void runTests() {
+  const std::string S = "lrpc.test.TestService";
+  const Endpoint ok = createEndpoint("127.0.0.1:9980");
+  const Endpoint closing = createEndpoint("127.0.0.1:9981");
+  const Endpoint silent = createEndpoint("127.0.0.1:9982");
+  const Endpoint blackhole = createEndpoint("127.0.0.1:9984");
+  auto req = std::make_shared<test::EchoRequest>();
+  req->set_text("fanout");
+  CallOptions options;
+  options.timeout = std::chrono::milliseconds(300);
+  FanoutOptions quorum2;
+  quorum2.quorum = 2;
+
+  // 失败先返回也不计入 quorum，等到两个成功
+  auto start = std::chrono::steady_clock::now();
+  auto mixed = fanout<test::EchoResponse>(
+                   S, "Echo", req, {closing, closing, ok, silent, ok}, options,
+                   quorum2)
+                   .wait();
+  Replies replies = mixed.getValue();
+  check(successes(replies) == 2, "failures do not count toward the quorum");
+  check(elapsedMs(start) < 250, "quorum completes before the deadline");
+
+  // 剩下的 endpoint 全部成功也达不到 quorum，立即完成
+  FanoutOptions quorum3;
+  quorum3.quorum = 3;
+  start = std::chrono::steady_clock::now();
+  auto impossible =
+      fanout<test::EchoResponse>(S, "Echo", req, {closing, closing, ok, silent},
+                                 options, quorum3)
+          .wait();
+  replies = impossible.getValue();
+  check(successes(replies) < 3, "unreachable quorum");
+  check(elapsedMs(start) < 250, "unreachable quorum completes early");
+
+  // 达不到 quorum 也没有确定失败，截止时间以部分结果完成
+  start = std::chrono::steady_clock::now();
+  auto partial = fanout<test::EchoResponse>(S, "Echo", req,
+                                            {ok, silent, silent}, options,
+                                            quorum2)
+                     .wait();
+  replies = partial.getValue();
+  const double partialMs = elapsedMs(start);
+  // silent 的调用自己的超时和收集的截止时间相同，可能先以 Timeout 返回
+  check(successes(replies) == 1, "deadline completes with partial results");
+  check(partialMs >= 250 && partialMs < 1000, "quorum deadline");
+
+  // 等待所有的 endpoint：连接建立不起来的 endpoint 不会拖住整个 fanout
+  start = std::chrono::steady_clock::now();
+  auto all = fanout<test::EchoResponse>(S, "Echo", req,
+                                        {ok, closing, silent, blackhole},
+                                        options)
+                 .wait();
+  replies = all.getValue();
+  const double allMs = elapsedMs(start);
+  check(replies.size() == 4 && replies[0].endpoint == ok &&
+            replies[3].endpoint == blackhole,
+        "all results in endpoint order");
+  check(!replies[0].result.hasException() &&
+            isError(replies[1].result, ErrorCode::ConnectionLost) &&
+            isError(replies[2].result, ErrorCode::Timeout) &&
+            isError(replies[3].result, ErrorCode::Timeout),
+        "each endpoint gets its own result");
+  check(allMs >= 250 && allMs < 1000, "blackholed connect bounded by timeout");
+
+  // 所有的 endpoint 都成功的时候不等待截止时间
+  start = std::chrono::steady_clock::now();
+  auto fast =
+      fanout<test::EchoResponse>(S, "Echo", req, {ok, ok, ok}, options).wait();
+  replies = fast.getValue();
+  check(replies.size() == 3 && successes(replies) == 3 &&
+            elapsedMs(start) < 250,
+        "all successes complete without the deadline");
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9980"));
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9980");
+
+  RpcServer server;
+  server.setThreadNum(2);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    // ClientStub 按照 EventLoop 的编号保存连接，对端的 loop 在 RpcServer
+    // 的 loop 之后创建
+    std::thread fakes(runFakeServers, 9981, 9982);
+    fakes.detach();
+    blackholePort(9984);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    runTests();
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
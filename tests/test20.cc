@@ -0,0 +1,149 @@
+/**
+ * @file test20.cc
+ * @brief 一致性哈希：同一个 key 每次都落在同一个 endpoint，只有这个 endpoint
+ * 被排除或者被熔断剔除的时候才换到环上顺时针的下一个 endpoint，其他 key
+ * 不受影响；剔除结束之后 key 回到原来的 endpoint
+ */
+
+#include "ClientStub.h"
+#include "LoadBalancer.h"
+#include "Logging.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace lrpc;
+
+static const size_t kVirtualNodes = 160;
+
+/// @brief 按照 ConsistentHashBalancer 的规则独立建环，从 key 的位置顺时针
+/// 找到第一个不是 skip 的 endpoint
+static Endpoint clockwise(const std::vector<Endpoint> &eps,
+                          const std::string &key,
+                          const Endpoint *skip = nullptr) {
+  std::vector<std::pair<uint64_t, size_t>> points;
+  for (size_t i = 0; i < eps.size(); ++i)
+    for (size_t v = 0; v < kVirtualNodes; ++v)
+      points.emplace_back(
+          hashRoutingKey(getStringAddrFromEndpoint(eps[i]) + "#" +
+                         std::to_string(v)),
+          i);
+  std::sort(points.begin(), points.end());
+  auto it = std::lower_bound(points.begin(), points.end(),
+                             std::make_pair(hashRoutingKey(key), size_t(0)));
+  for (size_t n = 0; n < points.size(); ++n, ++it) {
+    if (it == points.end())
+      it = points.begin();
+    if (!skip || !(eps[it->second] == *skip))
+      return eps[it->second];
+  }
+  return Endpoint();
+}
+
+static Endpoint select(ClientStub *stub, const std::string &key,
+                       const Endpoint &exclude = Endpoint()) {
+  auto r = stub->selectEndpoint(exclude, key).wait();
+  return r.getValue();
+}
+
+static std::string keyOf(int i) { return "user" + std::to_string(i); }
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  const std::string urls = "10.0.0.1:80;10.0.0.2:80;10.0.0.3:80;"
+                           "10.0.0.4:80;10.0.0.5:80";
+  std::vector<Endpoint> eps;
+  for (int i = 1; i <= 5; ++i)
+    eps.push_back(createEndpoint("10.0.0." + std::to_string(i) + ":80"));
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists(urls);
+  stub->setLoadBalancer(LoadBalanceType::ConsistentHash);
+  CircuitBreakerOptions breaker;
+  breaker.baseEjection = std::chrono::milliseconds(200);
+  stub->setCircuitBreaker(breaker);
+
+  const int kKeys = 500;
+  std::vector<Endpoint> owner(kKeys);
+  int sticky = 0, expected = 0;
+  for (int i = 0; i < kKeys; ++i) {
+    owner[i] = select(stub, keyOf(i));
+    if (owner[i] == clockwise(eps, keyOf(i)))
+      ++expected;
+    bool same = true;
+    for (int n = 0; n < 5; ++n)
+      same = same && select(stub, keyOf(i)) == owner[i];
+    if (same)
+      ++sticky;
+  }
+  check(expected == kKeys, "key maps to its owner on the ring");
+  check(sticky == kKeys, "same key maps to the same endpoint across calls");
+
+  // 排除 key 的 endpoint 的时候换到顺时针的下一个，排除其他 endpoint 不影响
+  const Endpoint &victim = eps[2];
+  int moved = 0, movedRight = 0, stayed = 0, others = 0;
+  for (int i = 0; i < kKeys; ++i) {
+    const Endpoint ep = select(stub, keyOf(i), victim);
+    if (owner[i] == victim) {
+      ++moved;
+      if (ep == clockwise(eps, keyOf(i), &victim))
+        ++movedRight;
+    } else {
+      ++others;
+      if (ep == owner[i])
+        ++stayed;
+    }
+  }
+  check(moved > 0 && movedRight == moved,
+        "excluded endpoint's keys move to the next endpoint clockwise");
+  check(stayed == others, "excluding an endpoint keeps the other keys");
+
+  // 排除之后的选择不影响之后的选择
+  int back = 0;
+  for (int i = 0; i < kKeys; ++i)
+    if (select(stub, keyOf(i)) == owner[i])
+      ++back;
+  check(back == kKeys, "exclusion does not disturb later selections");
+
+  // 熔断剔除：同样只有被剔除的 endpoint 上的 key 移动到顺时针的下一个
+  check(stub->endpointStats(victim)->breaker().eject(Timestamp::now()),
+        "eject the endpoint");
+  moved = movedRight = stayed = others = 0;
+  for (int i = 0; i < kKeys; ++i) {
+    const Endpoint ep = select(stub, keyOf(i));
+    if (owner[i] == victim) {
+      ++moved;
+      if (ep == clockwise(eps, keyOf(i), &victim))
+        ++movedRight;
+    } else {
+      ++others;
+      if (ep == owner[i])
+        ++stayed;
+    }
+  }
+  check(moved > 0 && movedRight == moved,
+        "ejected endpoint's keys move to the next endpoint clockwise");
+  check(stayed == others, "ejection keeps the other keys");
+
+  // 剔除结束之后试探请求选中原来的 endpoint，试探成功之后 key 全部回来
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  int probe = -1;
+  for (int i = 0; i < kKeys && probe < 0; ++i)
+    if (owner[i] == victim)
+      probe = i;
+  check(select(stub, keyOf(probe)) == victim, "probe goes to the owner");
+  stub->endpointStats(victim)->breaker().onResult(true, Timestamp::now());
+  back = 0;
+  for (int i = 0; i < kKeys; ++i)
+    if (select(stub, keyOf(i)) == owner[i])
+      ++back;
+  check(back == kKeys, "keys return after readmission");
+
+  printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
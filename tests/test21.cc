@@ -0,0 +1,198 @@
+/**
+ * @file test21.cc
+ * @brief Shared 拓扑下一个 endpoint 只有一个连接，getChannel 交给其他 loop
+ * 和线程的 ClientChannelPtr 持有 channel：多个线程同时通过它发送请求；
+ * 连接断开之后仍然持有的 channel 可以安全使用，等待中的和之后的请求以
+ * ConnectionLost 失败，断开的同时从其他线程发送的请求也都会完成
+ */
+
+#include "ClientStub.h"
+#include "EventLoop.h"
+#include "Logging.h"
+#include "RpcService.h"
+#include "Server.h"
+#include "TcpServer.h"
+#include "test_rpc.pb.h"
+#include "test_util.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+class TestServiceImpl : public test::TestService {
+public:
+  void Echo(::google::protobuf::RpcController *,
+            const test::EchoRequest *request, test::EchoResponse *response,
+            ::google::protobuf::Closure *done) override {
+    response->set_text(request->text());
+    done->Run();
+  }
+};
+
+/// @brief 从不回复的对端，dropAll 关闭当前所有的连接
+class SilentServer {
+public:
+  explicit SilentServer(uint16_t port) : port_(port) {}
+
+  void run() {
+    EventLoop loop;
+    TcpServer server(&loop, InetAddress("127.0.0.1", port_));
+    server.setConnectionCallback([this](const TcpConnectionPtr &conn) {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (conn->connected())
+        conns_.push_back(conn);
+    });
+    server.setMessageCallback(
+        [](const TcpConnectionPtr &, Buffer *buf, Timestamp) {
+          buf->retrieveAll();
+        });
+    server.start();
+    loop_ = &loop;
+    loop.loop();
+  }
+
+  void dropAll() {
+    loop_.load()->runInLoop([this]() {
+      std::lock_guard<std::mutex> lk(mutex_);
+      for (auto &conn : conns_)
+        conn->shutdown();
+      conns_.clear();
+    });
+  }
+
+private:
+  const uint16_t port_;
+  std::atomic<EventLoop *> loop_{nullptr};
+  std::mutex mutex_;
+  std::vector<TcpConnectionPtr> conns_;
+};
+
+static std::shared_ptr<test::EchoRequest> makeRequest(const std::string &text) {
+  auto req = std::make_shared<test::EchoRequest>();
+  req->set_text(text);
+  return req;
+}
+
+static ClientChannelPtr channelTo(ClientStub *stub, const Endpoint &ep) {
+  auto r = stub->getChannel(ep).wait();
+  return r.getValue();
+}
+
+/// @brief 多个线程通过同一个 channel 发送请求，请求被提交到连接所属的 loop
+static void testConcurrent(ClientStub *stub, const Endpoint &ep) {
+  ClientChannelPtr first = channelTo(stub, ep);
+  bool same = true;
+  for (int i = 0; i < 8; ++i)
+    same = same && channelTo(stub, ep) == first;
+  check(same, "every loop gets the one shared channel");
+
+  std::atomic<int> ok{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      ClientChannelPtr channel = channelTo(stub, ep);
+      for (int i = 0; i < 200; ++i) {
+        const std::string text = std::to_string(t) + ":" + std::to_string(i);
+        auto r = channel->invoke<test::EchoResponse>("Echo", makeRequest(text))
+                     .wait();
+        if (!r.hasException() && r.getValue().text() == text)
+          ++ok;
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  check(ok == 800, "calls from other threads through the shared channel");
+}
+
+/// @brief 连接断开之后 channel 仍然被持有
+static void testDisconnect(ClientStub *stub, const Endpoint &ep,
+                           SilentServer &peer) {
+  ClientChannelPtr channel = channelTo(stub, ep);
+  auto pending =
+      channel->invoke<test::EchoResponse>("Echo", makeRequest("pending"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  peer.dropAll();
+  auto lost = pending.wait();
+  check(isError(lost, ErrorCode::ConnectionLost),
+        "pending call fails with ConnectionLost");
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  auto after = channel->invoke<test::EchoResponse>("Echo", makeRequest("after"))
+                   .wait();
+  check(isError(after, ErrorCode::ConnectionLost),
+        "held channel refuses calls after disconnect");
+  check(channel->outstanding() == 0, "no call is left on the held channel");
+
+  // 断开的同时其他线程还在通过 channel 发送请求，每个请求都会完成
+  ClientChannelPtr fresh = channelTo(stub, ep);
+  check(fresh != channel, "a new connection replaces the lost one");
+  CallOptions options;
+  options.timeout = std::chrono::milliseconds(300);
+  std::atomic<int> done{0}, unexpected{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&]() {
+      std::vector<Future<Result<test::EchoResponse>>> futures;
+      for (int i = 0; i < 100; ++i) {
+        futures.push_back(fresh->invoke<test::EchoResponse>(
+            "Echo", makeRequest("racing"), options));
+        if (i % 10 == 0)
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      for (auto &f : futures) {
+        auto r = f.wait();
+        ++done;
+        if (!isError(r, ErrorCode::ConnectionLost) &&
+            !isError(r, ErrorCode::Timeout))
+          ++unexpected;
+      }
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  peer.dropAll();
+  for (auto &thread : threads)
+    thread.join();
+  check(done == 400 && unexpected == 0,
+        "calls racing the disconnect complete with an error");
+  check(fresh->outstanding() == 0, "racing calls release their slots");
+}
+
+int main() {
+  Logger::setLogLevel(Logger::ERROR);
+  auto service = new Service(new TestServiceImpl);
+  service->setEndpoint(createEndpoint("127.0.0.1:9985"));
+  auto stub = new ClientStub(new test::TestService_Stub(nullptr));
+  stub->setUrlLists("127.0.0.1:9985;127.0.0.1:9986");
+  ConnectionOptions conn;
+  conn.topology = ConnectionTopology::Shared;
+  stub->setConnectionOptions(conn);
+
+  RpcServer server;
+  server.setThreadNum(3);
+  server.addService(service);
+  server.addClientStub(stub);
+
+  std::thread t([stub]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    // ClientStub 按照 EventLoop 的编号保存连接，对端的 loop 在 RpcServer
+    // 的 loop 之后创建
+    static SilentServer silent(9986);
+    std::thread peer([]() { silent.run(); });
+    peer.detach();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    testConcurrent(stub, createEndpoint("127.0.0.1:9985"));
+    testDisconnect(stub, createEndpoint("127.0.0.1:9986"), silent);
+    printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+    fflush(stdout);
+    std::_Exit(failures == 0 ? 0 : 1);
+  });
+  t.detach();
+  server.startServer();
+}
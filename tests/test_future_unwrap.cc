@@ -0,0 +1,95 @@
+/**
+ * @file test_future_unwrap.cc
+ * @brief Future::unwrap：loop 中的任务返回已经就绪的 future 的时候，
+ * 外层 future 也要完成（之前回调永远不会执行，wait 一直等待）
+ */
+
+#include "EventLoop.h"
+#include "EventLoopThread.h"
+#include "future.h"
+#include "test_util.h"
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+int main() {
+  EventLoopThread thread;
+  EventLoop *loop = thread.startLoop();
+  const auto timeout = std::chrono::milliseconds(1000);
+
+  // 外层 future 在 unwrap 之后完成，内部 future 已经就绪
+  {
+    Promise<Future<int>> outer;
+    auto fut = outer.getFuture().unwrap();
+    outer.setValue(makeReadyFuture(42));
+    try {
+      auto r = fut.wait(timeout);
+      check(r.getValue() == 42, "unwrap ready value");
+    } catch (const std::exception &e) {
+      check(false, "unwrap ready value");
+    }
+  }
+
+  // 外层 future 在 unwrap 之后完成，内部 future 已经以异常完成
+  {
+    Promise<Future<int>> outer;
+    auto fut = outer.getFuture().unwrap();
+    outer.setValue(
+        makeExceptionFuture<int>(std::runtime_error("inner failed")));
+    try {
+      auto r = fut.wait(timeout);
+      bool thrown = false;
+      try {
+        r.getValue();
+      } catch (const std::runtime_error &e) {
+        thrown = std::string(e.what()) == "inner failed";
+      }
+      check(thrown, "unwrap ready exception");
+    } catch (const std::exception &e) {
+      check(false, "unwrap ready exception");
+    }
+  }
+
+  // loop 中的任务返回已经就绪的 future
+  {
+    auto fut = loop->Execute([]() { return makeReadyFuture(5); }).unwrap();
+    try {
+      auto r = fut.wait(timeout);
+      check(r.getValue() == 5, "unwrap loop task");
+    } catch (const std::exception &e) {
+      check(false, "unwrap loop task");
+    }
+  }
+
+  // 内部 future 之后才就绪
+  {
+    auto promise = std::make_shared<Promise<int>>();
+    auto fut = loop->Execute([promise]() { return promise->getFuture(); })
+                   .unwrap();
+    loop->runAfter(0.05, [promise]() { promise->setValue(7); });
+    try {
+      auto r = fut.wait(timeout);
+      check(r.getValue() == 7, "unwrap pending value");
+    } catch (const std::exception &e) {
+      check(false, "unwrap pending value");
+    }
+  }
+
+  // 在调用 unwrap 之前外层 future 已经完成
+  {
+    auto outer = makeReadyFuture(makeReadyFuture(std::string("done")));
+    try {
+      auto r = outer.unwrap().wait(timeout);
+      check(r.getValue() == "done", "unwrap ready outer");
+    } catch (const std::exception &e) {
+      check(false, "unwrap ready outer");
+    }
+  }
+
+  printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file test_shared_future.cc
+ * @brief SharedFuture：多个消费者得到同一个结果的拷贝，结果就绪之后
+ * getFuture 返回已经就绪的 future，异常传递给每个消费者
+ */
+
+#include "EventLoop.h"
+#include "EventLoopThread.h"
+#include "future.h"
+#include "test_util.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lrpc;
+using namespace lrpc::net;
+
+int main() {
+  const auto timeout = std::chrono::milliseconds(1000);
+
+  // 结果就绪之前的多个消费者
+  {
+    Promise<std::string> promise;
+    SharedFuture<std::string> shared(promise.getFuture());
+    std::vector<Future<std::string>> futures;
+    for (int i = 0; i < 3; ++i)
+      futures.push_back(shared.getFuture());
+    check(!shared.isReady() && shared.waiters() == 3, "waiters before ready");
+    promise.setValue(std::string("value"));
+    int same = 0;
+    for (auto &f : futures) {
+      auto r = f.wait(timeout);
+      if (r.getValue() == "value")
+        ++same;
+    }
+    check(same == 3, "every waiter gets a copy");
+    check(shared.isReady() && shared.waiters() == 0, "ready");
+    // 结果就绪之后调用 getFuture
+    auto late = shared.getFuture().wait(timeout);
+    check(late.getValue() == "value", "getFuture after ready");
+  }
+
+  // 异常传递给每个消费者
+  {
+    Promise<int> promise;
+    SharedFuture<int> shared(promise.getFuture());
+    auto f1 = shared.getFuture();
+    auto f2 = shared.getFuture();
+    promise.setException(
+        std::make_exception_ptr(std::runtime_error("shared failed")));
+    int thrown = 0;
+    for (auto *f : {&f1, &f2}) {
+      try {
+        auto r = f->wait(timeout);
+        r.getValue();
+      } catch (const std::runtime_error &e) {
+        if (std::string(e.what()) == "shared failed")
+          ++thrown;
+      }
+    }
+    check(thrown == 2, "exception to every waiter");
+  }
+
+  // 回调中再次调用 getFuture 不会死锁
+  {
+    Promise<int> promise;
+    auto shared = std::make_shared<SharedFuture<int>>(promise.getFuture());
+    std::atomic<int> nested{0};
+    shared->getFuture().then([shared, &nested](Result<int> &&r) {
+      shared->getFuture().then(
+          [&nested](Result<int> &&r) { nested = r.getValue(); });
+    });
+    promise.setValue(9);
+    check(nested == 9, "getFuture in callback");
+  }
+
+  // 多个线程同时等待，结果在 loop 中设置
+  {
+    EventLoopThread thread;
+    EventLoop *loop = thread.startLoop();
+    auto promise = std::make_shared<Promise<int>>();
+    SharedFuture<int> shared(promise->getFuture());
+    std::atomic<int> ok{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+      threads.emplace_back([&shared, &ok, timeout]() {
+        try {
+          auto r = shared.getFuture().wait(timeout);
+          if (r.getValue() == 3)
+            ++ok;
+        } catch (const std::exception &e) {
+        }
+      });
+    loop->runAfter(0.05, [promise]() { promise->setValue(3); });
+    for (auto &t : threads)
+      t.join();
+    check(ok == 8, "concurrent waiters");
+  }
+
+  printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
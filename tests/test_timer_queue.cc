@@ -0,0 +1,59 @@
+/**
+ * @file test_timer_queue.cc
+ * @brief TimerQueue::getExpired：到期时间恰好等于 now 的 Timer 也要被取出.
+ * 在一段时间内的每一微秒都放置 Timer，handleRead 读到的 now 一定和某个
+ * Timer 的到期时间相等；另外放置一组到期时间完全相同的 Timer
+ */
+
+#include "EventLoop.h"
+#include "Timestamp.h"
+#include "test_util.h"
+#include <cstdio>
+#include <vector>
+
+using namespace lrpc::net;
+using lrpc::util::Timestamp;
+
+int main() {
+  EventLoop loop;
+  const int kDense = 100 * 1000; // 100ms 内每一微秒一个 Timer
+  const int kSame = 1000;        // 到期时间相同的 Timer
+  const int kCancelled = 100;
+
+  // 留出插入所有 Timer 的时间，开始 loop 的时候还没有 Timer 到期
+  const Timestamp base = addTime(Timestamp::now(), 1.0);
+  int fired = 0, early = 0, same = 0, cancelledFired = 0;
+  std::vector<int> counts(kDense, 0);
+  for (int i = 0; i < kDense; ++i) {
+    const Timestamp when(base.microSecondsSinceEpoch() + i);
+    loop.runAt(when, [&, i, when]() {
+      ++fired;
+      ++counts[i];
+      if (Timestamp::now() < when)
+        ++early;
+    });
+  }
+  const Timestamp sameTime = addTime(base, 0.05);
+  for (int i = 0; i < kSame; ++i)
+    loop.runAt(sameTime, [&]() { ++same; });
+  std::vector<TimerId> ids;
+  for (int i = 0; i < kCancelled; ++i)
+    ids.push_back(loop.runAt(sameTime, [&]() { ++cancelledFired; }));
+  for (auto &id : ids)
+    loop.cancel(id);
+
+  loop.runAt(addTime(base, 0.5), [&]() { loop.quit(); });
+  loop.loop();
+
+  int once = 0;
+  for (int c : counts)
+    if (c == 1)
+      ++once;
+  check(fired == kDense && once == kDense, "every dense timer fired once");
+  check(early == 0, "no timer fired early");
+  check(same == kSame, "timers with the same expiration");
+  check(cancelledFired == 0, "cancelled timers");
+
+  printf("%s\n", failures == 0 ? "ALL PASSED" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
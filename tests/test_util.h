@@ -0,0 +1,46 @@
+/**
+ * @file test_util.h
+ * @brief tests 下的测试程序共用的检查函数：打印每一项检查的结果，
+ * 记录失败的次数，main 根据 failures 决定退出码
+ */
+
+#ifndef LRPC_TEST_UTIL_H
+#define LRPC_TEST_UTIL_H
+
+#include "RpcException.h"
+#include "future.h"
+#include <cstdio>
+#include <functional>
+#include <system_error>
+
+/// @brief 失败的检查数
+inline int failures = 0;
+
+inline void check(bool ok, const char *what) {
+  printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok)
+    ++failures;
+}
+
+/// @brief r 是否是 code 对应的 lrpc 异常
+template <typename T>
+bool isError(lrpc::Result<T> &r, lrpc::ErrorCode code) {
+  try {
+    r.getValue();
+  } catch (const std::system_error &e) {
+    return e.code().value() == static_cast<int>(code);
+  }
+  return false;
+}
+
+/// @brief func 是否抛出 code 对应的 lrpc 异常
+inline bool throws(lrpc::ErrorCode code, const std::function<void()> &func) {
+  try {
+    func();
+  } catch (const std::system_error &e) {
+    return e.code().value() == static_cast<int>(code);
+  }
+  return false;
+}
+
+#endif
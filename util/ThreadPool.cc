@@ -0,0 +1,97 @@
+#include "ThreadPool.h"
+#include <assert.h>
+
+namespace lrpc {
+
+namespace util {
+
+ThreadPool::ThreadPool(const std::string &name, size_t threadNum)
+    : name_(name), threadNum_(threadNum > 0 ? threadNum : 1) {}
+
+ThreadPool::~ThreadPool() { stop(); }
+
+void ThreadPool::start() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  assert(threads_.empty());
+  running_ = true;
+  threads_.reserve(threadNum_);
+  for (size_t i = 0; i < threadNum_; ++i)
+    threads_.emplace_back(&ThreadPool::_threadFunc, this);
+}
+
+void ThreadPool::stop() {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (!running_)
+      return;
+    running_ = false;
+    timers_.clear();
+  }
+  cv_.notify_all();
+  for (auto &t : threads_)
+    t.join();
+  threads_.clear();
+}
+
+void ThreadPool::Schedule(std::function<void()> f) {
+  Schedule(std::move(f), 0);
+}
+
+void ThreadPool::Schedule(std::function<void()> f, int priority) {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    tasks_[priority].push_back(std::move(f));
+    ++taskCount_;
+  }
+  cv_.notify_one();
+}
+
+void ThreadPool::ScheduleLater(std::chrono::milliseconds duration,
+                               std::function<void()> f) {
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    timers_.emplace(Clock::now() + duration, std::move(f));
+  }
+  // 新的定时任务可能比正在等待的更早到期
+  cv_.notify_one();
+}
+
+size_t ThreadPool::queueSize() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return taskCount_;
+}
+
+void ThreadPool::_threadFunc() {
+  std::unique_lock<std::mutex> lk(mutex_);
+  for (;;) {
+    // 到期的定时任务移到任务队列
+    const auto now = Clock::now();
+    while (!timers_.empty() && timers_.begin()->first <= now) {
+      tasks_[0].push_back(std::move(timers_.begin()->second));
+      ++taskCount_;
+      timers_.erase(timers_.begin());
+    }
+    if (taskCount_ > 0) {
+      auto queue = tasks_.begin();
+      while (queue->second.empty())
+        ++queue;
+      auto task = std::move(queue->second.front());
+      queue->second.pop_front();
+      --taskCount_;
+      lk.unlock();
+      task();
+      lk.lock();
+      continue;
+    }
+    if (!running_)
+      break;
+    if (timers_.empty())
+      cv_.wait(lk);
+    else
+      cv_.wait_until(lk, timers_.begin()->first);
+  }
+}
+
+} // namespace util
+
+} // namespace lrpc
@@ -0,0 +1,70 @@
+#ifndef LRPC_THREADPOOL_H
+#define LRPC_THREADPOOL_H
+
+#include "Scheduler.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lrpc {
+
+namespace util {
+
+/**
+ * @brief 固定线程数的线程池，所有线程共享一个任务队列.
+ * 用于执行会阻塞 EventLoop 的 rpc handler，也可以作为 Future::then 的 Scheduler.
+ * 任务按照 priority 从小到大执行，相同 priority 的任务先进先出
+ */
+class ThreadPool : public Scheduler {
+public:
+  ThreadPool(const std::string &name, size_t threadNum);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  void start();
+  /// @brief 停止接收新任务，等待队列中的任务执行完之后回收线程
+  void stop();
+
+  /// @brief 等价于 priority 为 0 的 Schedule
+  void Schedule(std::function<void()> f) override;
+  void Schedule(std::function<void()> f, int priority);
+  void ScheduleLater(std::chrono::milliseconds duration,
+                     std::function<void()> f) override;
+
+  const std::string &name() const { return name_; }
+  size_t threadNum() const { return threadNum_; }
+  /// @brief 等待执行的任务数
+  size_t queueSize() const;
+
+private:
+  void _threadFunc();
+
+  using Clock = std::chrono::steady_clock;
+
+  const std::string name_;
+  const size_t threadNum_;
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  // priority -> 任务队列，空的队列不会删除，优先级通常只有几种
+  std::map<int, std::deque<std::function<void()>>> tasks_;
+  size_t taskCount_{0};
+  // ScheduleLater 的任务，到期之后由空闲线程执行
+  std::multimap<Clock::time_point, std::function<void()>> timers_;
+  bool running_{false};
+};
+
+} // namespace util
+
+} // namespace lrpc
+
+#endif
@@ -51,7 +51,7 @@ inline std::vector<std::string> splitString(const std::string &str,
     if (start < sep)
       results.emplace_back(str.substr(start, sep - start));
     start = sep + 1;
-    sep = str.find(seperator);
+    sep = str.find(seperator, start);
   }
   if (start != str.size())
     results.emplace_back(str.substr(start));